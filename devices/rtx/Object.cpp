@@ -44,10 +44,26 @@ Object::Object(ANARIDataType type, DeviceGlobalState *s)
 }
 
 void Object::commit()
+{
+  deviceState()->commitStats.objectCommitStarted();
+  commitObject();
+}
+
+void Object::commitObject()
 {
   // no-op
 }
 
+void Object::markCommitted()
+{
+  helium::BaseObject::markCommitted();
+  deviceState()->commitStats.objectCommitted(
+      type(), [&](CommitStats::ObjectEntry &e) {
+        e.subtype = m_subtype;
+        e.name = getParamString("name", "");
+      });
+}
+
 bool Object::getProperty(
     const std::string_view &name, ANARIDataType type, void *ptr, uint32_t flags)
 {
@@ -74,6 +90,16 @@ DeviceGlobalState *Object::deviceState() const
   return (DeviceGlobalState *)helium::BaseObject::m_state;
 }
 
+void Object::setSubtype(std::string_view subtype)
+{
+  m_subtype = subtype;
+}
+
+const std::string &Object::subtype() const
+{
+  return m_subtype;
+}
+
 } // namespace visrtx
 
 VISRTX_ANARI_TYPEFOR_DEFINITION(visrtx::Object *);
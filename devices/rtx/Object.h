@@ -42,6 +42,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <string>
 #include <string_view>
 // cuda/optix
 #include "optix_visrtx.h"
@@ -58,13 +59,24 @@ struct Object : public helium::BaseObject
       void *ptr,
       uint32_t flags);
 
-  virtual void commit();
+  // Starts timing the commit for the device's CommitStats (markCommitted()
+  // stops it), then runs commitObject() to apply the object's parameters
+  void commit() final;
+  virtual void commitObject();
+
+  void markCommitted() override;
 
   virtual void *deviceData() const;
 
   virtual bool isValid() const;
 
   DeviceGlobalState *deviceState() const;
+
+  void setSubtype(std::string_view subtype);
+  const std::string &subtype() const;
+
+ private:
+  std::string m_subtype;
 };
 
 } // namespace visrtx
@@ -50,6 +50,7 @@
 #include "renderer/AmbientOcclusion.h"
 #include "renderer/Debug.h"
 #include "renderer/DiffusePathTracer.h"
+#include "renderer/RayQuery.h"
 #include "renderer/Raycast.h"
 #include "renderer/SciVis.h"
 #include "renderer/Test.h"
@@ -59,6 +60,13 @@
 
 namespace visrtx {
 
+template <typename T>
+static T *withSubtype(T *obj, const char *subtype)
+{
+  obj->setSubtype(subtype);
+  return obj;
+}
+
 const char **query_object_types(ANARIDataType type);
 
 const void *query_object_info(ANARIDataType type,
@@ -173,7 +181,8 @@ ANARICamera VisRTXDevice::newCamera(const char *subtype)
   if (!initDevice())
     return {};
   CUDADeviceScope ds(this);
-  return (ANARICamera)Camera::createInstance(subtype, deviceState());
+  return (ANARICamera)withSubtype(
+      Camera::createInstance(subtype, deviceState()), subtype);
 }
 
 ANARIFrame VisRTXDevice::newFrame()
@@ -189,7 +198,8 @@ ANARIGeometry VisRTXDevice::newGeometry(const char *subtype)
   if (!initDevice())
     return {};
   CUDADeviceScope ds(this);
-  return (ANARIGeometry)Geometry::createInstance(subtype, deviceState());
+  return (ANARIGeometry)withSubtype(
+      Geometry::createInstance(subtype, deviceState()), subtype);
 }
 
 ANARIGroup VisRTXDevice::newGroup()
@@ -205,7 +215,7 @@ ANARIInstance VisRTXDevice::newInstance(const char *type)
   if (!initDevice())
     return {};
   CUDADeviceScope ds(this);
-  return (ANARIInstance) new Instance(deviceState());
+  return (ANARIInstance)withSubtype(new Instance(deviceState()), type);
 }
 
 ANARILight VisRTXDevice::newLight(const char *subtype)
@@ -213,7 +223,8 @@ ANARILight VisRTXDevice::newLight(const char *subtype)
   if (!initDevice())
     return {};
   CUDADeviceScope ds(this);
-  return (ANARILight)Light::createInstance(subtype, deviceState());
+  return (ANARILight)withSubtype(
+      Light::createInstance(subtype, deviceState()), subtype);
 }
 
 ANARIMaterial VisRTXDevice::newMaterial(const char *subtype)
@@ -221,7 +232,8 @@ ANARIMaterial VisRTXDevice::newMaterial(const char *subtype)
   if (!initDevice())
     return {};
   CUDADeviceScope ds(this);
-  return (ANARIMaterial)Material::createInstance(subtype, deviceState());
+  return (ANARIMaterial)withSubtype(
+      Material::createInstance(subtype, deviceState()), subtype);
 }
 
 ANARIRenderer VisRTXDevice::newRenderer(const char *subtype)
@@ -229,7 +241,8 @@ ANARIRenderer VisRTXDevice::newRenderer(const char *subtype)
   if (!initDevice())
     return {};
   CUDADeviceScope ds(this);
-  return (ANARIRenderer)Renderer::createInstance(subtype, deviceState());
+  return (ANARIRenderer)withSubtype(
+      Renderer::createInstance(subtype, deviceState()), subtype);
 }
 
 ANARISampler VisRTXDevice::newSampler(const char *subtype)
@@ -237,7 +250,8 @@ ANARISampler VisRTXDevice::newSampler(const char *subtype)
   if (!initDevice())
     return {};
   CUDADeviceScope ds(this);
-  return (ANARISampler)Sampler::createInstance(subtype, deviceState());
+  return (ANARISampler)withSubtype(
+      Sampler::createInstance(subtype, deviceState()), subtype);
 }
 
 ANARISpatialField VisRTXDevice::newSpatialField(const char *subtype)
@@ -245,8 +259,8 @@ ANARISpatialField VisRTXDevice::newSpatialField(const char *subtype)
   if (!initDevice())
     return {};
   CUDADeviceScope ds(this);
-  return (ANARISpatialField)SpatialField::createInstance(
-      subtype, deviceState());
+  return (ANARISpatialField)withSubtype(
+      SpatialField::createInstance(subtype, deviceState()), subtype);
 }
 
 ANARISurface VisRTXDevice::newSurface()
@@ -262,7 +276,8 @@ ANARIVolume VisRTXDevice::newVolume(const char *subtype)
   if (!initDevice())
     return {};
   CUDADeviceScope ds(this);
-  return (ANARIVolume)Volume::createInstance(subtype, deviceState());
+  return (ANARIVolume)withSubtype(
+      Volume::createInstance(subtype, deviceState()), subtype);
 }
 
 ANARIWorld VisRTXDevice::newWorld()
@@ -398,6 +413,7 @@ VisRTXDevice::~VisRTXDevice()
   optixModuleDestroy(state.rendererModules.diffusePathTracer);
   optixModuleDestroy(state.rendererModules.scivis);
   optixModuleDestroy(state.rendererModules.test);
+  optixModuleDestroy(state.rendererModules.rayQuery);
 
   optixModuleDestroy(state.intersectionModules.customIntersectors);
 
@@ -501,6 +517,8 @@ void VisRTXDevice::deviceCommitParameters()
   helium::BaseDevice::deviceCommitParameters();
   m_eagerInit = getParam<bool>("forceInit", false);
   m_desiredGpuID = getParam<int>("cudaDevice", 0);
+  deviceState()->commitStats.setMaxSlowest(
+      getParam<uint32_t>("commitStatsCount", 10));
   if (m_gpuID >= 0 && m_desiredGpuID != m_gpuID) {
     reportMessage(ANARI_SEVERITY_WARNING,
         "visrtx was already initialized to use GPU %i"
@@ -540,10 +558,64 @@ int VisRTXDevice::deviceGetProperty(
   } else if (prop == "visrtx" && type == ANARI_BOOL) {
     helium::writeToVoidP(mem, true);
     return 1;
+  } else if (prop == "commitStats.seconds" && type == ANARI_FLOAT64) {
+    helium::writeToVoidP(mem, deviceState()->commitStats.flushSeconds());
+    return 1;
+  } else if (prop == "commitStats.objects" && type == ANARI_UINT64) {
+    helium::writeToVoidP(
+        mem, uint64_t(deviceState()->commitStats.numObjects()));
+    return 1;
+  } else if (prop == "commitStats.uploadBytes" && type == ANARI_UINT64) {
+    helium::writeToVoidP(
+        mem, uint64_t(deviceState()->commitStats.uploadBytes()));
+    return 1;
+  } else if (prop == "commitStats.slowest" && type == ANARI_STRING_LIST) {
+    updateCommitStatsReport();
+    helium::writeToVoidP(mem, m_commitStatsReportPtrs.data());
+    return 1;
+  } else if (prop == "commitStats.types" && type == ANARI_STRING_LIST) {
+    updateCommitStatsReport();
+    helium::writeToVoidP(mem, m_commitStatsTypePtrs.data());
+    return 1;
   }
   return 0;
 }
 
+void VisRTXDevice::updateCommitStatsReport()
+{
+  const auto &stats = deviceState()->commitStats;
+
+  auto ms = [](double seconds) { return seconds * 1000.0; };
+
+  m_commitStatsReport.clear();
+  for (const auto &o : stats.slowestObjects()) {
+    std::stringstream ss;
+    ss << anari::toString(ANARIDataType(o.type)) << " '" << o.subtype << "'";
+    if (!o.name.empty())
+      ss << " \"" << o.name << "\"";
+    ss << ": " << ms(o.seconds) << "ms";
+    m_commitStatsReport.push_back(ss.str());
+  }
+
+  m_commitStatsTypes.clear();
+  for (const auto &t : stats.typeTotals()) {
+    std::stringstream ss;
+    ss << anari::toString(ANARIDataType(t.first)) << ": " << t.second.count
+       << " objects, " << ms(t.second.seconds) << "ms";
+    m_commitStatsTypes.push_back(ss.str());
+  }
+
+  auto toPtrs = [](const auto &strings, auto &ptrs) {
+    ptrs.clear();
+    for (const auto &s : strings)
+      ptrs.push_back(s.c_str());
+    ptrs.push_back(nullptr);
+  };
+
+  toPtrs(m_commitStatsReport, m_commitStatsReportPtrs);
+  toPtrs(m_commitStatsTypes, m_commitStatsTypePtrs);
+}
+
 void VisRTXDevice::initOptix()
 {
   if (m_initStatus != DeviceInitStatus::UNINITIALIZED)
@@ -675,6 +747,8 @@ void VisRTXDevice::initOptix()
       state.rendererModules.scivis, SciVis::ptx(), "'scivis' renderer"));
   compileTasks.push_back(
       init_module(state.rendererModules.test, Test::ptx(), "'test' renderer"));
+  compileTasks.push_back(init_module(
+      state.rendererModules.rayQuery, RayQuery::ptx(), "ray queries"));
 
   compileTasks.push_back(
       init_module(state.intersectionModules.customIntersectors,
@@ -144,6 +144,8 @@ struct VisRTXDevice : public helium::BaseDevice
   int deviceGetProperty(
       const char *name, ANARIDataType type, void *mem, uint64_t size) override;
 
+  void updateCommitStatsReport();
+
   void initOptix(); // _not_ thread safe init of OptiX
   void setCUDADevice();
   void revertCUDADevice();
@@ -155,6 +157,11 @@ struct VisRTXDevice : public helium::BaseDevice
   int m_appGpuID{-1};
   bool m_eagerInit{false};
   DeviceInitStatus m_initStatus{DeviceInitStatus::UNINITIALIZED};
+
+  std::vector<std::string> m_commitStatsReport;
+  std::vector<const char *> m_commitStatsReportPtrs;
+  std::vector<std::string> m_commitStatsTypes;
+  std::vector<const char *> m_commitStatsTypePtrs;
 };
 
 } // namespace visrtx
@@ -9,7 +9,7 @@
 #include <anari/anari.h>
 namespace visrtx {
 static int subtype_hash(const char *str) {
-   static const uint32_t table[] = {0x80000000u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0075u,0x0u,0x7a6f0077u,0x71650090u,0x0u,0x0u,0x0u,0x0u,0x6e6d00b5u,0x0u,0x0u,0x0u,0x626100bfu,0x0u,0x737200c4u,0x736500d0u,0x76750102u,0x62610106u,0x7563010du,0x73720139u,0x1000076u,0x80000001u,0x6f6e0082u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720085u,0x0u,0x0u,0x0u,0x6d6c0089u,0x66650083u,0x1000084u,0x80000002u,0x77760086u,0x66650087u,0x1000088u,0x80000003u,0x6a69008au,0x6f6e008bu,0x6564008cu,0x6665008du,0x7372008eu,0x100008fu,0x80000004u,0x6762009cu,0x0u,0x0u,0x0u,0x737200a9u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x757400b3u,0x767500a1u,0x0u,0x0u,0x0u,0x626100a4u,0x686700a2u,0x10000a3u,0x80000005u,0x767500a5u,0x6d6c00a6u,0x757400a7u,0x10000a8u,0x80000006u,0x666500aau,0x646300abu,0x757400acu,0x6a6900adu,0x706f00aeu,0x6f6e00afu,0x626100b0u,0x6d6c00b1u,0x10000b2u,0x80000007u,0x10000b4u,0x80000008u,0x626100b6u,0x686700b7u,0x666500b8u,0x333100b9u,0x454400bbu,0x454400bdu,0x10000bcu,0x80000009u,0x10000beu,0x8000000au,0x757400c0u,0x757400c1u,0x666500c2u,0x10000c3u,0x8000000bu,0x757400c5u,0x696800c6u,0x706f00c7u,0x686700c8u,0x737200c9u,0x626100cau,0x717000cbu,0x696800ccu,0x6a6900cdu,0x646300ceu,0x10000cfu,0x8000000cu,0x737200deu,0x0u,0x0u,0x7a7900e8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6900f6u,0x0u,0x0u,0x6a6900fau,0x747300dfu,0x717000e0u,0x666500e1u,0x646300e2u,0x757400e3u,0x6a6900e4u,0x777600e5u,0x666500e6u,0x10000e7u,0x8000000du,0x747300e9u,0x6a6900eau,0x646300ebu,0x626100ecu,0x6d6c00edu,0x6d6c00eeu,0x7a7900efu,0x434200f0u,0x626100f1u,0x747300f2u,0x666500f3u,0x656400f4u,0x10000f5u,0x8000000eu,0x6f6e00f7u,0x757400f8u,0x10000f9u,0x8000000fu,0x6e6d00fbu,0x6a6900fcu,0x757400fdu,0x6a6900feu,0x777600ffu,0x66650100u,0x1000101u,0x80000010u,0x62610103u,0x65640104u,0x1000105u,0x80000011u,0x7a790107u,0x64630108u,0x62610109u,0x7473010au,0x7574010bu,0x100010cu,0x80000012u,0x6a69011fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x69680124u,0x0u,0x0u,0x0u,0x73720129u,0x77760120u,0x6a690121u,0x74730122u,0x1000123u,0x80000013u,0x66650125u,0x73720126u,0x66650127u,0x1000128u,0x80000014u,0x7675012au,0x6463012bu,0x7574012cu,0x7675012du,0x7372012eu,0x6665012fu,0x65640130u,0x53520131u,0x66650132u,0x68670133u,0x76750134u,0x6d6c0135u,0x62610136u,0x73720137u,0x1000138u,0x80000015u,0x6a61013au,0x6f6e0143u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261014au,0x74730144u,0x67660145u,0x706f0146u,0x73720147u,0x6e6d0148u,0x1000149u,0x80000016u,0x6f6e014bu,0x6867014cu,0x6d6c014du,0x6665014eu,0x100014fu,0x80000017u};
+   static const uint32_t table[] = {0x80000000u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0075u,0x0u,0x7a6f0077u,0x71650090u,0x0u,0x0u,0x0u,0x0u,0x746d00b5u,0x0u,0x0u,0x0u,0x626100ceu,0x0u,0x736d00d3u,0x736500f2u,0x76750124u,0x62610128u,0x7563012fu,0x7372017bu,0x1000076u,0x80000001u,0x6f6e0082u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720085u,0x0u,0x0u,0x0u,0x6d6c0089u,0x66650083u,0x1000084u,0x80000002u,0x77760086u,0x66650087u,0x1000088u,0x80000003u,0x6a69008au,0x6f6e008bu,0x6564008cu,0x6665008du,0x7372008eu,0x100008fu,0x80000004u,0x6762009cu,0x0u,0x0u,0x0u,0x737200a9u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x757400b3u,0x767500a1u,0x0u,0x0u,0x0u,0x626100a4u,0x686700a2u,0x10000a3u,0x80000005u,0x767500a5u,0x6d6c00a6u,0x757400a7u,0x10000a8u,0x80000006u,0x666500aau,0x646300abu,0x757400acu,0x6a6900adu,0x706f00aeu,0x6f6e00afu,0x626100b0u,0x6d6c00b1u,0x10000b2u,0x80000007u,0x10000b4u,0x80000008u,0x626100bcu,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f00c5u,0x686700bdu,0x666500beu,0x333100bfu,0x454400c1u,0x454400c3u,0x10000c2u,0x80000009u,0x10000c4u,0x8000000au,0x747300c6u,0x767500c7u,0x737200c8u,0x676600c9u,0x626100cau,0x646300cbu,0x666500ccu,0x10000cdu,0x8000000bu,0x757400cfu,0x757400d0u,0x666500d1u,0x10000d2u,0x8000000cu,0x6f6e00d9u,0x0u,0x0u,0x0u,0x0u,0x757400e7u,0x6a6900dau,0x656400dbu,0x6a6900dcu,0x737200ddu,0x666500deu,0x646300dfu,0x757400e0u,0x6a6900e1u,0x706f00e2u,0x6f6e00e3u,0x626100e4u,0x6d6c00e5u,0x10000e6u,0x8000000du,0x696800e8u,0x706f00e9u,0x686700eau,0x737200ebu,0x626100ecu,0x717000edu,0x696800eeu,0x6a6900efu,0x646300f0u,0x10000f1u,0x8000000eu,0x73720100u,0x0u,0x0u,0x7a79010au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690118u,0x0u,0x0u,0x6a69011cu,0x74730101u,0x71700102u,0x66650103u,0x64630104u,0x75740105u,0x6a690106u,0x77760107u,0x66650108u,0x1000109u,0x8000000fu,0x7473010bu,0x6a69010cu,0x6463010du,0x6261010eu,0x6d6c010fu,0x6d6c0110u,0x7a790111u,0x43420112u,0x62610113u,0x74730114u,0x66650115u,0x65640116u,0x1000117u,0x80000010u,0x6f6e0119u,0x7574011au,0x100011bu,0x80000011u,0x6e6d011du,0x6a69011eu,0x7574011fu,0x6a690120u,0x77760121u,0x66650122u,0x1000123u,0x80000012u,0x62610125u,0x65640126u,0x1000127u,0x80000013u,0x7a790129u,0x6463012au,0x6261012bu,0x7473012cu,0x7574012du,0x100012eu,0x80000014u,0x6a690141u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690146u,0x0u,0x0u,0x0u,0x6968014au,0x0u,0x0u,0x0u,0x7372014fu,0x77760142u,0x6a690143u,0x74730144u,0x1000145u,0x80000015u,0x64630147u,0x66650148u,0x1000149u,0x80000016u,0x6665014bu,0x7372014cu,0x6665014du,0x100014eu,0x80000017u,0x76650150u,0x62610161u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6463016du,0x6e6d0162u,0x66650163u,0x65640164u,0x53520165u,0x66650166u,0x68670167u,0x76750168u,0x6d6c0169u,0x6261016au,0x7372016bu,0x100016cu,0x80000018u,0x7574016eu,0x7675016fu,0x73720170u,0x66650171u,0x65640172u,0x53520173u,0x66650174u,0x68670175u,0x76750176u,0x6d6c0177u,0x62610178u,0x73720179u,0x100017au,0x80000019u,0x6a61017cu,0x6f6e0185u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261018cu,0x74730186u,0x67660187u,0x706f0188u,0x73720189u,0x6e6d018au,0x100018bu,0x8000001au,0x6f6e018du,0x6867018eu,0x6d6c018fu,0x66650190u,0x1000191u,0x8000001bu};
    uint32_t cur = 0x75000000u;
    for(int i = 0;cur!=0;++i) {
       uint32_t idx = cur&0xFFFFu;
@@ -31,7 +31,7 @@ static int subtype_hash(const char *str) {
    return -1;
 }
 static int param_hash(const char *str) {
-   static const uint32_t table[] = {0x75630017u,0x626100a8u,0x706100c9u,0x6a61019bu,0x6e6d01b5u,0x706101bdu,0x736501d6u,0x666501efu,0x736401f5u,0x0u,0x0u,0x6a690337u,0x66610389u,0x706103a6u,0x766303c0u,0x736903fcu,0x0u,0x70610464u,0x76610492u,0x7368059du,0x717005c6u,0x706505c8u,0x736f0769u,0x64630029u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x71700034u,0x6362004cu,0x0u,0x0u,0x0u,0x0u,0x73720087u,0x7170008bu,0x75740090u,0x7675002au,0x6e6d002bu,0x7675002cu,0x6d6c002du,0x6261002eu,0x7574002fu,0x6a690030u,0x706f0031u,0x6f6e0032u,0x1000033u,0x80000000u,0x69680035u,0x62610036u,0x4e430037u,0x76750042u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0048u,0x75740043u,0x706f0044u,0x67660045u,0x67660046u,0x1000047u,0x80000001u,0x65640049u,0x6665004au,0x100004bu,0x80000002u,0x6a69004du,0x6665004eu,0x6f6e004fu,0x75740050u,0x54430051u,0x706f0062u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x64630067u,0x0u,0x0u,0x62610078u,0x62610080u,0x6d6c0063u,0x706f0064u,0x73720065u,0x1000066u,0x80000003u,0x64630068u,0x6d6c0069u,0x7675006au,0x7473006bu,0x6a69006cu,0x706f006du,0x6f6e006eu,0x4544006fu,0x6a690070u,0x74730071u,0x75740072u,0x62610073u,0x6f6e0074u,0x64630075u,0x66650076u,0x1000077u,0x80000004u,0x65640079u,0x6a69007au,0x6261007bu,0x6f6e007cu,0x6463007du,0x6665007eu,0x100007fu,0x80000005u,0x6e6d0081u,0x71700082u,0x6d6c0083u,0x66650084u,0x74730085u,0x1000086u,0x80000006u,0x62610088u,0x7a790089u,0x100008au,0x80000007u,0x6665008cu,0x6463008du,0x7574008eu,0x100008fu,0x80000008u,0x66650091u,0x6f6e0092u,0x76750093u,0x62610094u,0x75740095u,0x6a690096u,0x706f0097u,0x6f6e0098u,0x45430099u,0x706f009bu,0x6a6900a0u,0x6d6c009cu,0x706f009du,0x7372009eu,0x100009fu,0x80000009u,0x747300a1u,0x757400a2u,0x626100a3u,0x6f6e00a4u,0x646300a5u,0x666500a6u,0x10000a7u,0x8000000au,0x746300a9u,0x6c6b00bau,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666500c2u,0x686700bbu,0x737200bcu,0x706f00bdu,0x767500beu,0x6f6e00bfu,0x656400c0u,0x10000c1u,0x8000000bu,0x444300c3u,0x706f00c4u,0x6d6c00c5u,0x706f00c6u,0x737200c7u,0x10000c8u,0x8000000cu,0x716d00d8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666100e2u,0x0u,0x0u,0x0u,0x6665012eu,0x0u,0x0u,0x6d6c0197u,0x666500dcu,0x0u,0x0u,0x747300e0u,0x737200ddu,0x626100deu,0x10000dfu,0x8000000du,0x10000e1u,0x8000000eu,0x6f6e00e7u,0x0u,0x0u,0x0u,0x64630121u,0x6f6e00e8u,0x666500e9u,0x6d6c00eau,0x2f2e00ebu,0x716300ecu,0x706f00fau,0x666500ffu,0x0u,0x0u,0x0u,0x0u,0x6f6e0104u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6362010eu,0x73720116u,0x6d6c00fbu,0x706f00fcu,0x737200fdu,0x10000feu,0x8000000fu,0x71700100u,0x75740101u,0x69680102u,0x1000103u,0x80000010u,0x74730105u,0x75740106u,0x62610107u,0x6f6e0108u,0x64630109u,0x6665010au,0x4a49010bu,0x6564010cu,0x100010du,0x80000011u,0x6b6a010fu,0x66650110u,0x64630111u,0x75740112u,0x4a490113u,0x65640114u,0x1000115u,0x80000012u,0x6a690117u,0x6e6d0118u,0x6a690119u,0x7574011au,0x6a69011bu,0x7776011cu,0x6665011du,0x4a49011eu,0x6564011fu,0x1000120u,0x80000013u,0x6c6b0122u,0x66650123u,0x73720124u,0x63620125u,0x706f0126u,0x62610127u,0x73720128u,0x65640129u,0x6a69012au,0x6f6e012bu,0x6867012cu,0x100012du,0x80000014u,0x6261012fu,0x73720130u,0x64630131u,0x706f0132u,0x62610133u,0x75740134u,0x53000135u,0x80000015u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0188u,0x0u,0x0u,0x0u,0x706f018eu,0x73720189u,0x6e6d018au,0x6261018bu,0x6d6c018cu,0x100018du,0x80000016u,0x7675018fu,0x68670190u,0x69680191u,0x6f6e0192u,0x66650193u,0x74730194u,0x74730195u,0x1000196u,0x80000017u,0x706f0198u,0x73720199u,0x100019au,0x80000018u,0x757401a4u,0x0u,0x0u,0x0u,0x6f6e01a7u,0x0u,0x0u,0x0u,0x737201adu,0x626101a5u,0x10001a6u,0x80000019u,0x706f01a8u,0x6a6901a9u,0x747301aau,0x666501abu,0x10001acu,0x8000001au,0x666501aeu,0x646301afu,0x757401b0u,0x6a6901b1u,0x706f01b2u,0x6f6e01b3u,0x10001b4u,0x8000001bu,0x6a6901b6u,0x747301b7u,0x747301b8u,0x6a6901b9u,0x777601bau,0x666501bbu,0x10001bcu,0x8000001cu,0x737201ccu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c01ceu,0x0u,0x0u,0x0u,0x0u,0x0u,0x777601d3u,0x10001cdu,0x8000001du,0x757401cfu,0x666501d0u,0x737201d1u,0x10001d2u,0x8000001eu,0x7a7901d4u,0x10001d5u,0x8000001fu,0x706f01e4u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f01ebu,0x6e6d01e5u,0x666501e6u,0x757401e7u,0x737201e8u,0x7a7901e9u,0x10001eau,0x80000020u,0x767501ecu,0x717001edu,0x10001eeu,0x80000021u,0x6a6901f0u,0x686701f1u,0x696801f2u,0x757401f3u,0x10001f4u,0x80000022u,0x1000204u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610205u,0x75410261u,0x737202bau,0x0u,0x0u,0x736902bcu,0x80000023u,0x68670206u,0x66650207u,0x53000208u,0x80000024u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6665025bu,0x6867025cu,0x6a69025du,0x706f025eu,0x6f6e025fu,0x1000260u,0x80000025u,0x75740295u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6766029eu,0x0u,0x0u,0x0u,0x0u,0x737202a4u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x757402adu,0x666502b3u,0x75740296u,0x73720297u,0x6a690298u,0x63620299u,0x7675029au,0x7574029bu,0x6665029cu,0x100029du,0x80000026u,0x6766029fu,0x747302a0u,0x666502a1u,0x757402a2u,0x10002a3u,0x80000027u,0x626102a5u,0x6f6e02a6u,0x747302a7u,0x676602a8u,0x706f02a9u,0x737202aau,0x6e6d02abu,0x10002acu,0x80000028u,0x626102aeu,0x6f6e02afu,0x646302b0u,0x666502b1u,0x10002b2u,0x80000029u,0x6f6e02b4u,0x747302b5u,0x6a6902b6u,0x757402b7u,0x7a7902b8u,0x10002b9u,0x8000002au,0x10002bbu,0x8000002bu,0x656402c6u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261032fu,0x666502c7u,0x747302c8u,0x646302c9u,0x666502cau,0x6f6e02cbu,0x646302ccu,0x666502cdu,0x550002ceu,0x8000002cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0323u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x69680326u,0x73720324u,0x1000325u,0x8000002du,0x6a690327u,0x64630328u,0x6c6b0329u,0x6f6e032au,0x6665032bu,0x7473032cu,0x7473032du,0x100032eu,0x8000002eu,0x65640330u,0x6a690331u,0x62610332u,0x6f6e0333u,0x64630334u,0x66650335u,0x1000336u,0x8000002fu,0x68670338u,0x69680339u,0x7574033au,0x4700033bu,0x80000030u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610382u,0x6d6c0383u,0x6d6c0384u,0x706f0385u,0x67660386u,0x67660387u,0x1000388u,0x80000031u,0x7574038eu,0x0u,0x0u,0x0u,0x75740395u,0x6665038fu,0x73720390u,0x6a690391u,0x62610392u,0x6d6c0393u,0x1000394u,0x80000032u,0x69610396u,0x6d6c039eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f03a3u,0x6d6c039fu,0x6a6903a0u,0x646303a1u,0x10003a2u,0x80000033u,0x656403a4u,0x10003a5u,0x80000034u,0x6e6d03b5u,0x0u,0x0u,0x0u,0x626103b8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x737203bbu,0x666503b6u,0x10003b7u,0x80000035u,0x737203b9u,0x10003bau,0x80000036u,0x6e6d03bcu,0x626103bdu,0x6d6c03beu,0x10003bfu,0x80000037u,0x646303d3u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626103dbu,0x0u,0x6a6903e1u,0x0u,0x0u,0x757403e6u,0x6d6c03d4u,0x767503d5u,0x747303d6u,0x6a6903d7u,0x706f03d8u,0x6f6e03d9u,0x10003dau,0x80000038u,0x646303dcu,0x6a6903ddu,0x757403deu,0x7a7903dfu,0x10003e0u,0x80000039u,0x686703e2u,0x6a6903e3u,0x6f6e03e4u,0x10003e5u,0x8000003au,0x554f03e7u,0x676603edu,0x0u,0x0u,0x0u,0x0u,0x737203f3u,0x676603eeu,0x747303efu,0x666503f0u,0x757403f1u,0x10003f2u,0x8000003bu,0x626103f4u,0x6f6e03f5u,0x747303f6u,0x676603f7u,0x706f03f8u,0x737203f9u,0x6e6d03fau,0x10003fbu,0x8000003cu,0x79780406u,0x0u,0x0u,0x0u,0x0u,0x0u,0x78730411u,0x0u,0x0u,0x6a69041fu,0x66650407u,0x6d6c0408u,0x54530409u,0x6261040au,0x6e6d040bu,0x7170040cu,0x6d6c040du,0x6665040eu,0x7473040fu,0x1000410u,0x8000003du,0x6a690416u,0x0u,0x0u,0x0u,0x6665041cu,0x75740417u,0x6a690418u,0x706f0419u,0x6f6e041au,0x100041bu,0x8000003eu,0x7372041du,0x100041eu,0x8000003fu,0x6e6d0420u,0x6a690421u,0x75740422u,0x6a690423u,0x77760424u,0x66650425u,0x2f2e0426u,0x73610427u,0x75740439u,0x0u,0x706f0449u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f64044eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261045eu,0x7574043au,0x7372043bu,0x6a69043cu,0x6362043du,0x7675043eu,0x7574043fu,0x66650440u,0x34300441u,0x1000445u,0x1000446u,0x1000447u,0x1000448u,0x80000040u,0x80000041u,0x80000042u,0x80000043u,0x6d6c044au,0x706f044bu,0x7372044cu,0x100044du,0x80000044u,0x1000459u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6564045au,0x80000045u,0x6665045bu,0x7978045cu,0x100045du,0x80000046u,0x6564045fu,0x6a690460u,0x76750461u,0x74730462u,0x1000463u,0x80000047u,0x65640473u,0x0u,0x0u,0x0u,0x6f670478u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7675048au,0x6a690474u,0x76750475u,0x74730476u,0x1000477u,0x80000048u,0x6a690480u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640484u,0x706f0481u,0x6f6e0482u,0x1000483u,0x80000049u,0x66650485u,0x73720486u,0x66650487u,0x73720488u,0x1000489u,0x8000004au,0x6867048bu,0x6968048cu,0x6f6e048du,0x6665048eu,0x7473048fu,0x74730490u,0x1000491u,0x8000004bu,0x6e6d04a7u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666504b1u,0x7b7a04d2u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666104d5u,0x0u,0x0u,0x0u,0x6261052du,0x73720597u,0x717004a8u,0x6d6c04a9u,0x666504aau,0x4d4c04abu,0x6a6904acu,0x6e6d04adu,0x6a6904aeu,0x757404afu,0x10004b0u,0x8000004cu,0x666504b2u,0x6f6e04b3u,0x534304b4u,0x706f04c4u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f04c9u,0x6d6c04c5u,0x706f04c6u,0x737204c7u,0x10004c8u,0x8000004du,0x767504cau,0x686704cbu,0x696804ccu,0x6f6e04cdu,0x666504ceu,0x747304cfu,0x747304d0u,0x10004d1u,0x8000004eu,0x666504d3u,0x10004d4u,0x8000004fu,0x646304dau,0x0u,0x0u,0x0u,0x646304dfu,0x6a6904dbu,0x6f6e04dcu,0x686704ddu,0x10004deu,0x80000050u,0x767504e0u,0x6d6c04e1u,0x626104e2u,0x737204e3u,0x440004e4u,0x80000051u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0528u,0x6d6c0529u,0x706f052au,0x7372052bu,0x100052cu,0x80000052u,0x7574052eu,0x7675052fu,0x74730530u,0x44430531u,0x62610532u,0x6d6c0533u,0x6d6c0534u,0x63620535u,0x62610536u,0x64630537u,0x6c6b0538u,0x56000539u,0x80000053u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7473058fu,0x66650590u,0x73720591u,0x45440592u,0x62610593u,0x75740594u,0x62610595u,0x1000596u,0x80000054u,0x67660598u,0x62610599u,0x6463059au,0x6665059bu,0x100059cu,0x80000055u,0x6a6905a8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626105b0u,0x646305a9u,0x6c6b05aau,0x6f6e05abu,0x666505acu,0x747305adu,0x747305aeu,0x10005afu,0x80000056u,0x6f6e05b1u,0x747305b2u,0x6e6605b3u,0x706f05bbu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6905bfu,0x737205bcu,0x6e6d05bdu,0x10005beu,0x80000057u,0x747305c0u,0x747305c1u,0x6a6905c2u,0x706f05c3u,0x6f6e05c4u,0x10005c5u,0x80000058u,0x10005c7u,0x80000059u,0x737205d3u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0764u,0x757405d4u,0x666505d5u,0x797805d6u,0x2f2e05d7u,0x756105d8u,0x757405ecu,0x0u,0x706106ccu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0715u,0x0u,0x706f074fu,0x0u,0x62610757u,0x0u,0x6261075du,0x757405edu,0x737205eeu,0x6a6905efu,0x636205f0u,0x767505f1u,0x757405f2u,0x666505f3u,0x343005f4u,0x2f0005f8u,0x2f00062du,0x2f000662u,0x2f000697u,0x8000005au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690627u,0x6f6e0628u,0x65640629u,0x6665062au,0x7978062bu,0x100062cu,0x8000005bu,0x8000005cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a69065cu,0x6f6e065du,0x6564065eu,0x6665065fu,0x79780660u,0x1000661u,0x8000005du,0x8000005eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690691u,0x6f6e0692u,0x65640693u,0x66650694u,0x79780695u,0x1000696u,0x8000005fu,0x80000060u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6906c6u,0x6f6e06c7u,0x656406c8u,0x666506c9u,0x797806cau,0x10006cbu,0x80000061u,0x717006dbu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c06ddu,0x10006dcu,0x80000062u,0x706f06deu,0x737206dfu,0x2f0006e0u,0x80000063u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a69070fu,0x6f6e0710u,0x65640711u,0x66650712u,0x79780713u,0x1000714u,0x80000064u,0x73720716u,0x6e6d0717u,0x62610718u,0x6d6c0719u,0x2f00071au,0x80000065u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690749u,0x6f6e074au,0x6564074bu,0x6665074cu,0x7978074du,0x100074eu,0x80000066u,0x74730750u,0x6a690751u,0x75740752u,0x6a690753u,0x706f0754u,0x6f6e0755u,0x1000756u,0x80000067u,0x65640758u,0x6a690759u,0x7675075au,0x7473075bu,0x100075cu,0x80000068u,0x6f6e075eu,0x6867075fu,0x66650760u,0x6f6e0761u,0x75740762u,0x1000763u,0x80000069u,0x76750765u,0x6e6d0766u,0x66650767u,0x1000768u,0x8000006au,0x7372076du,0x0u,0x0u,0x62610771u,0x6d6c076eu,0x6564076fu,0x1000770u,0x8000006bu,0x71700772u,0x4e4d0773u,0x706f0774u,0x65640775u,0x66650776u,0x33310777u,0x1000779u,0x100077au,0x8000006cu,0x8000006du};
+   static const uint32_t table[] = {0x75630017u,0x736100cfu,0x7061017eu,0x6a610261u,0x6e6d0288u,0x70610290u,0x7365030eu,0x66650327u,0x7464032du,0x0u,0x0u,0x7061048du,0x666104feu,0x7061051bu,0x76630535u,0x73690571u,0x0u,0x706105ddu,0x7661064bu,0x73680762u,0x71700814u,0x70610816u,0x736f09c4u,0x64630029u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x71700034u,0x6362004cu,0x0u,0x0u,0x66650087u,0x0u,0x73720094u,0x71700098u,0x7574009du,0x7675002au,0x6e6d002bu,0x7675002cu,0x6d6c002du,0x6261002eu,0x7574002fu,0x6a690030u,0x706f0031u,0x6f6e0032u,0x1000033u,0x80000000u,0x69680035u,0x62610036u,0x4e430037u,0x76750042u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0048u,0x75740043u,0x706f0044u,0x67660045u,0x67660046u,0x1000047u,0x80000001u,0x65640049u,0x6665004au,0x100004bu,0x80000002u,0x6a69004du,0x6665004eu,0x6f6e004fu,0x75740050u,0x54430051u,0x706f0062u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x64630067u,0x0u,0x0u,0x62610078u,0x62610080u,0x6d6c0063u,0x706f0064u,0x73720065u,0x1000066u,0x80000003u,0x64630068u,0x6d6c0069u,0x7675006au,0x7473006bu,0x6a69006cu,0x706f006du,0x6f6e006eu,0x4544006fu,0x6a690070u,0x74730071u,0x75740072u,0x62610073u,0x6f6e0074u,0x64630075u,0x66650076u,0x1000077u,0x80000004u,0x65640079u,0x6a69007au,0x6261007bu,0x6f6e007cu,0x6463007du,0x6665007eu,0x100007fu,0x80000005u,0x6e6d0081u,0x71700082u,0x6d6c0083u,0x66650084u,0x74730085u,0x1000086u,0x80000006u,0x73720088u,0x75740089u,0x7675008au,0x7372008bu,0x6665008cu,0x5352008du,0x6261008eu,0x6564008fu,0x6a690090u,0x76750091u,0x74730092u,0x1000093u,0x80000007u,0x62610095u,0x7a790096u,0x1000097u,0x80000008u,0x66650099u,0x6463009au,0x7574009bu,0x100009cu,0x80000009u,0x7365009eu,0x6f6e00acu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6900c2u,0x767500adu,0x626100aeu,0x757400afu,0x6a6900b0u,0x706f00b1u,0x6f6e00b2u,0x454300b3u,0x706f00b5u,0x6a6900bau,0x6d6c00b6u,0x706f00b7u,0x737200b8u,0x10000b9u,0x8000000au,0x747300bbu,0x757400bcu,0x626100bdu,0x6f6e00beu,0x646300bfu,0x666500c0u,0x10000c1u,0x8000000bu,0x636200c3u,0x767500c4u,0x757400c5u,0x666500c6u,0x343000c7u,0x10000cbu,0x10000ccu,0x10000cdu,0x10000ceu,0x8000000cu,0x8000000du,0x8000000eu,0x8000000fu,0x746300e1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690101u,0x6c6b00f2u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666500fau,0x686700f3u,0x737200f4u,0x706f00f5u,0x767500f6u,0x6f6e00f7u,0x656400f8u,0x10000f9u,0x80000010u,0x444300fbu,0x706f00fcu,0x6d6c00fdu,0x706f00feu,0x737200ffu,0x1000100u,0x80000011u,0x64630102u,0x6c6b0103u,0x54430104u,0x62610115u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a69017au,0x6d6c0116u,0x6d6c0117u,0x63620118u,0x62610119u,0x6463011au,0x6c6b011bu,0x5600011cu,0x80000012u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x74730172u,0x66650173u,0x73720174u,0x45440175u,0x62610176u,0x75740177u,0x62610178u,0x1000179u,0x80000013u,0x7b7a017bu,0x6665017cu,0x100017du,0x80000014u,0x7163018du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666101a8u,0x0u,0x0u,0x0u,0x666501f4u,0x0u,0x0u,0x6d6c025du,0x6968019bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666501a2u,0x0u,0x0u,0x747301a6u,0x6665019cu,0x5453019du,0x6a69019eu,0x7b7a019fu,0x666501a0u,0x10001a1u,0x80000015u,0x737201a3u,0x626101a4u,0x10001a5u,0x80000016u,0x10001a7u,0x80000017u,0x6f6e01adu,0x0u,0x0u,0x0u,0x646301e7u,0x6f6e01aeu,0x666501afu,0x6d6c01b0u,0x2f2e01b1u,0x716301b2u,0x706f01c0u,0x666501c5u,0x0u,0x0u,0x0u,0x0u,0x6f6e01cau,0x0u,0x0u,0x0u,0x0u,0x0u,0x636201d4u,0x737201dcu,0x6d6c01c1u,0x706f01c2u,0x737201c3u,0x10001c4u,0x80000018u,0x717001c6u,0x757401c7u,0x696801c8u,0x10001c9u,0x80000019u,0x747301cbu,0x757401ccu,0x626101cdu,0x6f6e01ceu,0x646301cfu,0x666501d0u,0x4a4901d1u,0x656401d2u,0x10001d3u,0x8000001au,0x6b6a01d5u,0x666501d6u,0x646301d7u,0x757401d8u,0x4a4901d9u,0x656401dau,0x10001dbu,0x8000001bu,0x6a6901ddu,0x6e6d01deu,0x6a6901dfu,0x757401e0u,0x6a6901e1u,0x777601e2u,0x666501e3u,0x4a4901e4u,0x656401e5u,0x10001e6u,0x8000001cu,0x6c6b01e8u,0x666501e9u,0x737201eau,0x636201ebu,0x706f01ecu,0x626101edu,0x737201eeu,0x656401efu,0x6a6901f0u,0x6f6e01f1u,0x686701f2u,0x10001f3u,0x8000001du,0x626101f5u,0x737201f6u,0x646301f7u,0x706f01f8u,0x626101f9u,0x757401fau,0x530001fbu,0x8000001eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f024eu,0x0u,0x0u,0x0u,0x706f0254u,0x7372024fu,0x6e6d0250u,0x62610251u,0x6d6c0252u,0x1000253u,0x8000001fu,0x76750255u,0x68670256u,0x69680257u,0x6f6e0258u,0x66650259u,0x7473025au,0x7473025bu,0x100025cu,0x80000020u,0x706f025eu,0x7372025fu,0x1000260u,0x80000021u,0x7574026au,0x0u,0x0u,0x0u,0x6f6e026du,0x0u,0x0u,0x0u,0x736d0273u,0x6261026bu,0x100026cu,0x80000022u,0x706f026eu,0x6a69026fu,0x74730270u,0x66650271u,0x1000272u,0x80000023u,0x66650279u,0x0u,0x0u,0x0u,0x0u,0x66650281u,0x6f6e027au,0x7473027bu,0x6a69027cu,0x706f027du,0x6f6e027eu,0x7473027fu,0x1000280u,0x80000024u,0x64630282u,0x75740283u,0x6a690284u,0x706f0285u,0x6f6e0286u,0x1000287u,0x80000025u,0x6a690289u,0x7473028au,0x7473028bu,0x6a69028cu,0x7776028du,0x6665028eu,0x100028fu,0x80000026u,0x7372029fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6502a1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x776302e9u,0x10002a0u,0x80000027u,0x6d6c02a9u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x756502acu,0x656402aau,0x10002abu,0x80000028u,0x6f4f02bcu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666502e6u,0x676602dcu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626102e2u,0x676602ddu,0x747302deu,0x666502dfu,0x757402e0u,0x10002e1u,0x80000029u,0x6e6d02e3u,0x666502e4u,0x10002e5u,0x8000002au,0x737202e7u,0x10002e8u,0x8000002bu,0x767502fdu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6e6d0308u,0x0u,0x0u,0x0u,0x7a79030cu,0x747302feu,0x454402ffu,0x6a690300u,0x74730301u,0x75740302u,0x62610303u,0x6f6e0304u,0x64630305u,0x66650306u,0x1000307u,0x8000002cu,0x62610309u,0x7574030au,0x100030bu,0x8000002du,0x100030du,0x8000002eu,0x706f031cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0323u,0x6e6d031du,0x6665031eu,0x7574031fu,0x73720320u,0x7a790321u,0x1000322u,0x8000002fu,0x76750324u,0x71700325u,0x1000326u,0x80000030u,0x6a690328u,0x68670329u,0x6968032au,0x7574032bu,0x100032cu,0x80000031u,0x100033du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261033eu,0x7541039au,0x73720409u,0x0u,0x0u,0x7369040bu,0x706f0486u,0x80000032u,0x6867033fu,0x66650340u,0x53000341u,0x80000033u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x66650394u,0x68670395u,0x6a690396u,0x706f0397u,0x6f6e0398u,0x1000399u,0x80000034u,0x757403ceu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x676603d7u,0x0u,0x0u,0x0u,0x0u,0x737203ddu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x757403e6u,0x666503ecu,0x757403cfu,0x737203d0u,0x6a6903d1u,0x636203d2u,0x767503d3u,0x757403d4u,0x666503d5u,0x10003d6u,0x80000035u,0x676603d8u,0x747303d9u,0x666503dau,0x757403dbu,0x10003dcu,0x80000036u,0x626103deu,0x6f6e03dfu,0x747303e0u,0x676603e1u,0x706f03e2u,0x737203e3u,0x6e6d03e4u,0x10003e5u,0x80000037u,0x626103e7u,0x6f6e03e8u,0x646303e9u,0x666503eau,0x10003ebu,0x80000038u,0x736e03edu,0x747303f2u,0x0u,0x0u,0x0u,0x717003f7u,0x6a6903f3u,0x757403f4u,0x7a7903f5u,0x10003f6u,0x80000039u,0x767503f8u,0x717003f9u,0x6a6903fau,0x6d6c03fbu,0x6d6c03fcu,0x626103fdu,0x737203feu,0x7a7903ffu,0x45440400u,0x6a690401u,0x74730402u,0x75740403u,0x62610404u,0x6f6e0405u,0x64630406u,0x66650407u,0x1000408u,0x8000003au,0x100040au,0x8000003bu,0x65640415u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261047eu,0x66650416u,0x74730417u,0x64630418u,0x66650419u,0x6f6e041au,0x6463041bu,0x6665041cu,0x5500041du,0x8000003cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0472u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x69680475u,0x73720473u,0x1000474u,0x8000003du,0x6a690476u,0x64630477u,0x6c6b0478u,0x6f6e0479u,0x6665047au,0x7473047bu,0x7473047cu,0x100047du,0x8000003eu,0x6564047fu,0x6a690480u,0x62610481u,0x6f6e0482u,0x64630483u,0x66650484u,0x1000485u,0x8000003fu,0x77760487u,0x62610488u,0x6d6c0489u,0x7675048au,0x6665048bu,0x100048cu,0x80000040u,0x7a79049cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x686704a1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626104f2u,0x706f049du,0x7675049eu,0x7574049fu,0x10004a0u,0x80000041u,0x696804a2u,0x757404a3u,0x470004a4u,0x80000042u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626104ebu,0x6d6c04ecu,0x6d6c04edu,0x706f04eeu,0x676604efu,0x676604f0u,0x10004f1u,0x80000043u,0x656404f3u,0x747304f4u,0x515004f5u,0x666504f6u,0x737204f7u,0x474604f8u,0x737204f9u,0x626104fau,0x6e6d04fbu,0x666504fcu,0x10004fdu,0x80000044u,0x75740503u,0x0u,0x0u,0x0u,0x7574050au,0x66650504u,0x73720505u,0x6a690506u,0x62610507u,0x6d6c0508u,0x1000509u,0x80000045u,0x6961050bu,0x6d6c0513u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0518u,0x6d6c0514u,0x6a690515u,0x64630516u,0x1000517u,0x80000046u,0x65640519u,0x100051au,0x80000047u,0x6e6d052au,0x0u,0x0u,0x0u,0x6261052du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720530u,0x6665052bu,0x100052cu,0x80000048u,0x7372052eu,0x100052fu,0x80000049u,0x6e6d0531u,0x62610532u,0x6d6c0533u,0x1000534u,0x8000004au,0x64630548u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610550u,0x0u,0x6a690556u,0x0u,0x0u,0x7574055bu,0x6d6c0549u,0x7675054au,0x7473054bu,0x6a69054cu,0x706f054du,0x6f6e054eu,0x100054fu,0x8000004bu,0x64630551u,0x6a690552u,0x75740553u,0x7a790554u,0x1000555u,0x8000004cu,0x68670557u,0x6a690558u,0x6f6e0559u,0x100055au,0x8000004du,0x554f055cu,0x67660562u,0x0u,0x0u,0x0u,0x0u,0x73720568u,0x67660563u,0x74730564u,0x66650565u,0x75740566u,0x1000567u,0x8000004eu,0x62610569u,0x6f6e056au,0x7473056bu,0x6766056cu,0x706f056du,0x7372056eu,0x6e6d056fu,0x1000570u,0x8000004fu,0x7978057bu,0x0u,0x0u,0x62610586u,0x0u,0x0u,0x7873058au,0x0u,0x0u,0x6a690598u,0x6665057cu,0x6d6c057du,0x5453057eu,0x6261057fu,0x6e6d0580u,0x71700581u,0x6d6c0582u,0x66650583u,0x74730584u,0x1000585u,0x80000050u,0x6f6e0587u,0x66650588u,0x1000589u,0x80000051u,0x6a69058fu,0x0u,0x0u,0x0u,0x66650595u,0x75740590u,0x6a690591u,0x706f0592u,0x6f6e0593u,0x1000594u,0x80000052u,0x73720596u,0x1000597u,0x80000053u,0x6e6d0599u,0x6a69059au,0x7574059bu,0x6a69059cu,0x7776059du,0x6665059eu,0x2f2e059fu,0x736105a0u,0x757405b2u,0x0u,0x706f05c2u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f6405c7u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626105d7u,0x757405b3u,0x737205b4u,0x6a6905b5u,0x636205b6u,0x767505b7u,0x757405b8u,0x666505b9u,0x343005bau,0x10005beu,0x10005bfu,0x10005c0u,0x10005c1u,0x80000054u,0x80000055u,0x80000056u,0x80000057u,0x6d6c05c3u,0x706f05c4u,0x737205c5u,0x10005c6u,0x80000058u,0x10005d2u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x656405d3u,0x80000059u,0x666505d4u,0x797805d5u,0x10005d6u,0x8000005au,0x656405d8u,0x6a6905d9u,0x767505dau,0x747305dbu,0x10005dcu,0x8000005bu,0x7a6405ecu,0x0u,0x0u,0x0u,0x6f670631u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x76750643u,0x6a690602u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x52510606u,0x76750603u,0x74730604u,0x1000605u,0x8000005cu,0x76750607u,0x66650608u,0x73720609u,0x7a79060au,0x2f2e060bu,0x7361060cu,0x6f6e061eu,0x0u,0x706f0624u,0x0u,0x0u,0x0u,0x0u,0x6a690629u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261062du,0x7a79061fu,0x49480620u,0x6a690621u,0x75740622u,0x1000623u,0x8000005du,0x76750625u,0x6f6e0626u,0x75740627u,0x1000628u,0x8000005eu,0x7574062au,0x7473062bu,0x100062cu,0x8000005fu,0x7a79062eu,0x7473062fu,0x1000630u,0x80000060u,0x6a690639u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6564063du,0x706f063au,0x6f6e063bu,0x100063cu,0x80000061u,0x6665063eu,0x7372063fu,0x66650640u,0x73720641u,0x1000642u,0x80000062u,0x68670644u,0x69680645u,0x6f6e0646u,0x66650647u,0x74730648u,0x74730649u,0x100064au,0x80000063u,0x6e6d0660u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6665066au,0x7b7a068bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6661068eu,0x0u,0x0u,0x0u,0x666106e6u,0x7372075cu,0x71700661u,0x6d6c0662u,0x66650663u,0x4d4c0664u,0x6a690665u,0x6e6d0666u,0x6a690667u,0x75740668u,0x1000669u,0x80000064u,0x6665066bu,0x6f6e066cu,0x5343066du,0x706f067du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0682u,0x6d6c067eu,0x706f067fu,0x73720680u,0x1000681u,0x80000065u,0x76750683u,0x68670684u,0x69680685u,0x6f6e0686u,0x66650687u,0x74730688u,0x74730689u,0x100068au,0x80000066u,0x6665068cu,0x100068du,0x80000067u,0x64630693u,0x0u,0x0u,0x0u,0x64630698u,0x6a690694u,0x6f6e0695u,0x68670696u,0x1000697u,0x80000068u,0x76750699u,0x6d6c069au,0x6261069bu,0x7372069cu,0x4400069du,0x80000069u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f06e1u,0x6d6c06e2u,0x706f06e3u,0x737206e4u,0x10006e5u,0x8000006au,0x757406ebu,0x0u,0x0u,0x0u,0x73720754u,0x767506ecu,0x747306edu,0x444306eeu,0x626106efu,0x6d6c06f0u,0x6d6c06f1u,0x636206f2u,0x626106f3u,0x646306f4u,0x6c6b06f5u,0x560006f6u,0x8000006bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7473074cu,0x6665074du,0x7372074eu,0x4544074fu,0x62610750u,0x75740751u,0x62610752u,0x1000753u,0x8000006cu,0x66650755u,0x706f0756u,0x4e4d0757u,0x706f0758u,0x65640759u,0x6665075au,0x100075bu,0x8000006du,0x6766075du,0x6261075eu,0x6463075fu,0x66650760u,0x1000761u,0x8000006eu,0x6a69076du,0x6e6d0775u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626107feu,0x6463076eu,0x6c6b076fu,0x6f6e0770u,0x66650771u,0x74730772u,0x74730773u,0x1000774u,0x8000006fu,0x66650776u,0x74730777u,0x75740778u,0x66650779u,0x7170077au,0x7400077bu,0x80000070u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f07efu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c07f8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x10007fdu,0x706f07f0u,0x6c6b07f1u,0x626107f2u,0x696807f3u,0x666507f4u,0x626107f5u,0x656407f6u,0x10007f7u,0x80000071u,0x706f07f9u,0x757407fau,0x747307fbu,0x10007fcu,0x80000072u,0x80000073u,0x6f6e07ffu,0x74730800u,0x6e660801u,0x706f0809u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a69080du,0x7372080au,0x6e6d080bu,0x100080cu,0x80000074u,0x7473080eu,0x7473080fu,0x6a690810u,0x706f0811u,0x6f6e0812u,0x1000813u,0x80000075u,0x1000815u,0x80000076u,0x6d6c0825u,0x0u,0x0u,0x0u,0x7372082eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c09bfu,0x76750826u,0x66650827u,0x53520828u,0x62610829u,0x6f6e082au,0x6867082bu,0x6665082cu,0x100082du,0x80000077u,0x7574082fu,0x66650830u,0x79780831u,0x2f2e0832u,0x75610833u,0x75740847u,0x0u,0x70610927u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0970u,0x0u,0x706f09aau,0x0u,0x626109b2u,0x0u,0x626109b8u,0x75740848u,0x73720849u,0x6a69084au,0x6362084bu,0x7675084cu,0x7574084du,0x6665084eu,0x3430084fu,0x2f000853u,0x2f000888u,0x2f0008bdu,0x2f0008f2u,0x80000078u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690882u,0x6f6e0883u,0x65640884u,0x66650885u,0x79780886u,0x1000887u,0x80000079u,0x8000007au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6908b7u,0x6f6e08b8u,0x656408b9u,0x666508bau,0x797808bbu,0x10008bcu,0x8000007bu,0x8000007cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6908ecu,0x6f6e08edu,0x656408eeu,0x666508efu,0x797808f0u,0x10008f1u,0x8000007du,0x8000007eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690921u,0x6f6e0922u,0x65640923u,0x66650924u,0x79780925u,0x1000926u,0x8000007fu,0x71700936u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0938u,0x1000937u,0x80000080u,0x706f0939u,0x7372093au,0x2f00093bu,0x80000081u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a69096au,0x6f6e096bu,0x6564096cu,0x6665096du,0x7978096eu,0x100096fu,0x80000082u,0x73720971u,0x6e6d0972u,0x62610973u,0x6d6c0974u,0x2f000975u,0x80000083u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6909a4u,0x6f6e09a5u,0x656409a6u,0x666509a7u,0x797809a8u,0x10009a9u,0x80000084u,0x747309abu,0x6a6909acu,0x757409adu,0x6a6909aeu,0x706f09afu,0x6f6e09b0u,0x10009b1u,0x80000085u,0x656409b3u,0x6a6909b4u,0x767509b5u,0x747309b6u,0x10009b7u,0x80000086u,0x6f6e09b9u,0x686709bau,0x666509bbu,0x6f6e09bcu,0x757409bdu,0x10009beu,0x80000087u,0x767509c0u,0x6e6d09c1u,0x666509c2u,0x10009c3u,0x80000088u,0x737209c8u,0x0u,0x0u,0x626109ccu,0x6d6c09c9u,0x656409cau,0x10009cbu,0x80000089u,0x717009cdu,0x4e4d09ceu,0x706f09cfu,0x656409d0u,0x666509d1u,0x333109d2u,0x10009d4u,0x10009d5u,0x8000008au,0x8000008bu};
    uint32_t cur = 0x78610000u;
    for(int i = 0;cur!=0;++i) {
       uint32_t idx = cur&0xFFFFu;
@@ -79,8 +79,11 @@ static const int32_t anari_false = 0;
 const char ** query_extensions() {
    static const char *extensions[] = {
       "ANARI_KHR_ARRAY1D_REGION",
+      "ANARI_KHR_CAMERA_DEPTH_OF_FIELD",
+      "ANARI_KHR_CAMERA_OMNIDIRECTIONAL",
       "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
       "ANARI_KHR_CAMERA_PERSPECTIVE",
+      "ANARI_KHR_CAMERA_STEREO",
       "ANARI_KHR_DEVICE_SYNCHRONIZATION",
       "ANARI_KHR_FRAME_ACCUMULATION",
       "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
@@ -103,6 +106,12 @@ const char ** query_extensions() {
       "ANARI_KHR_SAMPLER_TRANSFORM",
       "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
       "ANARI_VISRTX_CUDA_OUTPUT_BUFFERS",
+      "ANARI_VISRTX_GEOMETRY_ISOSURFACE",
+      "ANARI_VISRTX_GEOMETRY_SLICE",
+      "ANARI_VISRTX_INSTANCE_TRANSFORM_ARRAY",
+      "ANARI_VISRTX_RAY_QUERY",
+      "ANARI_VISRTX_SPATIAL_FIELD_STREAMED_REGULAR",
+      "ANARI_VISRTX_TIME_SERIES",
       0
    };
    return extensions;
@@ -116,7 +125,7 @@ const char ** query_object_types(ANARIDataType type) {
       }
       case ANARI_CAMERA:
       {
-         static const char *ANARI_CAMERA_subtypes[] = {"orthographic", "perspective", 0};
+         static const char *ANARI_CAMERA_subtypes[] = {"orthographic", "perspective", "omnidirectional", 0};
          return ANARI_CAMERA_subtypes;
       }
       case ANARI_VOLUME:
@@ -131,7 +140,7 @@ const char ** query_object_types(ANARIDataType type) {
       }
       case ANARI_GEOMETRY:
       {
-         static const char *ANARI_GEOMETRY_subtypes[] = {"cone", "curve", "cylinder", "quad", "sphere", "triangle", 0};
+         static const char *ANARI_GEOMETRY_subtypes[] = {"cone", "curve", "cylinder", "quad", "sphere", "triangle", "isosurface", "slice", 0};
          return ANARI_GEOMETRY_subtypes;
       }
       case ANARI_LIGHT:
@@ -151,7 +160,7 @@ const char ** query_object_types(ANARIDataType type) {
       }
       case ANARI_SPATIAL_FIELD:
       {
-         static const char *ANARI_SPATIAL_FIELD_subtypes[] = {"structuredRegular", 0};
+         static const char *ANARI_SPATIAL_FIELD_subtypes[] = {"structuredRegular", "streamedRegular", 0};
          return ANARI_SPATIAL_FIELD_subtypes;
       }
       default:
@@ -469,15 +478,15 @@ static const void * ANARI_RENDERER_default_name_info(ANARIDataType paramType, in
 }
 static const void * ANARI_RENDERER_default_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 11:
+      case 16:
          return ANARI_RENDERER_default_background_info(paramType, infoName, infoType);
-      case 76:
+      case 100:
          return ANARI_RENDERER_default_sampleLimit_info(paramType, infoName, infoType);
-      case 26:
+      case 35:
          return ANARI_RENDERER_default_denoise_info(paramType, infoName, infoType);
-      case 20:
+      case 29:
          return ANARI_RENDERER_default_checkerboarding_info(paramType, infoName, infoType);
-      case 61:
+      case 80:
          return ANARI_RENDERER_default_pixelSamples_info(paramType, infoName, infoType);
       case 6:
          return ANARI_RENDERER_default_ambientSamples_info(paramType, infoName, infoType);
@@ -487,9 +496,9 @@ static const void * ANARI_RENDERER_default_param_info(const char *paramName, ANA
          return ANARI_RENDERER_default_ambientRadiance_info(paramType, infoName, infoType);
       case 4:
          return ANARI_RENDERER_default_ambientOcclusionDistance_info(paramType, infoName, infoType);
-      case 49:
+      case 67:
          return ANARI_RENDERER_default_lightFalloff_info(paramType, infoName, infoType);
-      case 53:
+      case 72:
          return ANARI_RENDERER_default_name_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -786,15 +795,15 @@ static const void * ANARI_RENDERER_scivis_lightFalloff_info(ANARIDataType paramT
 }
 static const void * ANARI_RENDERER_scivis_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 11:
+      case 16:
          return ANARI_RENDERER_scivis_background_info(paramType, infoName, infoType);
-      case 76:
+      case 100:
          return ANARI_RENDERER_scivis_sampleLimit_info(paramType, infoName, infoType);
-      case 26:
+      case 35:
          return ANARI_RENDERER_scivis_denoise_info(paramType, infoName, infoType);
-      case 20:
+      case 29:
          return ANARI_RENDERER_scivis_checkerboarding_info(paramType, infoName, infoType);
-      case 61:
+      case 80:
          return ANARI_RENDERER_scivis_pixelSamples_info(paramType, infoName, infoType);
       case 6:
          return ANARI_RENDERER_scivis_ambientSamples_info(paramType, infoName, infoType);
@@ -804,7 +813,7 @@ static const void * ANARI_RENDERER_scivis_param_info(const char *paramName, ANAR
          return ANARI_RENDERER_scivis_ambientRadiance_info(paramType, infoName, infoType);
       case 4:
          return ANARI_RENDERER_scivis_ambientOcclusionDistance_info(paramType, infoName, infoType);
-      case 49:
+      case 67:
          return ANARI_RENDERER_scivis_lightFalloff_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -1063,15 +1072,15 @@ static const void * ANARI_RENDERER_ao_ambientOcclusionDistance_info(ANARIDataTyp
 }
 static const void * ANARI_RENDERER_ao_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 11:
+      case 16:
          return ANARI_RENDERER_ao_background_info(paramType, infoName, infoType);
-      case 76:
+      case 100:
          return ANARI_RENDERER_ao_sampleLimit_info(paramType, infoName, infoType);
-      case 26:
+      case 35:
          return ANARI_RENDERER_ao_denoise_info(paramType, infoName, infoType);
-      case 20:
+      case 29:
          return ANARI_RENDERER_ao_checkerboarding_info(paramType, infoName, infoType);
-      case 61:
+      case 80:
          return ANARI_RENDERER_ao_pixelSamples_info(paramType, infoName, infoType);
       case 6:
          return ANARI_RENDERER_ao_ambientSamples_info(paramType, infoName, infoType);
@@ -1221,13 +1230,13 @@ static const void * ANARI_RENDERER_dpt_ambientRadiance_info(ANARIDataType paramT
 }
 static const void * ANARI_RENDERER_dpt_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 76:
+      case 100:
          return ANARI_RENDERER_dpt_sampleLimit_info(paramType, infoName, infoType);
-      case 26:
+      case 35:
          return ANARI_RENDERER_dpt_denoise_info(paramType, infoName, infoType);
-      case 20:
+      case 29:
          return ANARI_RENDERER_dpt_checkerboarding_info(paramType, infoName, infoType);
-      case 61:
+      case 80:
          return ANARI_RENDERER_dpt_pixelSamples_info(paramType, infoName, infoType);
       case 5:
          return ANARI_RENDERER_dpt_ambientRadiance_info(paramType, infoName, infoType);
@@ -1378,15 +1387,15 @@ static const void * ANARI_RENDERER_raycast_pixelSamples_info(ANARIDataType param
 }
 static const void * ANARI_RENDERER_raycast_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 11:
+      case 16:
          return ANARI_RENDERER_raycast_background_info(paramType, infoName, infoType);
-      case 76:
+      case 100:
          return ANARI_RENDERER_raycast_sampleLimit_info(paramType, infoName, infoType);
-      case 26:
+      case 35:
          return ANARI_RENDERER_raycast_denoise_info(paramType, infoName, infoType);
-      case 20:
+      case 29:
          return ANARI_RENDERER_raycast_checkerboarding_info(paramType, infoName, infoType);
-      case 61:
+      case 80:
          return ANARI_RENDERER_raycast_pixelSamples_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -1556,7 +1565,7 @@ static const void * ANARI_RENDERER_debug_method_info(ANARIDataType paramType, in
          }
       case 6: // value
          if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"primID", "geomID", "instID", "Ng", "Ng.abs", "Ns", "Ns.abs", "uvw", "backface", "istri", "isvol", "hasMaterial", "geometry.attribute0", "geometry.attribute1", "geometry.attribute2", "geometry.attribute3", "geometry.color", nullptr};
+            static const char *values[] = {"primID", "geomID", "instID", "Ng", "Ng.abs", "Ns", "Ns.abs", "uvw", "backface", "istri", "isvol", "hasMaterial", "geometry.attribute0", "geometry.attribute1", "geometry.attribute2", "geometry.attribute3", "geometry.color", "cost.clocks", "cost.anyHits", "cost.intersections", "cost.volumeSamples", nullptr};
             return values;
          } else {
             return nullptr;
@@ -1566,17 +1575,17 @@ static const void * ANARI_RENDERER_debug_method_info(ANARIDataType paramType, in
 }
 static const void * ANARI_RENDERER_debug_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 11:
+      case 16:
          return ANARI_RENDERER_debug_background_info(paramType, infoName, infoType);
-      case 76:
+      case 100:
          return ANARI_RENDERER_debug_sampleLimit_info(paramType, infoName, infoType);
-      case 26:
+      case 35:
          return ANARI_RENDERER_debug_denoise_info(paramType, infoName, infoType);
-      case 20:
+      case 29:
          return ANARI_RENDERER_debug_checkerboarding_info(paramType, infoName, infoType);
-      case 61:
+      case 80:
          return ANARI_RENDERER_debug_pixelSamples_info(paramType, infoName, infoType);
-      case 52:
+      case 71:
          return ANARI_RENDERER_debug_method_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -1635,11 +1644,11 @@ static const void * ANARI_DEVICE_statusCallbackUserData_info(ANARIDataType param
 }
 static const void * ANARI_DEVICE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_DEVICE_name_info(paramType, infoName, infoType);
-      case 83:
+      case 107:
          return ANARI_DEVICE_statusCallback_info(paramType, infoName, infoType);
-      case 84:
+      case 108:
          return ANARI_DEVICE_statusCallbackUserData_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -1689,9 +1698,9 @@ static const void * ANARI_ARRAY1D_region_info(ANARIDataType paramType, int infoN
 }
 static const void * ANARI_ARRAY1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_ARRAY1D_name_info(paramType, infoName, infoType);
-      case 73:
+      case 97:
          return ANARI_ARRAY1D_region_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -1716,7 +1725,7 @@ static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoNam
 }
 static const void * ANARI_ARRAY2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_ARRAY2D_name_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -1741,7 +1750,7 @@ static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoNam
 }
 static const void * ANARI_ARRAY3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_ARRAY3D_name_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -1899,7 +1908,7 @@ static const void * ANARI_FRAME_accumulation_info(ANARIDataType paramType, int i
             static const char *extension = "KHR_FRAME_ACCUMULATION";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 7;
             return &value;
          }
       default: return nullptr;
@@ -1931,7 +1940,7 @@ static const void * ANARI_FRAME_channel_primitiveId_info(ANARIDataType paramType
             static const char *extension = "KHR_FRAME_CHANNEL_PRIMITIVE_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 8;
             return &value;
          }
       default: return nullptr;
@@ -1963,7 +1972,7 @@ static const void * ANARI_FRAME_channel_objectId_info(ANARIDataType paramType, i
             static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
@@ -1995,7 +2004,7 @@ static const void * ANARI_FRAME_channel_instanceId_info(ANARIDataType paramType,
             static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -2003,27 +2012,27 @@ static const void * ANARI_FRAME_channel_instanceId_info(ANARIDataType paramType,
 }
 static const void * ANARI_FRAME_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_FRAME_name_info(paramType, infoName, infoType);
-      case 107:
+      case 137:
          return ANARI_FRAME_world_info(paramType, infoName, infoType);
-      case 74:
+      case 98:
          return ANARI_FRAME_renderer_info(paramType, infoName, infoType);
-      case 13:
+      case 22:
          return ANARI_FRAME_camera_info(paramType, infoName, infoType);
-      case 79:
+      case 103:
          return ANARI_FRAME_size_info(paramType, infoName, infoType);
-      case 15:
+      case 24:
          return ANARI_FRAME_channel_color_info(paramType, infoName, infoType);
-      case 16:
+      case 25:
          return ANARI_FRAME_channel_depth_info(paramType, infoName, infoType);
       case 0:
          return ANARI_FRAME_accumulation_info(paramType, infoName, infoType);
-      case 19:
+      case 28:
          return ANARI_FRAME_channel_primitiveId_info(paramType, infoName, infoType);
-      case 18:
+      case 27:
          return ANARI_FRAME_channel_objectId_info(paramType, infoName, infoType);
-      case 17:
+      case 26:
          return ANARI_FRAME_channel_instanceId_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -2120,13 +2129,13 @@ static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName
 }
 static const void * ANARI_GROUP_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_GROUP_name_info(paramType, infoName, infoType);
-      case 85:
+      case 110:
          return ANARI_GROUP_surface_info(paramType, infoName, infoType);
-      case 106:
+      case 136:
          return ANARI_GROUP_volume_info(paramType, infoName, infoType);
-      case 48:
+      case 66:
          return ANARI_GROUP_light_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -2245,18 +2254,140 @@ static const void * ANARI_WORLD_light_info(ANARIDataType paramType, int infoName
       default: return nullptr;
    }
 }
+static const void * ANARI_WORLD_rayQuery_rays_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "host or device pointer to the VisRTXRay array to trace";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_RAY_QUERY";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 31;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_WORLD_rayQuery_hits_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "host or device pointer to the VisRTXRayHit results";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_RAY_QUERY";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 31;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_WORLD_rayQuery_count_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "number of rays to trace";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_RAY_QUERY";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 31;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_WORLD_rayQuery_anyHit_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "stop rays at the first hit found instead of the closest";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_RAY_QUERY";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 31;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_WORLD_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_WORLD_name_info(paramType, infoName, infoType);
-      case 41:
+      case 56:
          return ANARI_WORLD_instance_info(paramType, infoName, infoType);
-      case 85:
+      case 110:
          return ANARI_WORLD_surface_info(paramType, infoName, infoType);
-      case 106:
+      case 136:
          return ANARI_WORLD_volume_info(paramType, infoName, infoType);
-      case 48:
+      case 66:
          return ANARI_WORLD_light_info(paramType, infoName, infoType);
+      case 96:
+         return ANARI_WORLD_rayQuery_rays_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_WORLD_rayQuery_hits_info(paramType, infoName, infoType);
+      case 94:
+         return ANARI_WORLD_rayQuery_count_info(paramType, infoName, infoType);
+      case 93:
+         return ANARI_WORLD_rayQuery_anyHit_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -2331,7 +2462,7 @@ static const void * ANARI_SURFACE_id_info(ANARIDataType paramType, int infoName,
             static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
@@ -2339,13 +2470,13 @@ static const void * ANARI_SURFACE_id_info(ANARIDataType paramType, int infoName,
 }
 static const void * ANARI_SURFACE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_SURFACE_name_info(paramType, infoName, infoType);
-      case 32:
+      case 47:
          return ANARI_SURFACE_geometry_info(paramType, infoName, infoType);
-      case 50:
+      case 69:
          return ANARI_SURFACE_material_info(paramType, infoName, infoType);
-      case 35:
+      case 50:
          return ANARI_SURFACE_id_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -2370,7 +2501,7 @@ static const void * ANARI_CAMERA_orthographic_name_info(ANARIDataType paramType,
             static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2408,7 +2539,7 @@ static const void * ANARI_CAMERA_orthographic_position_info(ANARIDataType paramT
             static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2446,7 +2577,7 @@ static const void * ANARI_CAMERA_orthographic_direction_info(ANARIDataType param
             static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2484,7 +2615,7 @@ static const void * ANARI_CAMERA_orthographic_up_info(ANARIDataType paramType, i
             static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2516,7 +2647,7 @@ static const void * ANARI_CAMERA_orthographic_imageRegion_info(ANARIDataType par
             static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2548,7 +2679,7 @@ static const void * ANARI_CAMERA_orthographic_aspect_info(ANARIDataType paramTyp
             static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2580,7 +2711,7 @@ static const void * ANARI_CAMERA_orthographic_height_info(ANARIDataType paramTyp
             static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2605,7 +2736,7 @@ static const void * ANARI_CAMERA_orthographic_near_info(ANARIDataType paramType,
             static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
@@ -2630,32 +2761,189 @@ static const void * ANARI_CAMERA_orthographic_far_info(ANARIDataType paramType,
             static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 3;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 53:
-         return ANARI_CAMERA_orthographic_name_info(paramType, infoName, infoType);
-      case 62:
-         return ANARI_CAMERA_orthographic_position_info(paramType, infoName, infoType);
-      case 27:
-         return ANARI_CAMERA_orthographic_direction_info(paramType, infoName, infoType);
-      case 89:
-         return ANARI_CAMERA_orthographic_up_info(paramType, infoName, infoType);
-      case 37:
-         return ANARI_CAMERA_orthographic_imageRegion_info(paramType, infoName, infoType);
-      case 8:
-         return ANARI_CAMERA_orthographic_aspect_info(paramType, infoName, infoType);
-      case 34:
-         return ANARI_CAMERA_orthographic_height_info(paramType, infoName, infoType);
-      case 54:
+static const void * ANARI_CAMERA_orthographic_apertureRadius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "size of the aperture, controls the depth of field";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_DEPTH_OF_FIELD";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_focusDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "distance at where the image is sharpest when depth of field is enabled";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_DEPTH_OF_FIELD";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 1;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_stereoMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "none";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "stereo mode";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"none", "left", "right", "sideBySide", "topBottom", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_STEREO";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_interpupillaryDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.063500f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "distance between left and right eye when stereo is enabled";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_STEREO";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 72:
+         return ANARI_CAMERA_orthographic_name_info(paramType, infoName, infoType);
+      case 82:
+         return ANARI_CAMERA_orthographic_position_info(paramType, infoName, infoType);
+      case 37:
+         return ANARI_CAMERA_orthographic_direction_info(paramType, infoName, infoType);
+      case 118:
+         return ANARI_CAMERA_orthographic_up_info(paramType, infoName, infoType);
+      case 52:
+         return ANARI_CAMERA_orthographic_imageRegion_info(paramType, infoName, infoType);
+      case 9:
+         return ANARI_CAMERA_orthographic_aspect_info(paramType, infoName, infoType);
+      case 49:
+         return ANARI_CAMERA_orthographic_height_info(paramType, infoName, infoType);
+      case 73:
          return ANARI_CAMERA_orthographic_near_info(paramType, infoName, infoType);
-      case 29:
+      case 39:
          return ANARI_CAMERA_orthographic_far_info(paramType, infoName, infoType);
+      case 7:
+         return ANARI_CAMERA_orthographic_apertureRadius_info(paramType, infoName, infoType);
+      case 44:
+         return ANARI_CAMERA_orthographic_focusDistance_info(paramType, infoName, infoType);
+      case 109:
+         return ANARI_CAMERA_orthographic_stereoMode_info(paramType, infoName, infoType);
+      case 58:
+         return ANARI_CAMERA_orthographic_interpupillaryDistance_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -2679,7 +2967,7 @@ static const void * ANARI_CAMERA_perspective_name_info(ANARIDataType paramType,
             static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2717,7 +3005,7 @@ static const void * ANARI_CAMERA_perspective_position_info(ANARIDataType paramTy
             static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2755,7 +3043,7 @@ static const void * ANARI_CAMERA_perspective_direction_info(ANARIDataType paramT
             static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2793,7 +3081,7 @@ static const void * ANARI_CAMERA_perspective_up_info(ANARIDataType paramType, in
             static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2825,7 +3113,7 @@ static const void * ANARI_CAMERA_perspective_imageRegion_info(ANARIDataType para
             static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2857,7 +3145,7 @@ static const void * ANARI_CAMERA_perspective_fovy_info(ANARIDataType paramType,
             static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2889,7 +3177,7 @@ static const void * ANARI_CAMERA_perspective_aspect_info(ANARIDataType paramType
             static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2914,7 +3202,7 @@ static const void * ANARI_CAMERA_perspective_near_info(ANARIDataType paramType,
             static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
@@ -2939,37 +3227,13 @@ static const void * ANARI_CAMERA_perspective_far_info(ANARIDataType paramType, i
             static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 53:
-         return ANARI_CAMERA_perspective_name_info(paramType, infoName, infoType);
-      case 62:
-         return ANARI_CAMERA_perspective_position_info(paramType, infoName, infoType);
-      case 27:
-         return ANARI_CAMERA_perspective_direction_info(paramType, infoName, infoType);
-      case 89:
-         return ANARI_CAMERA_perspective_up_info(paramType, infoName, infoType);
-      case 37:
-         return ANARI_CAMERA_perspective_imageRegion_info(paramType, infoName, infoType);
-      case 31:
-         return ANARI_CAMERA_perspective_fovy_info(paramType, infoName, infoType);
-      case 8:
-         return ANARI_CAMERA_perspective_aspect_info(paramType, infoName, infoType);
-      case 54:
-         return ANARI_CAMERA_perspective_near_info(paramType, infoName, infoType);
-      case 29:
-         return ANARI_CAMERA_perspective_far_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_VOLUME__id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_perspective_apertureRadius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2978,31 +3242,37 @@ static const void * ANARI_VOLUME__id_info(ANARIDataType paramType, int infoName,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "user id for objectId channel";
+            static const char *description = "size of the aperture, controls the depth of field";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
+            static const char *extension = "KHR_CAMERA_DEPTH_OF_FIELD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME__param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 35:
-         return ANARI_VOLUME__id_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_INSTANCE__id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_perspective_focusDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3011,31 +3281,37 @@ static const void * ANARI_INSTANCE__id_info(ANARIDataType paramType, int infoNam
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "user id for instanceId channel";
+            static const char *description = "distance at where the image is sharpest when depth of field is enabled";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
+            static const char *extension = "KHR_CAMERA_DEPTH_OF_FIELD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 1;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE__param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 35:
-         return ANARI_INSTANCE__id_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_GEOMETRY_cone_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_perspective_stereoMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3044,8 +3320,177 @@ static const void * ANARI_GEOMETRY_cone_name_info(ANARIDataType paramType, int i
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "none";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "stereo mode";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"none", "left", "right", "sideBySide", "topBottom", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_STEREO";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_interpupillaryDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.063500f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "distance between left and right eye when stereo is enabled";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_STEREO";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 72:
+         return ANARI_CAMERA_perspective_name_info(paramType, infoName, infoType);
+      case 82:
+         return ANARI_CAMERA_perspective_position_info(paramType, infoName, infoType);
+      case 37:
+         return ANARI_CAMERA_perspective_direction_info(paramType, infoName, infoType);
+      case 118:
+         return ANARI_CAMERA_perspective_up_info(paramType, infoName, infoType);
+      case 52:
+         return ANARI_CAMERA_perspective_imageRegion_info(paramType, infoName, infoType);
+      case 46:
+         return ANARI_CAMERA_perspective_fovy_info(paramType, infoName, infoType);
+      case 9:
+         return ANARI_CAMERA_perspective_aspect_info(paramType, infoName, infoType);
+      case 73:
+         return ANARI_CAMERA_perspective_near_info(paramType, infoName, infoType);
+      case 39:
+         return ANARI_CAMERA_perspective_far_info(paramType, infoName, infoType);
+      case 7:
+         return ANARI_CAMERA_perspective_apertureRadius_info(paramType, infoName, infoType);
+      case 44:
+         return ANARI_CAMERA_perspective_focusDistance_info(paramType, infoName, infoType);
+      case 109:
+         return ANARI_CAMERA_perspective_stereoMode_info(paramType, infoName, infoType);
+      case 58:
+         return ANARI_CAMERA_perspective_interpupillaryDistance_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_VOLUME__id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "user id for objectId channel";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 9;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_VOLUME__param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 50:
+         return ANARI_VOLUME__id_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE__id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "user id for instanceId channel";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 10;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE__param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 50:
+         return ANARI_INSTANCE__id_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_cone_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
             static const char *description = "optional object name";
             return description;
          }
@@ -3054,7 +3499,7 @@ static const void * ANARI_GEOMETRY_cone_name_info(ANARIDataType paramType, int i
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3086,7 +3531,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_color_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3118,7 +3563,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute0_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3150,7 +3595,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute1_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3182,7 +3627,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute2_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3214,7 +3659,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute3_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3246,7 +3691,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_id_info(ANARIDataType paramTyp
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3278,7 +3723,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_position_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3310,7 +3755,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_radius_info(ANARIDataType paramTy
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3342,7 +3787,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_cap_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3374,7 +3819,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_color_info(ANARIDataType paramTyp
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3406,7 +3851,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute0_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3438,7 +3883,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute1_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3470,7 +3915,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute2_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3502,7 +3947,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute3_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3534,7 +3979,7 @@ static const void * ANARI_GEOMETRY_cone_primitive_index_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3573,7 +4018,7 @@ static const void * ANARI_GEOMETRY_cone_caps_info(ANARIDataType paramType, int i
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -3581,39 +4026,39 @@ static const void * ANARI_GEOMETRY_cone_caps_info(ANARIDataType paramType, int i
 }
 static const void * ANARI_GEOMETRY_cone_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_GEOMETRY_cone_name_info(paramType, infoName, infoType);
-      case 68:
+      case 88:
          return ANARI_GEOMETRY_cone_primitive_color_info(paramType, infoName, infoType);
-      case 64:
+      case 84:
          return ANARI_GEOMETRY_cone_primitive_attribute0_info(paramType, infoName, infoType);
-      case 65:
+      case 85:
          return ANARI_GEOMETRY_cone_primitive_attribute1_info(paramType, infoName, infoType);
-      case 66:
+      case 86:
          return ANARI_GEOMETRY_cone_primitive_attribute2_info(paramType, infoName, infoType);
-      case 67:
+      case 87:
          return ANARI_GEOMETRY_cone_primitive_attribute3_info(paramType, infoName, infoType);
-      case 69:
+      case 89:
          return ANARI_GEOMETRY_cone_primitive_id_info(paramType, infoName, infoType);
-      case 103:
+      case 133:
          return ANARI_GEOMETRY_cone_vertex_position_info(paramType, infoName, infoType);
-      case 104:
+      case 134:
          return ANARI_GEOMETRY_cone_vertex_radius_info(paramType, infoName, infoType);
-      case 98:
+      case 128:
          return ANARI_GEOMETRY_cone_vertex_cap_info(paramType, infoName, infoType);
-      case 99:
+      case 129:
          return ANARI_GEOMETRY_cone_vertex_color_info(paramType, infoName, infoType);
-      case 90:
+      case 120:
          return ANARI_GEOMETRY_cone_vertex_attribute0_info(paramType, infoName, infoType);
-      case 92:
+      case 122:
          return ANARI_GEOMETRY_cone_vertex_attribute1_info(paramType, infoName, infoType);
-      case 94:
+      case 124:
          return ANARI_GEOMETRY_cone_vertex_attribute2_info(paramType, infoName, infoType);
-      case 96:
+      case 126:
          return ANARI_GEOMETRY_cone_vertex_attribute3_info(paramType, infoName, infoType);
-      case 70:
+      case 90:
          return ANARI_GEOMETRY_cone_primitive_index_info(paramType, infoName, infoType);
-      case 14:
+      case 23:
          return ANARI_GEOMETRY_cone_caps_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -3638,7 +4083,7 @@ static const void * ANARI_GEOMETRY_curve_name_info(ANARIDataType paramType, int
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3670,7 +4115,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_color_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3702,7 +4147,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute0_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3734,7 +4179,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute1_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3766,7 +4211,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute2_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3798,7 +4243,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute3_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3830,7 +4275,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_id_info(ANARIDataType paramTy
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3862,7 +4307,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_position_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3894,7 +4339,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_radius_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3926,7 +4371,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_color_info(ANARIDataType paramTy
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3958,7 +4403,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute0_info(ANARIDataType pa
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -3990,7 +4435,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute1_info(ANARIDataType pa
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4022,7 +4467,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute2_info(ANARIDataType pa
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4054,7 +4499,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute3_info(ANARIDataType pa
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4086,7 +4531,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_index_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4111,7 +4556,7 @@ static const void * ANARI_GEOMETRY_curve_radius_info(ANARIDataType paramType, in
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -4119,37 +4564,37 @@ static const void * ANARI_GEOMETRY_curve_radius_info(ANARIDataType paramType, in
 }
 static const void * ANARI_GEOMETRY_curve_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_GEOMETRY_curve_name_info(paramType, infoName, infoType);
-      case 68:
+      case 88:
          return ANARI_GEOMETRY_curve_primitive_color_info(paramType, infoName, infoType);
-      case 64:
+      case 84:
          return ANARI_GEOMETRY_curve_primitive_attribute0_info(paramType, infoName, infoType);
-      case 65:
+      case 85:
          return ANARI_GEOMETRY_curve_primitive_attribute1_info(paramType, infoName, infoType);
-      case 66:
+      case 86:
          return ANARI_GEOMETRY_curve_primitive_attribute2_info(paramType, infoName, infoType);
-      case 67:
+      case 87:
          return ANARI_GEOMETRY_curve_primitive_attribute3_info(paramType, infoName, infoType);
-      case 69:
+      case 89:
          return ANARI_GEOMETRY_curve_primitive_id_info(paramType, infoName, infoType);
-      case 103:
+      case 133:
          return ANARI_GEOMETRY_curve_vertex_position_info(paramType, infoName, infoType);
-      case 104:
+      case 134:
          return ANARI_GEOMETRY_curve_vertex_radius_info(paramType, infoName, infoType);
-      case 99:
+      case 129:
          return ANARI_GEOMETRY_curve_vertex_color_info(paramType, infoName, infoType);
-      case 90:
+      case 120:
          return ANARI_GEOMETRY_curve_vertex_attribute0_info(paramType, infoName, infoType);
-      case 92:
+      case 122:
          return ANARI_GEOMETRY_curve_vertex_attribute1_info(paramType, infoName, infoType);
-      case 94:
+      case 124:
          return ANARI_GEOMETRY_curve_vertex_attribute2_info(paramType, infoName, infoType);
-      case 96:
+      case 126:
          return ANARI_GEOMETRY_curve_vertex_attribute3_info(paramType, infoName, infoType);
-      case 70:
+      case 90:
          return ANARI_GEOMETRY_curve_primitive_index_info(paramType, infoName, infoType);
-      case 72:
+      case 92:
          return ANARI_GEOMETRY_curve_radius_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -4174,7 +4619,7 @@ static const void * ANARI_GEOMETRY_cylinder_name_info(ANARIDataType paramType, i
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4206,7 +4651,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_color_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4238,7 +4683,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute0_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4270,7 +4715,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute1_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4302,7 +4747,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute2_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4334,7 +4779,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute3_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4366,7 +4811,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_id_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4398,7 +4843,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_position_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4430,7 +4875,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_cap_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4462,7 +4907,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_color_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4494,7 +4939,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute0_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4526,7 +4971,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute1_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4558,7 +5003,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute2_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4590,7 +5035,7 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute3_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4622,7 +5067,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_index_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4654,7 +5099,7 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_radius_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4679,7 +5124,7 @@ static const void * ANARI_GEOMETRY_cylinder_radius_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4718,7 +5163,7 @@ static const void * ANARI_GEOMETRY_cylinder_caps_info(ANARIDataType paramType, i
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
@@ -4726,41 +5171,41 @@ static const void * ANARI_GEOMETRY_cylinder_caps_info(ANARIDataType paramType, i
 }
 static const void * ANARI_GEOMETRY_cylinder_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_GEOMETRY_cylinder_name_info(paramType, infoName, infoType);
-      case 68:
+      case 88:
          return ANARI_GEOMETRY_cylinder_primitive_color_info(paramType, infoName, infoType);
-      case 64:
+      case 84:
          return ANARI_GEOMETRY_cylinder_primitive_attribute0_info(paramType, infoName, infoType);
-      case 65:
+      case 85:
          return ANARI_GEOMETRY_cylinder_primitive_attribute1_info(paramType, infoName, infoType);
-      case 66:
+      case 86:
          return ANARI_GEOMETRY_cylinder_primitive_attribute2_info(paramType, infoName, infoType);
-      case 67:
+      case 87:
          return ANARI_GEOMETRY_cylinder_primitive_attribute3_info(paramType, infoName, infoType);
-      case 69:
+      case 89:
          return ANARI_GEOMETRY_cylinder_primitive_id_info(paramType, infoName, infoType);
-      case 103:
+      case 133:
          return ANARI_GEOMETRY_cylinder_vertex_position_info(paramType, infoName, infoType);
-      case 98:
+      case 128:
          return ANARI_GEOMETRY_cylinder_vertex_cap_info(paramType, infoName, infoType);
-      case 99:
+      case 129:
          return ANARI_GEOMETRY_cylinder_vertex_color_info(paramType, infoName, infoType);
-      case 90:
+      case 120:
          return ANARI_GEOMETRY_cylinder_vertex_attribute0_info(paramType, infoName, infoType);
-      case 92:
+      case 122:
          return ANARI_GEOMETRY_cylinder_vertex_attribute1_info(paramType, infoName, infoType);
-      case 94:
+      case 124:
          return ANARI_GEOMETRY_cylinder_vertex_attribute2_info(paramType, infoName, infoType);
-      case 96:
+      case 126:
          return ANARI_GEOMETRY_cylinder_vertex_attribute3_info(paramType, infoName, infoType);
-      case 70:
+      case 90:
          return ANARI_GEOMETRY_cylinder_primitive_index_info(paramType, infoName, infoType);
-      case 71:
+      case 91:
          return ANARI_GEOMETRY_cylinder_primitive_radius_info(paramType, infoName, infoType);
-      case 72:
+      case 92:
          return ANARI_GEOMETRY_cylinder_radius_info(paramType, infoName, infoType);
-      case 14:
+      case 23:
          return ANARI_GEOMETRY_cylinder_caps_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -4785,7 +5230,7 @@ static const void * ANARI_GEOMETRY_quad_name_info(ANARIDataType paramType, int i
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -4817,7 +5262,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_color_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -4849,7 +5294,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute0_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -4881,7 +5326,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute1_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -4913,7 +5358,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute2_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -4945,7 +5390,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute3_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -4977,7 +5422,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_id_info(ANARIDataType paramTyp
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5009,7 +5454,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_position_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5041,7 +5486,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_normal_info(ANARIDataType paramTy
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5073,7 +5518,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_tangent_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5105,7 +5550,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_color_info(ANARIDataType paramTyp
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5137,7 +5582,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute0_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5169,7 +5614,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute1_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5201,7 +5646,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute2_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5233,7 +5678,7 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute3_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5265,7 +5710,7 @@ static const void * ANARI_GEOMETRY_quad_primitive_index_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
@@ -5273,37 +5718,37 @@ static const void * ANARI_GEOMETRY_quad_primitive_index_info(ANARIDataType param
 }
 static const void * ANARI_GEOMETRY_quad_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_GEOMETRY_quad_name_info(paramType, infoName, infoType);
-      case 68:
+      case 88:
          return ANARI_GEOMETRY_quad_primitive_color_info(paramType, infoName, infoType);
-      case 64:
+      case 84:
          return ANARI_GEOMETRY_quad_primitive_attribute0_info(paramType, infoName, infoType);
-      case 65:
+      case 85:
          return ANARI_GEOMETRY_quad_primitive_attribute1_info(paramType, infoName, infoType);
-      case 66:
+      case 86:
          return ANARI_GEOMETRY_quad_primitive_attribute2_info(paramType, infoName, infoType);
-      case 67:
+      case 87:
          return ANARI_GEOMETRY_quad_primitive_attribute3_info(paramType, infoName, infoType);
-      case 69:
+      case 89:
          return ANARI_GEOMETRY_quad_primitive_id_info(paramType, infoName, infoType);
-      case 103:
+      case 133:
          return ANARI_GEOMETRY_quad_vertex_position_info(paramType, infoName, infoType);
-      case 101:
+      case 131:
          return ANARI_GEOMETRY_quad_vertex_normal_info(paramType, infoName, infoType);
-      case 105:
+      case 135:
          return ANARI_GEOMETRY_quad_vertex_tangent_info(paramType, infoName, infoType);
-      case 99:
+      case 129:
          return ANARI_GEOMETRY_quad_vertex_color_info(paramType, infoName, infoType);
-      case 90:
+      case 120:
          return ANARI_GEOMETRY_quad_vertex_attribute0_info(paramType, infoName, infoType);
-      case 92:
+      case 122:
          return ANARI_GEOMETRY_quad_vertex_attribute1_info(paramType, infoName, infoType);
-      case 94:
+      case 124:
          return ANARI_GEOMETRY_quad_vertex_attribute2_info(paramType, infoName, infoType);
-      case 96:
+      case 126:
          return ANARI_GEOMETRY_quad_vertex_attribute3_info(paramType, infoName, infoType);
-      case 70:
+      case 90:
          return ANARI_GEOMETRY_quad_primitive_index_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -5328,7 +5773,7 @@ static const void * ANARI_GEOMETRY_sphere_name_info(ANARIDataType paramType, int
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5360,7 +5805,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_color_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5392,7 +5837,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute0_info(ANARIDataTyp
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5424,7 +5869,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute1_info(ANARIDataTyp
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5456,7 +5901,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute2_info(ANARIDataTyp
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5488,7 +5933,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute3_info(ANARIDataTyp
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5520,7 +5965,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_id_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5552,7 +5997,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5584,7 +6029,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5616,7 +6061,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_color_info(ANARIDataType paramT
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5648,7 +6093,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute0_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5680,7 +6125,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5712,7 +6157,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5744,7 +6189,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5776,7 +6221,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5801,7 +6246,7 @@ static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, i
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
@@ -5809,37 +6254,37 @@ static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, i
 }
 static const void * ANARI_GEOMETRY_sphere_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_GEOMETRY_sphere_name_info(paramType, infoName, infoType);
-      case 68:
+      case 88:
          return ANARI_GEOMETRY_sphere_primitive_color_info(paramType, infoName, infoType);
-      case 64:
+      case 84:
          return ANARI_GEOMETRY_sphere_primitive_attribute0_info(paramType, infoName, infoType);
-      case 65:
+      case 85:
          return ANARI_GEOMETRY_sphere_primitive_attribute1_info(paramType, infoName, infoType);
-      case 66:
+      case 86:
          return ANARI_GEOMETRY_sphere_primitive_attribute2_info(paramType, infoName, infoType);
-      case 67:
+      case 87:
          return ANARI_GEOMETRY_sphere_primitive_attribute3_info(paramType, infoName, infoType);
-      case 69:
+      case 89:
          return ANARI_GEOMETRY_sphere_primitive_id_info(paramType, infoName, infoType);
-      case 103:
+      case 133:
          return ANARI_GEOMETRY_sphere_vertex_position_info(paramType, infoName, infoType);
-      case 104:
+      case 134:
          return ANARI_GEOMETRY_sphere_vertex_radius_info(paramType, infoName, infoType);
-      case 99:
+      case 129:
          return ANARI_GEOMETRY_sphere_vertex_color_info(paramType, infoName, infoType);
-      case 90:
+      case 120:
          return ANARI_GEOMETRY_sphere_vertex_attribute0_info(paramType, infoName, infoType);
-      case 92:
+      case 122:
          return ANARI_GEOMETRY_sphere_vertex_attribute1_info(paramType, infoName, infoType);
-      case 94:
+      case 124:
          return ANARI_GEOMETRY_sphere_vertex_attribute2_info(paramType, infoName, infoType);
-      case 96:
+      case 126:
          return ANARI_GEOMETRY_sphere_vertex_attribute3_info(paramType, infoName, infoType);
-      case 70:
+      case 90:
          return ANARI_GEOMETRY_sphere_primitive_index_info(paramType, infoName, infoType);
-      case 72:
+      case 92:
          return ANARI_GEOMETRY_sphere_radius_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -5864,7 +6309,7 @@ static const void * ANARI_GEOMETRY_triangle_name_info(ANARIDataType paramType, i
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -5896,7 +6341,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_color_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -5928,7 +6373,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute0_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -5960,7 +6405,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute1_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -5992,7 +6437,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute2_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -6024,7 +6469,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute3_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -6056,7 +6501,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_id_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -6088,7 +6533,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_position_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -6120,7 +6565,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_normal_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -6152,7 +6597,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_tangent_info(ANARIDataType pa
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -6184,7 +6629,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_color_info(ANARIDataType para
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -6216,7 +6661,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -6248,7 +6693,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -6280,7 +6725,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -6312,7 +6757,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -6344,7 +6789,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
@@ -6496,49 +6941,49 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_index_info(ANARIDa
 }
 static const void * ANARI_GEOMETRY_triangle_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_GEOMETRY_triangle_name_info(paramType, infoName, infoType);
-      case 68:
+      case 88:
          return ANARI_GEOMETRY_triangle_primitive_color_info(paramType, infoName, infoType);
-      case 64:
+      case 84:
          return ANARI_GEOMETRY_triangle_primitive_attribute0_info(paramType, infoName, infoType);
-      case 65:
+      case 85:
          return ANARI_GEOMETRY_triangle_primitive_attribute1_info(paramType, infoName, infoType);
-      case 66:
+      case 86:
          return ANARI_GEOMETRY_triangle_primitive_attribute2_info(paramType, infoName, infoType);
-      case 67:
+      case 87:
          return ANARI_GEOMETRY_triangle_primitive_attribute3_info(paramType, infoName, infoType);
-      case 69:
+      case 89:
          return ANARI_GEOMETRY_triangle_primitive_id_info(paramType, infoName, infoType);
-      case 103:
+      case 133:
          return ANARI_GEOMETRY_triangle_vertex_position_info(paramType, infoName, infoType);
-      case 101:
+      case 131:
          return ANARI_GEOMETRY_triangle_vertex_normal_info(paramType, infoName, infoType);
-      case 105:
+      case 135:
          return ANARI_GEOMETRY_triangle_vertex_tangent_info(paramType, infoName, infoType);
-      case 99:
+      case 129:
          return ANARI_GEOMETRY_triangle_vertex_color_info(paramType, infoName, infoType);
-      case 90:
+      case 120:
          return ANARI_GEOMETRY_triangle_vertex_attribute0_info(paramType, infoName, infoType);
-      case 92:
+      case 122:
          return ANARI_GEOMETRY_triangle_vertex_attribute1_info(paramType, infoName, infoType);
-      case 94:
+      case 124:
          return ANARI_GEOMETRY_triangle_vertex_attribute2_info(paramType, infoName, infoType);
-      case 96:
+      case 126:
          return ANARI_GEOMETRY_triangle_vertex_attribute3_info(paramType, infoName, infoType);
-      case 70:
+      case 90:
          return ANARI_GEOMETRY_triangle_primitive_index_info(paramType, infoName, infoType);
-      case 102:
+      case 132:
          return ANARI_GEOMETRY_triangle_vertex_normal_index_info(paramType, infoName, infoType);
-      case 100:
+      case 130:
          return ANARI_GEOMETRY_triangle_vertex_color_index_info(paramType, infoName, infoType);
-      case 91:
+      case 121:
          return ANARI_GEOMETRY_triangle_vertex_attribute0_index_info(paramType, infoName, infoType);
-      case 93:
+      case 123:
          return ANARI_GEOMETRY_triangle_vertex_attribute1_index_info(paramType, infoName, infoType);
-      case 95:
+      case 125:
          return ANARI_GEOMETRY_triangle_vertex_attribute2_index_info(paramType, infoName, infoType);
-      case 97:
+      case 127:
          return ANARI_GEOMETRY_triangle_vertex_attribute3_index_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -6563,7 +7008,7 @@ static const void * ANARI_INSTANCE_transform_name_info(ANARIDataType paramType,
             static const char *extension = "KHR_INSTANCE_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
@@ -6590,12 +7035,19 @@ static const void * ANARI_INSTANCE_transform_transform_info(ANARIDataType paramT
             static const char *description = "transform applied to objects in the instance";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_MAT4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_INSTANCE_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
@@ -6620,7 +7072,199 @@ static const void * ANARI_INSTANCE_transform_group_info(ANARIDataType paramType,
             static const char *extension = "KHR_INSTANCE_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 17;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE_transform_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "user defined id per placement";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_INSTANCE_TRANSFORM_ARRAY";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 30;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE_transform_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "attribute0 value per placement";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_INSTANCE_TRANSFORM_ARRAY";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 30;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE_transform_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "attribute1 value per placement";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_INSTANCE_TRANSFORM_ARRAY";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 30;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE_transform_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "attribute2 value per placement";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_INSTANCE_TRANSFORM_ARRAY";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 30;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE_transform_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "attribute3 value per placement";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_INSTANCE_TRANSFORM_ARRAY";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 30;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE_transform_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "color value per placement";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_INSTANCE_TRANSFORM_ARRAY";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 30;
             return &value;
          }
       default: return nullptr;
@@ -6628,12 +7272,24 @@ static const void * ANARI_INSTANCE_transform_group_info(ANARIDataType paramType,
 }
 static const void * ANARI_INSTANCE_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_INSTANCE_transform_name_info(paramType, infoName, infoType);
-      case 87:
+      case 116:
          return ANARI_INSTANCE_transform_transform_info(paramType, infoName, infoType);
-      case 33:
+      case 48:
          return ANARI_INSTANCE_transform_group_info(paramType, infoName, infoType);
+      case 50:
+         return ANARI_INSTANCE_transform_id_info(paramType, infoName, infoType);
+      case 12:
+         return ANARI_INSTANCE_transform_attribute0_info(paramType, infoName, infoType);
+      case 13:
+         return ANARI_INSTANCE_transform_attribute1_info(paramType, infoName, infoType);
+      case 14:
+         return ANARI_INSTANCE_transform_attribute2_info(paramType, infoName, infoType);
+      case 15:
+         return ANARI_INSTANCE_transform_attribute3_info(paramType, infoName, infoType);
+      case 33:
+         return ANARI_INSTANCE_transform_color_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -6657,7 +7313,7 @@ static const void * ANARI_LIGHT_directional_name_info(ANARIDataType paramType, i
             static const char *extension = "KHR_LIGHT_DIRECTIONAL";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 18;
             return &value;
          }
       default: return nullptr;
@@ -6709,7 +7365,7 @@ static const void * ANARI_LIGHT_directional_color_info(ANARIDataType paramType,
             static const char *extension = "KHR_LIGHT_DIRECTIONAL";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 18;
             return &value;
          }
       default: return nullptr;
@@ -6741,7 +7397,7 @@ static const void * ANARI_LIGHT_directional_irradiance_info(ANARIDataType paramT
             static const char *extension = "KHR_LIGHT_DIRECTIONAL";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 18;
             return &value;
          }
       default: return nullptr;
@@ -6779,7 +7435,7 @@ static const void * ANARI_LIGHT_directional_direction_info(ANARIDataType paramTy
             static const char *extension = "KHR_LIGHT_DIRECTIONAL";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
+            static const int32_t value = 18;
             return &value;
          }
       default: return nullptr;
@@ -6787,13 +7443,13 @@ static const void * ANARI_LIGHT_directional_direction_info(ANARIDataType paramTy
 }
 static const void * ANARI_LIGHT_directional_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_LIGHT_directional_name_info(paramType, infoName, infoType);
-      case 24:
+      case 33:
          return ANARI_LIGHT_directional_color_info(paramType, infoName, infoType);
-      case 47:
+      case 63:
          return ANARI_LIGHT_directional_irradiance_info(paramType, infoName, infoType);
-      case 27:
+      case 37:
          return ANARI_LIGHT_directional_direction_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -6818,7 +7474,7 @@ static const void * ANARI_LIGHT_point_name_info(ANARIDataType paramType, int inf
             static const char *extension = "KHR_LIGHT_POINT";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 19;
             return &value;
          }
       default: return nullptr;
@@ -6870,7 +7526,7 @@ static const void * ANARI_LIGHT_point_color_info(ANARIDataType paramType, int in
             static const char *extension = "KHR_LIGHT_POINT";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 19;
             return &value;
          }
       default: return nullptr;
@@ -6908,7 +7564,7 @@ static const void * ANARI_LIGHT_point_position_info(ANARIDataType paramType, int
             static const char *extension = "KHR_LIGHT_POINT";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 19;
             return &value;
          }
       default: return nullptr;
@@ -6940,7 +7596,7 @@ static const void * ANARI_LIGHT_point_intensity_info(ANARIDataType paramType, in
             static const char *extension = "KHR_LIGHT_POINT";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 19;
             return &value;
          }
       default: return nullptr;
@@ -6972,7 +7628,7 @@ static const void * ANARI_LIGHT_point_power_info(ANARIDataType paramType, int in
             static const char *extension = "KHR_LIGHT_POINT";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 16;
+            static const int32_t value = 19;
             return &value;
          }
       default: return nullptr;
@@ -6980,15 +7636,15 @@ static const void * ANARI_LIGHT_point_power_info(ANARIDataType paramType, int in
 }
 static const void * ANARI_LIGHT_point_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_LIGHT_point_name_info(paramType, infoName, infoType);
-      case 24:
+      case 33:
          return ANARI_LIGHT_point_color_info(paramType, infoName, infoType);
-      case 62:
+      case 82:
          return ANARI_LIGHT_point_position_info(paramType, infoName, infoType);
-      case 42:
+      case 57:
          return ANARI_LIGHT_point_intensity_info(paramType, infoName, infoType);
-      case 63:
+      case 83:
          return ANARI_LIGHT_point_power_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -7013,7 +7669,7 @@ static const void * ANARI_MATERIAL_matte_name_info(ANARIDataType paramType, int
             static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 17;
+            static const int32_t value = 20;
             return &value;
          }
       default: return nullptr;
@@ -7058,7 +7714,7 @@ static const void * ANARI_MATERIAL_matte_color_info(ANARIDataType paramType, int
             static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 17;
+            static const int32_t value = 20;
             return &value;
          }
       default: return nullptr;
@@ -7097,7 +7753,7 @@ static const void * ANARI_MATERIAL_matte_opacity_info(ANARIDataType paramType, i
             static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 17;
+            static const int32_t value = 20;
             return &value;
          }
       default: return nullptr;
@@ -7136,7 +7792,7 @@ static const void * ANARI_MATERIAL_matte_alphaMode_info(ANARIDataType paramType,
             static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 17;
+            static const int32_t value = 20;
             return &value;
          }
       default: return nullptr;
@@ -7168,7 +7824,7 @@ static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramTyp
             static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 17;
+            static const int32_t value = 20;
             return &value;
          }
       default: return nullptr;
@@ -7176,11 +7832,11 @@ static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramTyp
 }
 static const void * ANARI_MATERIAL_matte_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_MATERIAL_matte_name_info(paramType, infoName, infoType);
-      case 24:
+      case 33:
          return ANARI_MATERIAL_matte_color_info(paramType, infoName, infoType);
-      case 57:
+      case 76:
          return ANARI_MATERIAL_matte_opacity_info(paramType, infoName, infoType);
       case 2:
          return ANARI_MATERIAL_matte_alphaMode_info(paramType, infoName, infoType);
@@ -7209,7 +7865,7 @@ static const void * ANARI_MATERIAL_physicallyBased_name_info(ANARIDataType param
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7254,7 +7910,7 @@ static const void * ANARI_MATERIAL_physicallyBased_baseColor_info(ANARIDataType
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7293,7 +7949,7 @@ static const void * ANARI_MATERIAL_physicallyBased_opacity_info(ANARIDataType pa
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7332,7 +7988,7 @@ static const void * ANARI_MATERIAL_physicallyBased_metallic_info(ANARIDataType p
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7371,7 +8027,7 @@ static const void * ANARI_MATERIAL_physicallyBased_roughness_info(ANARIDataType
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7396,7 +8052,7 @@ static const void * ANARI_MATERIAL_physicallyBased_normal_info(ANARIDataType par
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7441,7 +8097,7 @@ static const void * ANARI_MATERIAL_physicallyBased_emissive_info(ANARIDataType p
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7466,7 +8122,7 @@ static const void * ANARI_MATERIAL_physicallyBased_occlusion_info(ANARIDataType
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7505,7 +8161,7 @@ static const void * ANARI_MATERIAL_physicallyBased_alphaMode_info(ANARIDataType
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7537,7 +8193,7 @@ static const void * ANARI_MATERIAL_physicallyBased_alphaCutoff_info(ANARIDataTyp
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7576,7 +8232,7 @@ static const void * ANARI_MATERIAL_physicallyBased_specular_info(ANARIDataType p
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7621,7 +8277,7 @@ static const void * ANARI_MATERIAL_physicallyBased_specularColor_info(ANARIDataT
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7660,7 +8316,7 @@ static const void * ANARI_MATERIAL_physicallyBased_clearcoat_info(ANARIDataType
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7699,7 +8355,7 @@ static const void * ANARI_MATERIAL_physicallyBased_clearcoatRoughness_info(ANARI
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7724,7 +8380,7 @@ static const void * ANARI_MATERIAL_physicallyBased_clearcoatNormal_info(ANARIDat
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7763,7 +8419,7 @@ static const void * ANARI_MATERIAL_physicallyBased_transmission_info(ANARIDataTy
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7802,7 +8458,7 @@ static const void * ANARI_MATERIAL_physicallyBased_ior_info(ANARIDataType paramT
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7841,7 +8497,7 @@ static const void * ANARI_MATERIAL_physicallyBased_thickness_info(ANARIDataType
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7873,7 +8529,7 @@ static const void * ANARI_MATERIAL_physicallyBased_attenuationDistance_info(ANAR
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7911,7 +8567,7 @@ static const void * ANARI_MATERIAL_physicallyBased_attenuationColor_info(ANARIDa
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7956,7 +8612,7 @@ static const void * ANARI_MATERIAL_physicallyBased_sheenColor_info(ANARIDataType
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -7995,7 +8651,7 @@ static const void * ANARI_MATERIAL_physicallyBased_sheenRoughness_info(ANARIData
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -8034,7 +8690,7 @@ static const void * ANARI_MATERIAL_physicallyBased_iridescence_info(ANARIDataTyp
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -8066,7 +8722,7 @@ static const void * ANARI_MATERIAL_physicallyBased_iridescenceIor_info(ANARIData
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -8105,7 +8761,7 @@ static const void * ANARI_MATERIAL_physicallyBased_iridescenceThickness_info(ANA
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 21;
             return &value;
          }
       default: return nullptr;
@@ -8113,55 +8769,55 @@ static const void * ANARI_MATERIAL_physicallyBased_iridescenceThickness_info(ANA
 }
 static const void * ANARI_MATERIAL_physicallyBased_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_MATERIAL_physicallyBased_name_info(paramType, infoName, infoType);
-      case 12:
+      case 17:
          return ANARI_MATERIAL_physicallyBased_baseColor_info(paramType, infoName, infoType);
-      case 57:
+      case 76:
          return ANARI_MATERIAL_physicallyBased_opacity_info(paramType, infoName, infoType);
-      case 51:
+      case 70:
          return ANARI_MATERIAL_physicallyBased_metallic_info(paramType, infoName, infoType);
-      case 75:
+      case 99:
          return ANARI_MATERIAL_physicallyBased_roughness_info(paramType, infoName, infoType);
-      case 55:
+      case 74:
          return ANARI_MATERIAL_physicallyBased_normal_info(paramType, infoName, infoType);
-      case 28:
+      case 38:
          return ANARI_MATERIAL_physicallyBased_emissive_info(paramType, infoName, infoType);
-      case 56:
+      case 75:
          return ANARI_MATERIAL_physicallyBased_occlusion_info(paramType, infoName, infoType);
       case 2:
          return ANARI_MATERIAL_physicallyBased_alphaMode_info(paramType, infoName, infoType);
       case 1:
          return ANARI_MATERIAL_physicallyBased_alphaCutoff_info(paramType, infoName, infoType);
-      case 81:
+      case 105:
          return ANARI_MATERIAL_physicallyBased_specular_info(paramType, infoName, infoType);
-      case 82:
+      case 106:
          return ANARI_MATERIAL_physicallyBased_specularColor_info(paramType, infoName, infoType);
-      case 21:
+      case 30:
          return ANARI_MATERIAL_physicallyBased_clearcoat_info(paramType, infoName, infoType);
-      case 23:
+      case 32:
          return ANARI_MATERIAL_physicallyBased_clearcoatRoughness_info(paramType, infoName, infoType);
-      case 22:
+      case 31:
          return ANARI_MATERIAL_physicallyBased_clearcoatNormal_info(paramType, infoName, infoType);
-      case 88:
+      case 117:
          return ANARI_MATERIAL_physicallyBased_transmission_info(paramType, infoName, infoType);
-      case 43:
+      case 59:
          return ANARI_MATERIAL_physicallyBased_ior_info(paramType, infoName, infoType);
-      case 86:
+      case 111:
          return ANARI_MATERIAL_physicallyBased_thickness_info(paramType, infoName, infoType);
-      case 10:
+      case 11:
          return ANARI_MATERIAL_physicallyBased_attenuationDistance_info(paramType, infoName, infoType);
-      case 9:
+      case 10:
          return ANARI_MATERIAL_physicallyBased_attenuationColor_info(paramType, infoName, infoType);
-      case 77:
+      case 101:
          return ANARI_MATERIAL_physicallyBased_sheenColor_info(paramType, infoName, infoType);
-      case 78:
+      case 102:
          return ANARI_MATERIAL_physicallyBased_sheenRoughness_info(paramType, infoName, infoType);
-      case 44:
+      case 60:
          return ANARI_MATERIAL_physicallyBased_iridescence_info(paramType, infoName, infoType);
-      case 45:
+      case 61:
          return ANARI_MATERIAL_physicallyBased_iridescenceIor_info(paramType, infoName, infoType);
-      case 46:
+      case 62:
          return ANARI_MATERIAL_physicallyBased_iridescenceThickness_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -8186,7 +8842,7 @@ static const void * ANARI_SAMPLER_image1D_name_info(ANARIDataType paramType, int
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -8218,7 +8874,7 @@ static const void * ANARI_SAMPLER_image1D_image_info(ANARIDataType paramType, in
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -8257,7 +8913,7 @@ static const void * ANARI_SAMPLER_image1D_inAttribute_info(ANARIDataType paramTy
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -8296,7 +8952,7 @@ static const void * ANARI_SAMPLER_image1D_filter_info(ANARIDataType paramType, i
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -8335,7 +8991,7 @@ static const void * ANARI_SAMPLER_image1D_wrapMode1_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -8367,7 +9023,7 @@ static const void * ANARI_SAMPLER_image1D_inTransform_info(ANARIDataType paramTy
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -8399,7 +9055,7 @@ static const void * ANARI_SAMPLER_image1D_inOffset_info(ANARIDataType paramType,
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -8431,7 +9087,7 @@ static const void * ANARI_SAMPLER_image1D_outTransform_info(ANARIDataType paramT
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -8463,7 +9119,7 @@ static const void * ANARI_SAMPLER_image1D_outOffset_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 22;
             return &value;
          }
       default: return nullptr;
@@ -8471,23 +9127,23 @@ static const void * ANARI_SAMPLER_image1D_outOffset_info(ANARIDataType paramType
 }
 static const void * ANARI_SAMPLER_image1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_SAMPLER_image1D_name_info(paramType, infoName, infoType);
-      case 36:
+      case 51:
          return ANARI_SAMPLER_image1D_image_info(paramType, infoName, infoType);
-      case 38:
+      case 53:
          return ANARI_SAMPLER_image1D_inAttribute_info(paramType, infoName, infoType);
-      case 30:
+      case 43:
          return ANARI_SAMPLER_image1D_filter_info(paramType, infoName, infoType);
-      case 108:
+      case 138:
          return ANARI_SAMPLER_image1D_wrapMode1_info(paramType, infoName, infoType);
-      case 40:
+      case 55:
          return ANARI_SAMPLER_image1D_inTransform_info(paramType, infoName, infoType);
-      case 39:
+      case 54:
          return ANARI_SAMPLER_image1D_inOffset_info(paramType, infoName, infoType);
-      case 60:
+      case 79:
          return ANARI_SAMPLER_image1D_outTransform_info(paramType, infoName, infoType);
-      case 59:
+      case 78:
          return ANARI_SAMPLER_image1D_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -8512,7 +9168,7 @@ static const void * ANARI_SAMPLER_image2D_name_info(ANARIDataType paramType, int
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -8544,7 +9200,7 @@ static const void * ANARI_SAMPLER_image2D_image_info(ANARIDataType paramType, in
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -8583,7 +9239,7 @@ static const void * ANARI_SAMPLER_image2D_inAttribute_info(ANARIDataType paramTy
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -8622,7 +9278,7 @@ static const void * ANARI_SAMPLER_image2D_filter_info(ANARIDataType paramType, i
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -8661,7 +9317,7 @@ static const void * ANARI_SAMPLER_image2D_wrapMode1_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -8700,7 +9356,7 @@ static const void * ANARI_SAMPLER_image2D_wrapMode2_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -8732,7 +9388,7 @@ static const void * ANARI_SAMPLER_image2D_inTransform_info(ANARIDataType paramTy
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -8764,7 +9420,7 @@ static const void * ANARI_SAMPLER_image2D_inOffset_info(ANARIDataType paramType,
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -8796,7 +9452,7 @@ static const void * ANARI_SAMPLER_image2D_outTransform_info(ANARIDataType paramT
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -8828,7 +9484,7 @@ static const void * ANARI_SAMPLER_image2D_outOffset_info(ANARIDataType paramType
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
@@ -8836,25 +9492,25 @@ static const void * ANARI_SAMPLER_image2D_outOffset_info(ANARIDataType paramType
 }
 static const void * ANARI_SAMPLER_image2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_SAMPLER_image2D_name_info(paramType, infoName, infoType);
-      case 36:
+      case 51:
          return ANARI_SAMPLER_image2D_image_info(paramType, infoName, infoType);
-      case 38:
+      case 53:
          return ANARI_SAMPLER_image2D_inAttribute_info(paramType, infoName, infoType);
-      case 30:
+      case 43:
          return ANARI_SAMPLER_image2D_filter_info(paramType, infoName, infoType);
-      case 108:
+      case 138:
          return ANARI_SAMPLER_image2D_wrapMode1_info(paramType, infoName, infoType);
-      case 109:
+      case 139:
          return ANARI_SAMPLER_image2D_wrapMode2_info(paramType, infoName, infoType);
-      case 40:
+      case 55:
          return ANARI_SAMPLER_image2D_inTransform_info(paramType, infoName, infoType);
-      case 39:
+      case 54:
          return ANARI_SAMPLER_image2D_inOffset_info(paramType, infoName, infoType);
-      case 60:
+      case 79:
          return ANARI_SAMPLER_image2D_outTransform_info(paramType, infoName, infoType);
-      case 59:
+      case 78:
          return ANARI_SAMPLER_image2D_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -8879,7 +9535,7 @@ static const void * ANARI_SAMPLER_primitive_name_info(ANARIDataType paramType, i
             static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
@@ -8911,7 +9567,7 @@ static const void * ANARI_SAMPLER_primitive_array_info(ANARIDataType paramType,
             static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
@@ -8943,7 +9599,7 @@ static const void * ANARI_SAMPLER_primitive_inOffset_info(ANARIDataType paramTyp
             static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
@@ -8951,11 +9607,11 @@ static const void * ANARI_SAMPLER_primitive_inOffset_info(ANARIDataType paramTyp
 }
 static const void * ANARI_SAMPLER_primitive_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_SAMPLER_primitive_name_info(paramType, infoName, infoType);
-      case 7:
+      case 8:
          return ANARI_SAMPLER_primitive_array_info(paramType, infoName, infoType);
-      case 39:
+      case 54:
          return ANARI_SAMPLER_primitive_inOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -8980,7 +9636,7 @@ static const void * ANARI_SAMPLER_transform_name_info(ANARIDataType paramType, i
             static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
@@ -9019,7 +9675,7 @@ static const void * ANARI_SAMPLER_transform_inAttribute_info(ANARIDataType param
             static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
@@ -9051,7 +9707,7 @@ static const void * ANARI_SAMPLER_transform_outTransform_info(ANARIDataType para
             static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
@@ -9083,7 +9739,7 @@ static const void * ANARI_SAMPLER_transform_outOffset_info(ANARIDataType paramTy
             static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
@@ -9091,13 +9747,13 @@ static const void * ANARI_SAMPLER_transform_outOffset_info(ANARIDataType paramTy
 }
 static const void * ANARI_SAMPLER_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
+      case 72:
          return ANARI_SAMPLER_transform_name_info(paramType, infoName, infoType);
-      case 38:
+      case 53:
          return ANARI_SAMPLER_transform_inAttribute_info(paramType, infoName, infoType);
-      case 60:
+      case 79:
          return ANARI_SAMPLER_transform_outTransform_info(paramType, infoName, infoType);
-      case 59:
+      case 78:
          return ANARI_SAMPLER_transform_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -9122,7 +9778,7 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_name_info(ANARIDataTyp
             static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 23;
+            static const int32_t value = 26;
             return &value;
          }
       default: return nullptr;
@@ -9154,13 +9810,1319 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_data_info(ANARIDataTyp
             static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 23;
+            static const int32_t value = 26;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "origin of the grid in object-space";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 26;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "size of the grid cells in object-space";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 26;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "linear";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "filter mode used to interpolate the grid";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"nearest", "linear", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 26;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_timesteps_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "one data array per timestep, used instead of data";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_ARRAY3D, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_TIME_SERIES";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 33;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_timestep_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "index of the timestep to render";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_TIME_SERIES";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 33;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_timestepSlots_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(2)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "number of timesteps kept resident on the device";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_TIME_SERIES";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 33;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_timestepLookahead_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(1)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "number of timesteps prefetched ahead of playback";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_TIME_SERIES";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 33;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 72:
+         return ANARI_SPATIAL_FIELD_structuredRegular_name_info(paramType, infoName, infoType);
+      case 34:
+         return ANARI_SPATIAL_FIELD_structuredRegular_data_info(paramType, infoName, infoType);
+      case 77:
+         return ANARI_SPATIAL_FIELD_structuredRegular_origin_info(paramType, infoName, infoType);
+      case 104:
+         return ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(paramType, infoName, infoType);
+      case 43:
+         return ANARI_SPATIAL_FIELD_structuredRegular_filter_info(paramType, infoName, infoType);
+      case 115:
+         return ANARI_SPATIAL_FIELD_structuredRegular_timesteps_info(paramType, infoName, infoType);
+      case 112:
+         return ANARI_SPATIAL_FIELD_structuredRegular_timestep_info(paramType, infoName, infoType);
+      case 114:
+         return ANARI_SPATIAL_FIELD_structuredRegular_timestepSlots_info(paramType, infoName, infoType);
+      case 113:
+         return ANARI_SPATIAL_FIELD_structuredRegular_timestepLookahead_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_omnidirectional_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_OMNIDIRECTIONAL";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_omnidirectional_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "camera position";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_OMNIDIRECTIONAL";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_omnidirectional_direction_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, -1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "main viewing direction";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_OMNIDIRECTIONAL";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_omnidirectional_up_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 1.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "camera up direction";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_OMNIDIRECTIONAL";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_omnidirectional_imageRegion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_BOX2 && infoType == ANARI_FLOAT32_BOX2) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "region mapped to the frame";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_OMNIDIRECTIONAL";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_omnidirectional_layout_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "equirectangular";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "pixel layout";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"equirectangular", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_OMNIDIRECTIONAL";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 2;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_omnidirectional_stereoMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "none";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "stereo mode";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"none", "left", "right", "sideBySide", "topBottom", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_STEREO";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_omnidirectional_interpupillaryDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.063500f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "distance between left and right eye when stereo is enabled";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_STEREO";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_omnidirectional_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 72:
+         return ANARI_CAMERA_omnidirectional_name_info(paramType, infoName, infoType);
+      case 82:
+         return ANARI_CAMERA_omnidirectional_position_info(paramType, infoName, infoType);
+      case 37:
+         return ANARI_CAMERA_omnidirectional_direction_info(paramType, infoName, infoType);
+      case 118:
+         return ANARI_CAMERA_omnidirectional_up_info(paramType, infoName, infoType);
+      case 52:
+         return ANARI_CAMERA_omnidirectional_imageRegion_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_CAMERA_omnidirectional_layout_info(paramType, infoName, infoType);
+      case 109:
+         return ANARI_CAMERA_omnidirectional_stereoMode_info(paramType, infoName, infoType);
+      case 58:
+         return ANARI_CAMERA_omnidirectional_interpupillaryDistance_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_isosurface_field_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "structuredRegular field to extract the isosurfaces from";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_ISOSURFACE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 28;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_isosurface_isovalue_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "one or more (up to 32) isovalues";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_ISOSURFACE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 28;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_isosurface_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per isovalue color";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_ISOSURFACE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 28;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_isosurface_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per isovalue attribute0";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_ISOSURFACE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 28;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_isosurface_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per isovalue attribute1";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_ISOSURFACE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 28;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_isosurface_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per isovalue attribute2";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_ISOSURFACE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 28;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_isosurface_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per isovalue attribute3";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_ISOSURFACE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 28;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_isosurface_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 40:
+         return ANARI_GEOMETRY_isosurface_field_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_GEOMETRY_isosurface_isovalue_info(paramType, infoName, infoType);
+      case 88:
+         return ANARI_GEOMETRY_isosurface_primitive_color_info(paramType, infoName, infoType);
+      case 84:
+         return ANARI_GEOMETRY_isosurface_primitive_attribute0_info(paramType, infoName, infoType);
+      case 85:
+         return ANARI_GEOMETRY_isosurface_primitive_attribute1_info(paramType, infoName, infoType);
+      case 86:
+         return ANARI_GEOMETRY_isosurface_primitive_attribute2_info(paramType, infoName, infoType);
+      case 87:
+         return ANARI_GEOMETRY_isosurface_primitive_attribute3_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_slice_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "transferFunction1D volume to slice";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_SLICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 29;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_slice_plane_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "one or more planes (a, b, c, d) holding the points where a*x + b*y + c*z == d";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_SLICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 29;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_slice_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per plane color";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_SLICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 29;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_slice_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per plane attribute0";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_SLICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 29;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_slice_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per plane attribute1";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_SLICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 29;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_slice_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per plane attribute2";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_SLICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 29;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_slice_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per plane attribute3";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_SLICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 29;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_slice_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 136:
+         return ANARI_GEOMETRY_slice_volume_info(paramType, infoName, infoType);
+      case 81:
+         return ANARI_GEOMETRY_slice_plane_info(paramType, infoName, infoType);
+      case 88:
+         return ANARI_GEOMETRY_slice_primitive_color_info(paramType, infoName, infoType);
+      case 84:
+         return ANARI_GEOMETRY_slice_primitive_attribute0_info(paramType, infoName, infoType);
+      case 85:
+         return ANARI_GEOMETRY_slice_primitive_attribute1_info(paramType, infoName, infoType);
+      case 86:
+         return ANARI_GEOMETRY_slice_primitive_attribute2_info(paramType, infoName, infoType);
+      case 87:
+         return ANARI_GEOMETRY_slice_primitive_attribute3_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_dimensions_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "number of voxels in each dimension";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 32;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_origin_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "position of the first voxel";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 32;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_spacing_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "distance between voxels";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 32;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "linear";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "filter used for sampling, linear or nearest";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 32;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_brickCallback_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "VisRTXBrickCallback filling the voxels of a brick";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 32;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_brickCallbackUserData_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "userData passed to brickCallback";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 32;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_filename_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "raw file with the voxels, x-fastest, read when brickCallback is not set";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 32;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_format_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE) {
+            static const ANARIDataType default_value[1] = {ANARI_FLOAT32};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "element type of the voxels in the file";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 32;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_fileOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "byte offset of the first voxel in the file";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 32;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_brickSize_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(32)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "number of cells along each edge of a brick";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 32;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_cacheSize_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -9170,29 +11132,29 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataT
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(512)};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "origin of the grid in object-space";
+            static const char *description = "number of bricks held by the cache on the GPU";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 23;
+            static const int32_t value = 32;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_loadsPerFrame_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -9202,29 +11164,29 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIData
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(64)};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "size of the grid cells in object-space";
+            static const char *description = "most bricks loaded before rendering a frame";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 23;
+            static const int32_t value = 32;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_valueRange_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -9233,58 +11195,62 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataT
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "linear";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "filter mode used to interpolate the grid";
+            static const char *description = "range of the voxel values, enables space skipping";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"nearest", "linear", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 23;
+            static const int32_t value = 32;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 53:
-         return ANARI_SPATIAL_FIELD_structuredRegular_name_info(paramType, infoName, infoType);
-      case 25:
-         return ANARI_SPATIAL_FIELD_structuredRegular_data_info(paramType, infoName, infoType);
-      case 58:
-         return ANARI_SPATIAL_FIELD_structuredRegular_origin_info(paramType, infoName, infoType);
-      case 80:
-         return ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(paramType, infoName, infoType);
-      case 30:
-         return ANARI_SPATIAL_FIELD_structuredRegular_filter_info(paramType, infoName, infoType);
+      case 36:
+         return ANARI_SPATIAL_FIELD_streamedRegular_dimensions_info(paramType, infoName, infoType);
+      case 77:
+         return ANARI_SPATIAL_FIELD_streamedRegular_origin_info(paramType, infoName, infoType);
+      case 104:
+         return ANARI_SPATIAL_FIELD_streamedRegular_spacing_info(paramType, infoName, infoType);
+      case 43:
+         return ANARI_SPATIAL_FIELD_streamedRegular_filter_info(paramType, infoName, infoType);
+      case 18:
+         return ANARI_SPATIAL_FIELD_streamedRegular_brickCallback_info(paramType, infoName, infoType);
+      case 19:
+         return ANARI_SPATIAL_FIELD_streamedRegular_brickCallbackUserData_info(paramType, infoName, infoType);
+      case 42:
+         return ANARI_SPATIAL_FIELD_streamedRegular_filename_info(paramType, infoName, infoType);
+      case 45:
+         return ANARI_SPATIAL_FIELD_streamedRegular_format_info(paramType, infoName, infoType);
+      case 41:
+         return ANARI_SPATIAL_FIELD_streamedRegular_fileOffset_info(paramType, infoName, infoType);
+      case 20:
+         return ANARI_SPATIAL_FIELD_streamedRegular_brickSize_info(paramType, infoName, infoType);
+      case 21:
+         return ANARI_SPATIAL_FIELD_streamedRegular_cacheSize_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_SPATIAL_FIELD_streamedRegular_loadsPerFrame_info(paramType, infoName, infoType);
+      case 119:
+         return ANARI_SPATIAL_FIELD_streamedRegular_valueRange_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
 static const void * ANARI_CAMERA_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 12:
+      case 14:
          return ANARI_CAMERA_orthographic_param_info(paramName, paramType, infoName, infoType);
-      case 13:
+      case 15:
          return ANARI_CAMERA_perspective_param_info(paramName, paramType, infoName, infoType);
+      case 13:
+         return ANARI_CAMERA_omnidirectional_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -9297,12 +11263,16 @@ static const void * ANARI_GEOMETRY_param_info(const char *subtype, const char *p
          return ANARI_GEOMETRY_curve_param_info(paramName, paramType, infoName, infoType);
       case 4:
          return ANARI_GEOMETRY_cylinder_param_info(paramName, paramType, infoName, infoType);
-      case 17:
+      case 19:
          return ANARI_GEOMETRY_quad_param_info(paramName, paramType, infoName, infoType);
-      case 20:
-         return ANARI_GEOMETRY_sphere_param_info(paramName, paramType, infoName, infoType);
       case 23:
+         return ANARI_GEOMETRY_sphere_param_info(paramName, paramType, infoName, infoType);
+      case 27:
          return ANARI_GEOMETRY_triangle_param_info(paramName, paramType, infoName, infoType);
+      case 11:
+         return ANARI_GEOMETRY_isosurface_param_info(paramName, paramType, infoName, infoType);
+      case 22:
+         return ANARI_GEOMETRY_slice_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -9311,7 +11281,7 @@ static const void * ANARI_INSTANCE_param_info(const char *subtype, const char *p
    switch(subtype_hash(subtype)) {
       case 0:
          return ANARI_INSTANCE__param_info(paramName, paramType, infoName, infoType);
-      case 22:
+      case 26:
          return ANARI_INSTANCE_transform_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -9321,7 +11291,7 @@ static const void * ANARI_LIGHT_param_info(const char *subtype, const char *para
    switch(subtype_hash(subtype)) {
       case 7:
          return ANARI_LIGHT_directional_param_info(paramName, paramType, infoName, infoType);
-      case 15:
+      case 17:
          return ANARI_LIGHT_point_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -9329,9 +11299,9 @@ static const void * ANARI_LIGHT_param_info(const char *subtype, const char *para
 }
 static const void * ANARI_MATERIAL_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 11:
+      case 12:
          return ANARI_MATERIAL_matte_param_info(paramName, paramType, infoName, infoType);
-      case 14:
+      case 16:
          return ANARI_MATERIAL_physicallyBased_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -9341,13 +11311,13 @@ static const void * ANARI_RENDERER_param_info(const char *subtype, const char *p
    switch(subtype_hash(subtype)) {
       case 6:
          return ANARI_RENDERER_default_param_info(paramName, paramType, infoName, infoType);
-      case 19:
+      case 21:
          return ANARI_RENDERER_scivis_param_info(paramName, paramType, infoName, infoType);
       case 1:
          return ANARI_RENDERER_ao_param_info(paramName, paramType, infoName, infoType);
       case 8:
          return ANARI_RENDERER_dpt_param_info(paramName, paramType, infoName, infoType);
-      case 18:
+      case 20:
          return ANARI_RENDERER_raycast_param_info(paramName, paramType, infoName, infoType);
       case 5:
          return ANARI_RENDERER_debug_param_info(paramName, paramType, infoName, infoType);
@@ -9361,9 +11331,9 @@ static const void * ANARI_SAMPLER_param_info(const char *subtype, const char *pa
          return ANARI_SAMPLER_image1D_param_info(paramName, paramType, infoName, infoType);
       case 10:
          return ANARI_SAMPLER_image2D_param_info(paramName, paramType, infoName, infoType);
-      case 16:
+      case 18:
          return ANARI_SAMPLER_primitive_param_info(paramName, paramType, infoName, infoType);
-      case 22:
+      case 26:
          return ANARI_SAMPLER_transform_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
@@ -9371,8 +11341,10 @@ static const void * ANARI_SAMPLER_param_info(const char *subtype, const char *pa
 }
 static const void * ANARI_SPATIAL_FIELD_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 21:
+      case 25:
          return ANARI_SPATIAL_FIELD_structuredRegular_param_info(paramName, paramType, infoName, infoType);
+      case 24:
+         return ANARI_SPATIAL_FIELD_streamedRegular_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -9461,8 +11433,11 @@ static const void * ANARI_RENDERER_default_info(int infoName, ANARIDataType info
          if(infoType == ANARI_STRING_LIST) {
             static const char *extensions[] = {
                "ANARI_KHR_ARRAY1D_REGION",
+               "ANARI_KHR_CAMERA_DEPTH_OF_FIELD",
+               "ANARI_KHR_CAMERA_OMNIDIRECTIONAL",
                "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
                "ANARI_KHR_CAMERA_PERSPECTIVE",
+               "ANARI_KHR_CAMERA_STEREO",
                "ANARI_KHR_DEVICE_SYNCHRONIZATION",
                "ANARI_KHR_FRAME_ACCUMULATION",
                "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
@@ -9485,6 +11460,12 @@ static const void * ANARI_RENDERER_default_info(int infoName, ANARIDataType info
                "ANARI_KHR_SAMPLER_TRANSFORM",
                "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
                "ANARI_VISRTX_CUDA_OUTPUT_BUFFERS",
+               "ANARI_VISRTX_GEOMETRY_ISOSURFACE",
+               "ANARI_VISRTX_GEOMETRY_SLICE",
+               "ANARI_VISRTX_INSTANCE_TRANSFORM_ARRAY",
+               "ANARI_VISRTX_RAY_QUERY",
+               "ANARI_VISRTX_SPATIAL_FIELD_STREAMED_REGULAR",
+               "ANARI_VISRTX_TIME_SERIES",
                0
             };
             return extensions;
@@ -9520,8 +11501,11 @@ static const void * ANARI_RENDERER_scivis_info(int infoName, ANARIDataType infoT
          if(infoType == ANARI_STRING_LIST) {
             static const char *extensions[] = {
                "ANARI_KHR_ARRAY1D_REGION",
+               "ANARI_KHR_CAMERA_DEPTH_OF_FIELD",
+               "ANARI_KHR_CAMERA_OMNIDIRECTIONAL",
                "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
                "ANARI_KHR_CAMERA_PERSPECTIVE",
+               "ANARI_KHR_CAMERA_STEREO",
                "ANARI_KHR_DEVICE_SYNCHRONIZATION",
                "ANARI_KHR_FRAME_ACCUMULATION",
                "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
@@ -9544,6 +11528,12 @@ static const void * ANARI_RENDERER_scivis_info(int infoName, ANARIDataType infoT
                "ANARI_KHR_SAMPLER_TRANSFORM",
                "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
                "ANARI_VISRTX_CUDA_OUTPUT_BUFFERS",
+               "ANARI_VISRTX_GEOMETRY_ISOSURFACE",
+               "ANARI_VISRTX_GEOMETRY_SLICE",
+               "ANARI_VISRTX_INSTANCE_TRANSFORM_ARRAY",
+               "ANARI_VISRTX_RAY_QUERY",
+               "ANARI_VISRTX_SPATIAL_FIELD_STREAMED_REGULAR",
+               "ANARI_VISRTX_TIME_SERIES",
                0
             };
             return extensions;
@@ -9578,8 +11568,11 @@ static const void * ANARI_RENDERER_ao_info(int infoName, ANARIDataType infoType)
          if(infoType == ANARI_STRING_LIST) {
             static const char *extensions[] = {
                "ANARI_KHR_ARRAY1D_REGION",
+               "ANARI_KHR_CAMERA_DEPTH_OF_FIELD",
+               "ANARI_KHR_CAMERA_OMNIDIRECTIONAL",
                "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
                "ANARI_KHR_CAMERA_PERSPECTIVE",
+               "ANARI_KHR_CAMERA_STEREO",
                "ANARI_KHR_DEVICE_SYNCHRONIZATION",
                "ANARI_KHR_FRAME_ACCUMULATION",
                "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
@@ -9602,6 +11595,12 @@ static const void * ANARI_RENDERER_ao_info(int infoName, ANARIDataType infoType)
                "ANARI_KHR_SAMPLER_TRANSFORM",
                "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
                "ANARI_VISRTX_CUDA_OUTPUT_BUFFERS",
+               "ANARI_VISRTX_GEOMETRY_ISOSURFACE",
+               "ANARI_VISRTX_GEOMETRY_SLICE",
+               "ANARI_VISRTX_INSTANCE_TRANSFORM_ARRAY",
+               "ANARI_VISRTX_RAY_QUERY",
+               "ANARI_VISRTX_SPATIAL_FIELD_STREAMED_REGULAR",
+               "ANARI_VISRTX_TIME_SERIES",
                0
             };
             return extensions;
@@ -9631,8 +11630,11 @@ static const void * ANARI_RENDERER_dpt_info(int infoName, ANARIDataType infoType
          if(infoType == ANARI_STRING_LIST) {
             static const char *extensions[] = {
                "ANARI_KHR_ARRAY1D_REGION",
+               "ANARI_KHR_CAMERA_DEPTH_OF_FIELD",
+               "ANARI_KHR_CAMERA_OMNIDIRECTIONAL",
                "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
                "ANARI_KHR_CAMERA_PERSPECTIVE",
+               "ANARI_KHR_CAMERA_STEREO",
                "ANARI_KHR_DEVICE_SYNCHRONIZATION",
                "ANARI_KHR_FRAME_ACCUMULATION",
                "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
@@ -9655,6 +11657,12 @@ static const void * ANARI_RENDERER_dpt_info(int infoName, ANARIDataType infoType
                "ANARI_KHR_SAMPLER_TRANSFORM",
                "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
                "ANARI_VISRTX_CUDA_OUTPUT_BUFFERS",
+               "ANARI_VISRTX_GEOMETRY_ISOSURFACE",
+               "ANARI_VISRTX_GEOMETRY_SLICE",
+               "ANARI_VISRTX_INSTANCE_TRANSFORM_ARRAY",
+               "ANARI_VISRTX_RAY_QUERY",
+               "ANARI_VISRTX_SPATIAL_FIELD_STREAMED_REGULAR",
+               "ANARI_VISRTX_TIME_SERIES",
                0
             };
             return extensions;
@@ -9685,8 +11693,11 @@ static const void * ANARI_RENDERER_raycast_info(int infoName, ANARIDataType info
          if(infoType == ANARI_STRING_LIST) {
             static const char *extensions[] = {
                "ANARI_KHR_ARRAY1D_REGION",
+               "ANARI_KHR_CAMERA_DEPTH_OF_FIELD",
+               "ANARI_KHR_CAMERA_OMNIDIRECTIONAL",
                "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
                "ANARI_KHR_CAMERA_PERSPECTIVE",
+               "ANARI_KHR_CAMERA_STEREO",
                "ANARI_KHR_DEVICE_SYNCHRONIZATION",
                "ANARI_KHR_FRAME_ACCUMULATION",
                "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
@@ -9709,6 +11720,12 @@ static const void * ANARI_RENDERER_raycast_info(int infoName, ANARIDataType info
                "ANARI_KHR_SAMPLER_TRANSFORM",
                "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
                "ANARI_VISRTX_CUDA_OUTPUT_BUFFERS",
+               "ANARI_VISRTX_GEOMETRY_ISOSURFACE",
+               "ANARI_VISRTX_GEOMETRY_SLICE",
+               "ANARI_VISRTX_INSTANCE_TRANSFORM_ARRAY",
+               "ANARI_VISRTX_RAY_QUERY",
+               "ANARI_VISRTX_SPATIAL_FIELD_STREAMED_REGULAR",
+               "ANARI_VISRTX_TIME_SERIES",
                0
             };
             return extensions;
@@ -9740,8 +11757,11 @@ static const void * ANARI_RENDERER_debug_info(int infoName, ANARIDataType infoTy
          if(infoType == ANARI_STRING_LIST) {
             static const char *extensions[] = {
                "ANARI_KHR_ARRAY1D_REGION",
+               "ANARI_KHR_CAMERA_DEPTH_OF_FIELD",
+               "ANARI_KHR_CAMERA_OMNIDIRECTIONAL",
                "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
                "ANARI_KHR_CAMERA_PERSPECTIVE",
+               "ANARI_KHR_CAMERA_STEREO",
                "ANARI_KHR_DEVICE_SYNCHRONIZATION",
                "ANARI_KHR_FRAME_ACCUMULATION",
                "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
@@ -9764,6 +11784,12 @@ static const void * ANARI_RENDERER_debug_info(int infoName, ANARIDataType infoTy
                "ANARI_KHR_SAMPLER_TRANSFORM",
                "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
                "ANARI_VISRTX_CUDA_OUTPUT_BUFFERS",
+               "ANARI_VISRTX_GEOMETRY_ISOSURFACE",
+               "ANARI_VISRTX_GEOMETRY_SLICE",
+               "ANARI_VISRTX_INSTANCE_TRANSFORM_ARRAY",
+               "ANARI_VISRTX_RAY_QUERY",
+               "ANARI_VISRTX_SPATIAL_FIELD_STREAMED_REGULAR",
+               "ANARI_VISRTX_TIME_SERIES",
                0
             };
             return extensions;
@@ -9796,8 +11822,11 @@ static const void * ANARI_DEVICE_info(int infoName, ANARIDataType infoType) {
          if(infoType == ANARI_STRING_LIST) {
             static const char *extensions[] = {
                "ANARI_KHR_ARRAY1D_REGION",
+               "ANARI_KHR_CAMERA_DEPTH_OF_FIELD",
+               "ANARI_KHR_CAMERA_OMNIDIRECTIONAL",
                "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
                "ANARI_KHR_CAMERA_PERSPECTIVE",
+               "ANARI_KHR_CAMERA_STEREO",
                "ANARI_KHR_DEVICE_SYNCHRONIZATION",
                "ANARI_KHR_FRAME_ACCUMULATION",
                "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
@@ -9820,6 +11849,12 @@ static const void * ANARI_DEVICE_info(int infoName, ANARIDataType infoType) {
                "ANARI_KHR_SAMPLER_TRANSFORM",
                "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
                "ANARI_VISRTX_CUDA_OUTPUT_BUFFERS",
+               "ANARI_VISRTX_GEOMETRY_ISOSURFACE",
+               "ANARI_VISRTX_GEOMETRY_SLICE",
+               "ANARI_VISRTX_INSTANCE_TRANSFORM_ARRAY",
+               "ANARI_VISRTX_RAY_QUERY",
+               "ANARI_VISRTX_SPATIAL_FIELD_STREAMED_REGULAR",
+               "ANARI_VISRTX_TIME_SERIES",
                0
             };
             return extensions;
@@ -9972,6 +12007,10 @@ static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
                {"surface", ANARI_ARRAY1D},
                {"volume", ANARI_ARRAY1D},
                {"light", ANARI_ARRAY1D},
+               {"rayQuery.rays", ANARI_VOID_POINTER},
+               {"rayQuery.hits", ANARI_VOID_POINTER},
+               {"rayQuery.count", ANARI_UINT64},
+               {"rayQuery.anyHit", ANARI_BOOL},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -10023,6 +12062,10 @@ static const void * ANARI_CAMERA_orthographic_info(int infoName, ANARIDataType i
                {"height", ANARI_FLOAT32},
                {"near", ANARI_FLOAT32},
                {"far", ANARI_FLOAT32},
+               {"apertureRadius", ANARI_FLOAT32},
+               {"focusDistance", ANARI_FLOAT32},
+               {"stereoMode", ANARI_STRING},
+               {"interpupillaryDistance", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -10034,7 +12077,7 @@ static const void * ANARI_CAMERA_orthographic_info(int infoName, ANARIDataType i
             static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 1;
+            static const int value = 3;
             return &value;
          } else {
             return nullptr;
@@ -10061,6 +12104,10 @@ static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType in
                {"aspect", ANARI_FLOAT32},
                {"near", ANARI_FLOAT32},
                {"far", ANARI_FLOAT32},
+               {"apertureRadius", ANARI_FLOAT32},
+               {"focusDistance", ANARI_FLOAT32},
+               {"stereoMode", ANARI_STRING},
+               {"interpupillaryDistance", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -10072,7 +12119,7 @@ static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType in
             static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 2;
+            static const int value = 4;
             return &value;
          } else {
             return nullptr;
@@ -10097,7 +12144,7 @@ static const void * ANARI_VOLUME__info(int infoName, ANARIDataType infoType) {
             static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 6;
+            static const int value = 9;
             return &value;
          } else {
             return nullptr;
@@ -10122,7 +12169,7 @@ static const void * ANARI_INSTANCE__info(int infoName, ANARIDataType infoType) {
             static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 7;
+            static const int value = 10;
             return &value;
          } else {
             return nullptr;
@@ -10168,7 +12215,7 @@ static const void * ANARI_GEOMETRY_cone_info(int infoName, ANARIDataType infoTyp
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 8;
+            static const int value = 11;
             return &value;
          } else {
             return nullptr;
@@ -10213,7 +12260,7 @@ static const void * ANARI_GEOMETRY_curve_info(int infoName, ANARIDataType infoTy
             static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 9;
+            static const int value = 12;
             return &value;
          } else {
             return nullptr;
@@ -10260,7 +12307,7 @@ static const void * ANARI_GEOMETRY_cylinder_info(int infoName, ANARIDataType inf
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 10;
+            static const int value = 13;
             return &value;
          } else {
             return nullptr;
@@ -10305,7 +12352,7 @@ static const void * ANARI_GEOMETRY_quad_info(int infoName, ANARIDataType infoTyp
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 11;
+            static const int value = 14;
             return &value;
          } else {
             return nullptr;
@@ -10350,7 +12397,7 @@ static const void * ANARI_GEOMETRY_sphere_info(int infoName, ANARIDataType infoT
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 12;
+            static const int value = 15;
             return &value;
          } else {
             return nullptr;
@@ -10401,7 +12448,7 @@ static const void * ANARI_GEOMETRY_triangle_info(int infoName, ANARIDataType inf
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 13;
+            static const int value = 16;
             return &value;
          } else {
             return nullptr;
@@ -10421,7 +12468,14 @@ static const void * ANARI_INSTANCE_transform_info(int infoName, ANARIDataType in
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
                {"transform", ANARI_FLOAT32_MAT4},
+               {"transform", ANARI_ARRAY1D},
                {"group", ANARI_GROUP},
+               {"id", ANARI_ARRAY1D},
+               {"attribute0", ANARI_ARRAY1D},
+               {"attribute1", ANARI_ARRAY1D},
+               {"attribute2", ANARI_ARRAY1D},
+               {"attribute3", ANARI_ARRAY1D},
+               {"color", ANARI_ARRAY1D},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -10433,7 +12487,7 @@ static const void * ANARI_INSTANCE_transform_info(int infoName, ANARIDataType in
             static const char *extension = "KHR_INSTANCE_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 14;
+            static const int value = 17;
             return &value;
          } else {
             return nullptr;
@@ -10466,7 +12520,7 @@ static const void * ANARI_LIGHT_directional_info(int infoName, ANARIDataType inf
             static const char *extension = "KHR_LIGHT_DIRECTIONAL";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 15;
+            static const int value = 18;
             return &value;
          } else {
             return nullptr;
@@ -10500,7 +12554,7 @@ static const void * ANARI_LIGHT_point_info(int infoName, ANARIDataType infoType)
             static const char *extension = "KHR_LIGHT_POINT";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 16;
+            static const int value = 19;
             return &value;
          } else {
             return nullptr;
@@ -10538,7 +12592,7 @@ static const void * ANARI_MATERIAL_matte_info(int infoName, ANARIDataType infoTy
             static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 17;
+            static const int value = 20;
             return &value;
          } else {
             return nullptr;
@@ -10624,7 +12678,7 @@ static const void * ANARI_MATERIAL_physicallyBased_info(int infoName, ANARIDataT
             static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 18;
+            static const int value = 21;
             return &value;
          } else {
             return nullptr;
@@ -10662,7 +12716,7 @@ static const void * ANARI_SAMPLER_image1D_info(int infoName, ANARIDataType infoT
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 19;
+            static const int value = 22;
             return &value;
          } else {
             return nullptr;
@@ -10701,7 +12755,7 @@ static const void * ANARI_SAMPLER_image2D_info(int infoName, ANARIDataType infoT
             static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 20;
+            static const int value = 23;
             return &value;
          } else {
             return nullptr;
@@ -10733,7 +12787,7 @@ static const void * ANARI_SAMPLER_primitive_info(int infoName, ANARIDataType inf
             static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 21;
+            static const int value = 24;
             return &value;
          } else {
             return nullptr;
@@ -10766,7 +12820,7 @@ static const void * ANARI_SAMPLER_transform_info(int infoName, ANARIDataType inf
             static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 22;
+            static const int value = 25;
             return &value;
          } else {
             return nullptr;
@@ -10789,6 +12843,10 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_info(int infoName, ANA
                {"origin", ANARI_FLOAT32_VEC3},
                {"spacing", ANARI_FLOAT32_VEC3},
                {"filter", ANARI_STRING},
+               {"timesteps", ANARI_ARRAY1D},
+               {"timestep", ANARI_UINT32},
+               {"timestepSlots", ANARI_UINT32},
+               {"timestepLookahead", ANARI_UINT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -10800,7 +12858,145 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_info(int infoName, ANA
             static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 23;
+            static const int value = 26;
+            return &value;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_omnidirectional_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "omnidirectional camera object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {"position", ANARI_FLOAT32_VEC3},
+               {"direction", ANARI_FLOAT32_VEC3},
+               {"up", ANARI_FLOAT32_VEC3},
+               {"imageRegion", ANARI_FLOAT32_BOX2},
+               {"layout", ANARI_STRING},
+               {"stereoMode", ANARI_STRING},
+               {"interpupillaryDistance", ANARI_FLOAT32},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_OMNIDIRECTIONAL";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 2;
+            return &value;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_isosurface_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"field", ANARI_SPATIAL_FIELD},
+               {"isovalue", ANARI_FLOAT32},
+               {"isovalue", ANARI_ARRAY1D},
+               {"primitive.color", ANARI_ARRAY1D},
+               {"primitive.attribute0", ANARI_ARRAY1D},
+               {"primitive.attribute1", ANARI_ARRAY1D},
+               {"primitive.attribute2", ANARI_ARRAY1D},
+               {"primitive.attribute3", ANARI_ARRAY1D},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_ISOSURFACE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 28;
+            return &value;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_slice_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"volume", ANARI_VOLUME},
+               {"plane", ANARI_FLOAT32_VEC4},
+               {"plane", ANARI_ARRAY1D},
+               {"primitive.color", ANARI_ARRAY1D},
+               {"primitive.attribute0", ANARI_ARRAY1D},
+               {"primitive.attribute1", ANARI_ARRAY1D},
+               {"primitive.attribute2", ANARI_ARRAY1D},
+               {"primitive.attribute3", ANARI_ARRAY1D},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_GEOMETRY_SLICE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 29;
+            return &value;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_streamedRegular_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"dimensions", ANARI_UINT32_VEC3},
+               {"origin", ANARI_FLOAT32_VEC3},
+               {"spacing", ANARI_FLOAT32_VEC3},
+               {"filter", ANARI_STRING},
+               {"brickCallback", ANARI_VOID_POINTER},
+               {"brickCallbackUserData", ANARI_VOID_POINTER},
+               {"filename", ANARI_STRING},
+               {"format", ANARI_DATA_TYPE},
+               {"fileOffset", ANARI_UINT64},
+               {"brickSize", ANARI_UINT32},
+               {"cacheSize", ANARI_UINT32},
+               {"loadsPerFrame", ANARI_UINT32},
+               {"valueRange", ANARI_FLOAT32_BOX1},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "VISRTX_SPATIAL_FIELD_STREAMED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 32;
             return &value;
          } else {
             return nullptr;
@@ -10810,10 +13006,12 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_info(int infoName, ANA
 }
 static const void * ANARI_CAMERA_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 12:
+      case 14:
          return ANARI_CAMERA_orthographic_info(infoName, infoType);
-      case 13:
+      case 15:
          return ANARI_CAMERA_perspective_info(infoName, infoType);
+      case 13:
+         return ANARI_CAMERA_omnidirectional_info(infoName, infoType);
       default:
          return nullptr;
    }
@@ -10826,12 +13024,16 @@ static const void * ANARI_GEOMETRY_info(const char *subtype, int infoName, ANARI
          return ANARI_GEOMETRY_curve_info(infoName, infoType);
       case 4:
          return ANARI_GEOMETRY_cylinder_info(infoName, infoType);
-      case 17:
+      case 19:
          return ANARI_GEOMETRY_quad_info(infoName, infoType);
-      case 20:
-         return ANARI_GEOMETRY_sphere_info(infoName, infoType);
       case 23:
+         return ANARI_GEOMETRY_sphere_info(infoName, infoType);
+      case 27:
          return ANARI_GEOMETRY_triangle_info(infoName, infoType);
+      case 11:
+         return ANARI_GEOMETRY_isosurface_info(infoName, infoType);
+      case 22:
+         return ANARI_GEOMETRY_slice_info(infoName, infoType);
       default:
          return nullptr;
    }
@@ -10840,7 +13042,7 @@ static const void * ANARI_INSTANCE_info(const char *subtype, int infoName, ANARI
    switch(subtype_hash(subtype)) {
       case 0:
          return ANARI_INSTANCE__info(infoName, infoType);
-      case 22:
+      case 26:
          return ANARI_INSTANCE_transform_info(infoName, infoType);
       default:
          return nullptr;
@@ -10850,7 +13052,7 @@ static const void * ANARI_LIGHT_info(const char *subtype, int infoName, ANARIDat
    switch(subtype_hash(subtype)) {
       case 7:
          return ANARI_LIGHT_directional_info(infoName, infoType);
-      case 15:
+      case 17:
          return ANARI_LIGHT_point_info(infoName, infoType);
       default:
          return nullptr;
@@ -10858,9 +13060,9 @@ static const void * ANARI_LIGHT_info(const char *subtype, int infoName, ANARIDat
 }
 static const void * ANARI_MATERIAL_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 11:
+      case 12:
          return ANARI_MATERIAL_matte_info(infoName, infoType);
-      case 14:
+      case 16:
          return ANARI_MATERIAL_physicallyBased_info(infoName, infoType);
       default:
          return nullptr;
@@ -10870,13 +13072,13 @@ static const void * ANARI_RENDERER_info(const char *subtype, int infoName, ANARI
    switch(subtype_hash(subtype)) {
       case 6:
          return ANARI_RENDERER_default_info(infoName, infoType);
-      case 19:
+      case 21:
          return ANARI_RENDERER_scivis_info(infoName, infoType);
       case 1:
          return ANARI_RENDERER_ao_info(infoName, infoType);
       case 8:
          return ANARI_RENDERER_dpt_info(infoName, infoType);
-      case 18:
+      case 20:
          return ANARI_RENDERER_raycast_info(infoName, infoType);
       case 5:
          return ANARI_RENDERER_debug_info(infoName, infoType);
@@ -10890,9 +13092,9 @@ static const void * ANARI_SAMPLER_info(const char *subtype, int infoName, ANARID
          return ANARI_SAMPLER_image1D_info(infoName, infoType);
       case 10:
          return ANARI_SAMPLER_image2D_info(infoName, infoType);
-      case 16:
+      case 18:
          return ANARI_SAMPLER_primitive_info(infoName, infoType);
-      case 22:
+      case 26:
          return ANARI_SAMPLER_transform_info(infoName, infoType);
       default:
          return nullptr;
@@ -10900,8 +13102,10 @@ static const void * ANARI_SAMPLER_info(const char *subtype, int infoName, ANARID
 }
 static const void * ANARI_SPATIAL_FIELD_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 21:
+      case 25:
          return ANARI_SPATIAL_FIELD_structuredRegular_info(infoName, infoType);
+      case 24:
+         return ANARI_SPATIAL_FIELD_streamedRegular_info(infoName, infoType);
       default:
          return nullptr;
    }
@@ -46,8 +46,20 @@ static void fillExtensionStruct(
       extensions->VISRTX_ARRAY1D_DYNAMIC_REGION = 1;
     else if (feature == "ANARI_VISRTX_CUDA_OUTPUT_BUFFERS")
       extensions->VISRTX_CUDA_OUTPUT_BUFFERS = 1;
+    else if (feature == "ANARI_VISRTX_GEOMETRY_ISOSURFACE")
+      extensions->VISRTX_GEOMETRY_ISOSURFACE = 1;
+    else if (feature == "ANARI_VISRTX_GEOMETRY_SLICE")
+      extensions->VISRTX_GEOMETRY_SLICE = 1;
+    else if (feature == "ANARI_VISRTX_INSTANCE_TRANSFORM_ARRAY")
+      extensions->VISRTX_INSTANCE_TRANSFORM_ARRAY = 1;
+    else if (feature == "ANARI_VISRTX_RAY_QUERY")
+      extensions->VISRTX_RAY_QUERY = 1;
     else if (feature == "ANARI_VISRTX_SAMPLER_COLOR_MAP")
       extensions->VISRTX_SAMPLER_COLOR_MAP = 1;
+    else if (feature == "ANARI_VISRTX_SPATIAL_FIELD_STREAMED_REGULAR")
+      extensions->VISRTX_SPATIAL_FIELD_STREAMED_REGULAR = 1;
+    else if (feature == "ANARI_VISRTX_TIME_SERIES")
+      extensions->VISRTX_TIME_SERIES = 1;
     else if (feature == "ANARI_VISRTX_TRIANGLE_ATTRIBUTE_INDEXING")
       extensions->VISRTX_TRIANGLE_ATTRIBUTE_INDEXING = 1;
   }
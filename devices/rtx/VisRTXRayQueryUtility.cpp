@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "anari/ext/visrtx/visrtx.h"
+
+namespace visrtx {
+
+extern "C" VISRTX_DEVICE_INTERFACE int visrtxTraceRays(ANARIDevice device,
+    ANARIWorld world,
+    const VisRTXRay *rays,
+    VisRTXRayHit *hits,
+    uint64_t numRays,
+    int anyHit)
+{
+  anariSetParameter(
+      device, world, "rayQuery.rays", ANARI_VOID_POINTER, (const void *)rays);
+  anariSetParameter(
+      device, world, "rayQuery.hits", ANARI_VOID_POINTER, (const void *)hits);
+  anariSetParameter(device, world, "rayQuery.count", ANARI_UINT64, &numRays);
+  anari::setParameter(device, world, "rayQuery.anyHit", anyHit != 0);
+
+  bool traced = false;
+  anariGetProperty(device,
+      world,
+      "rayQuery",
+      ANARI_BOOL,
+      &traced,
+      sizeof(traced),
+      ANARI_WAIT);
+
+  // Don't keep application pointers around after the query
+  anariUnsetParameter(device, world, "rayQuery.rays");
+  anariUnsetParameter(device, world, "rayQuery.hits");
+
+  return traced ? 1 : 0;
+}
+
+VISRTX_DEVICE_INTERFACE bool traceRays(anari::Device d,
+    anari::World w,
+    const VisRTXRay *rays,
+    VisRTXRayHit *hits,
+    uint64_t numRays,
+    bool anyHit)
+{
+  return visrtxTraceRays(d, w, rays, hits, numRays, anyHit) != 0;
+}
+
+} // namespace visrtx
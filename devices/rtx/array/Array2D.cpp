@@ -79,6 +79,25 @@ void Array2D::releaseCUDAArrayUint8()
   }
 }
 
+cudaMipmappedArray_t Array2D::acquireCUDAMipmappedArrayFloat()
+{
+  if (!m_cuMipmappedArrayFloat) {
+    makeCudaMipmappedArrayFloat(
+        m_cuMipmappedArrayFloat, *this, uvec2(size().x, size().y));
+  }
+  m_arrayRefCountMipmappedFloat++;
+  return m_cuMipmappedArrayFloat;
+}
+
+void Array2D::releaseCUDAMipmappedArrayFloat()
+{
+  m_arrayRefCountMipmappedFloat--;
+  if (m_arrayRefCountMipmappedFloat == 0) {
+    cudaFreeMipmappedArray(m_cuMipmappedArrayFloat);
+    m_cuMipmappedArrayFloat = {};
+  }
+}
+
 void Array2D::uploadArrayData() const
 {
   helium::Array2D::uploadArrayData();
@@ -88,6 +107,10 @@ void Array2D::uploadArrayData() const
     makeCudaArrayFloat(m_cuArrayFloat, *this, uvec2(size().x, size().y));
   if (m_cuArrayUint8)
     makeCudaArrayUint8(m_cuArrayUint8, *this, uvec2(size().x, size().y));
+  if (m_cuMipmappedArrayFloat) {
+    makeCudaMipmappedArrayFloat(
+        m_cuMipmappedArrayFloat, *this, uvec2(size().x, size().y));
+  }
 }
 
 } // namespace visrtx
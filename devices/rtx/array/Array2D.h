@@ -51,6 +51,9 @@ struct Array2D : public helium::Array2D, GPUArray
   cudaArray_t acquireCUDAArrayUint8();
   void releaseCUDAArrayUint8();
 
+  cudaMipmappedArray_t acquireCUDAMipmappedArrayFloat();
+  void releaseCUDAMipmappedArrayFloat();
+
   void uploadArrayData() const override;
 };
 
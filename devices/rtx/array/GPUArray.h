@@ -61,6 +61,8 @@ struct GPUArray
   size_t m_arrayRefCountFloat{0};
   mutable cudaArray_t m_cuArrayUint8{};
   size_t m_arrayRefCountUint8{0};
+  mutable cudaMipmappedArray_t m_cuMipmappedArrayFloat{};
+  size_t m_arrayRefCountMipmappedFloat{0};
 };
 
 } // namespace visrtx
@@ -30,6 +30,11 @@
  */
 
 #include "array/ObjectArray.h"
+// thrust
+#include <thrust/copy.h>
+// std
+#include <algorithm>
+#include <vector>
 
 namespace visrtx {
 
@@ -40,6 +45,8 @@ ObjectArray::ObjectArray(
 
 const void *ObjectArray::dataGPU() const
 {
+  uploadArrayData();
+  syncGPUData();
   return thrust::raw_pointer_cast(m_GPUDataDevice.data());
 }
 
@@ -60,16 +67,81 @@ void ObjectArray::uploadArrayData() const
   if (!needToUploadData())
     return;
 
-  m_GPUDataHost.resize(totalSize());
+  // Replaced handles stay referenced by the array until the upload, so their
+  // addresses can't be reused by the handles replacing them
+  const std::vector<Object *> previous(handlesBegin(false), handlesEnd(false));
 
-  std::transform(handlesBegin(false),
-      handlesEnd(false),
-      m_GPUDataHost.begin(),
-      [](Object *obj) { return obj ? obj->deviceData() : nullptr; });
+  helium::ObjectArray::uploadArrayData();
 
-  m_GPUDataDevice = m_GPUDataHost;
+  // Only handles the application replaced need new device pointers, which are
+  // translated when dataGPU() is requested
+  constexpr size_t maxDirtyGap = 64;
+  const auto changed = changedRanges(previous.data(),
+      previous.size(),
+      handlesBegin(false),
+      totalSize(),
+      maxDirtyGap);
+  for (auto &r : changed)
+    markGPUDataDirty(r.begin, r.end);
+}
 
-  helium::ObjectArray::uploadArrayData();
+void ObjectArray::appendHandle(Object *o)
+{
+  helium::ObjectArray::appendHandle(o);
+  markGPUDataDirty(totalSize() - 1, totalSize());
+}
+
+void ObjectArray::markGPUDataDirty(size_t begin, size_t end) const
+{
+  m_GPUDataDirty.push_back({begin, end});
+}
+
+void ObjectArray::syncGPUData() const
+{
+  const size_t size = totalSize();
+  const size_t oldSize = m_GPUDataHost.size();
+  if (size > oldSize)
+    markGPUDataDirty(oldSize, size);
+
+  if (m_GPUDataDirty.empty() && size == oldSize)
+    return;
+
+  m_GPUDataHost.resize(size, nullptr);
+  m_GPUDataDevice.resize(size, nullptr);
+
+  // Only translate handles in ranges touched since the last sync, then only
+  // copy the parts of those whose device pointers actually changed
+  constexpr size_t maxUploadGap = 64;
+  auto *handles = handlesBegin(false);
+  std::vector<void *> translated;
+  for (auto &dirty : mergeRanges(std::move(m_GPUDataDirty))) {
+    const size_t begin = dirty.begin;
+    const size_t end = std::min(dirty.end, size);
+    if (begin >= end)
+      continue;
+
+    translated.resize(end - begin);
+    std::transform(handles + begin,
+        handles + end,
+        translated.begin(),
+        [](Object *obj) { return obj ? obj->deviceData() : nullptr; });
+
+    auto *previous = m_GPUDataHost.data() + begin;
+    const auto ranges = changedRanges(previous,
+        end - begin,
+        translated.data(),
+        translated.size(),
+        maxUploadGap);
+    std::copy(translated.begin(), translated.end(), previous);
+
+    for (auto &r : ranges) {
+      thrust::copy(m_GPUDataHost.begin() + begin + r.begin,
+          m_GPUDataHost.begin() + begin + r.end,
+          m_GPUDataDevice.begin() + begin + r.begin);
+    }
+  }
+
+  m_GPUDataDirty.clear();
 }
 
 } // namespace visrtx
@@ -33,6 +33,7 @@
 
 #include "Object.h"
 #include "array/Array1D.h"
+#include "utility/IndexRange.h"
 // helium
 #include <helium/array/ObjectArray.h>
 // thrust
@@ -52,12 +53,20 @@ struct ObjectArray : public helium::ObjectArray, GPUArray
 
   void uploadArrayData() const override;
 
+  // Appended handles are the only part of the array re-translated on sync;
+  // removed ones are trimmed off the end of the device copy
+  void appendHandle(Object *o);
+
  private:
+  void markGPUDataDirty(size_t begin, size_t end) const;
+  void syncGPUData() const;
+
   mutable std::vector<Object *> m_appendedHandles;
   mutable std::vector<Object *> m_appHandles;
   mutable std::vector<Object *> m_liveHandles;
   mutable thrust::host_vector<void *> m_GPUDataHost;
   mutable thrust::device_vector<void *> m_GPUDataDevice;
+  mutable std::vector<IndexRange> m_GPUDataDirty;
 };
 
 } // namespace visrtx
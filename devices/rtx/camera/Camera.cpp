@@ -31,6 +31,7 @@
 
 #include "Camera.h"
 // specific types
+#include "Omnidirectional.h"
 #include "Orthographic.h"
 #include "Perspective.h"
 #include "UnknownCamera.h"
@@ -62,6 +63,8 @@ Camera *Camera::createInstance(std::string_view subtype, DeviceGlobalState *d)
     return new Perspective(d);
   else if (subtype == "orthographic")
     return new Orthographic(d);
+  else if (subtype == "omnidirectional")
+    return new Omnidirectional(d);
   else
     return new UnknownCamera(subtype, d);
 }
@@ -79,6 +82,32 @@ void Camera::readBaseParameters(CameraGPUData &hd)
   hd.pos = getParam<vec3>("position", vec3(0.f));
   hd.dir = normalize(getParam<vec3>("direction", vec3(0.f, 0.f, 1.f)));
   hd.up = normalize(getParam<vec3>("up", vec3(0.f, 1.f, 0.f)));
+  hd.stereoMode = StereoMode::NONE;
+  hd.interpupillaryDistance = 0.f;
+}
+
+void Camera::readStereoParameters(CameraGPUData &hd)
+{
+  const auto mode = getParamString("stereoMode", "none");
+  if (mode == "left")
+    hd.stereoMode = StereoMode::LEFT;
+  else if (mode == "right")
+    hd.stereoMode = StereoMode::RIGHT;
+  else if (mode == "sideBySide")
+    hd.stereoMode = StereoMode::SIDE_BY_SIDE;
+  else if (mode == "topBottom")
+    hd.stereoMode = StereoMode::TOP_BOTTOM;
+  else {
+    if (mode != "none") {
+      reportMessage(ANARI_SEVERITY_WARNING,
+          "unknown camera 'stereoMode' '%s', using 'none'",
+          mode.c_str());
+    }
+    hd.stereoMode = StereoMode::NONE;
+  }
+
+  hd.interpupillaryDistance =
+      getParam<float>("interpupillaryDistance", 0.0635f);
 }
 
 } // namespace visrtx
@@ -50,6 +50,7 @@ struct Camera : public Object, public DeviceObject<CameraGPUData>
 
  protected:
   void readBaseParameters(CameraGPUData &hd);
+  void readStereoParameters(CameraGPUData &hd);
 };
 
 } // namespace visrtx
@@ -35,7 +35,7 @@ namespace visrtx {
 
 Orthographic::Orthographic(DeviceGlobalState *s) : Camera(s) {}
 
-void Orthographic::commit()
+void Orthographic::commitObject()
 {
   const float aspect = getParam<float>("aspect", 1.f);
   const float height = getParam<float>("height", 1.f);
@@ -30,12 +30,14 @@
  */
 
 #include "Perspective.h"
+// std
+#include <algorithm>
 
 namespace visrtx {
 
 Perspective::Perspective(DeviceGlobalState *s) : Camera(s) {}
 
-void Perspective::commit()
+void Perspective::commitObject()
 {
   float fovy = getParam<float>("fovy", glm::radians(60.f));
   float aspect = getParam<float>("aspect", 1.f);
@@ -46,11 +48,20 @@ void Perspective::commit()
 
   auto &hd = data();
   readBaseParameters(hd);
+  readStereoParameters(hd);
   hd.type = CameraType::PERSPECTIVE;
   auto &p = hd.perspective;
   p.dir_du = normalize(cross(hd.dir, hd.up)) * imgPlaneSize.x;
   p.dir_dv = normalize(cross(p.dir_du, hd.dir)) * imgPlaneSize.y;
   p.dir_00 = hd.dir - .5f * p.dir_du - .5f * p.dir_dv;
+  p.apertureRadius = std::max(getParam<float>("apertureRadius", 0.f), 0.f);
+  p.focusDistance = getParam<float>("focusDistance", 1.f);
+  if (p.apertureRadius > 0.f && !(p.focusDistance > 0.f)) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "perspective camera 'focusDistance' must be positive, disabling"
+        " depth of field");
+    p.apertureRadius = 0.f;
+  }
   upload();
 }
 
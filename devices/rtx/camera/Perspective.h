@@ -38,7 +38,7 @@ namespace visrtx {
 struct Perspective : public Camera
 {
   Perspective(DeviceGlobalState *d);
-  void commit() override;
+  void commitObject() override;
 };
 
 } // namespace visrtx
@@ -30,13 +30,21 @@
  */
 
 #include "Frame.h"
+#include "array/Array1D.h"
+#include "gpu/cameraCreateRay.h"
+#include "gpu/compositing.h"
+#include "scene/volume/spatial_field/SpatialField.h"
 #include "utility/instrument.h"
+// VisRTX
+#include "anari/ext/visrtx/visrtx.h"
 // std
 #include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <random>
 // thrust
 #include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
 namespace visrtx {
@@ -45,6 +53,12 @@ namespace visrtx {
 
 static std::atomic<size_t> s_numFrames = 0;
 
+// Pick results are handed to the application as VisRTXPickResult
+static_assert(sizeof(PickResult) == sizeof(VisRTXPickResult));
+static_assert(
+    offsetof(PickResult, distance) == offsetof(VisRTXPickResult, distance));
+static_assert(offsetof(PickResult, hit) == offsetof(VisRTXPickResult, hit));
+
 size_t Frame::objectCount()
 {
   return s_numFrames;
@@ -128,15 +142,23 @@ void Frame::commit()
   m_instIDType = getParam<ANARIDataType>("channel.instanceId", ANARI_UNKNOWN);
   m_albedoType = getParam<ANARIDataType>("channel.albedo", ANARI_UNKNOWN);
   m_normalType = getParam<ANARIDataType>("channel.normal", ANARI_UNKNOWN);
+  m_bentNormalType =
+      getParam<ANARIDataType>("channel.bentNormal", ANARI_UNKNOWN);
+  m_colorDepthType =
+      getParam<ANARIDataType>("channel.colorDepth", ANARI_UNKNOWN);
+  m_compositingTileSize =
+      std::max(getParam<uint32_t>("compositingTileSize", 32u), 1u);
 
   const bool channelPrimID = m_primIDType == ANARI_UINT32;
   const bool channelObjID = m_objIDType == ANARI_UINT32;
   const bool channelInstID = m_instIDType == ANARI_UINT32;
   const bool channelAlbedo = m_albedoType == ANARI_FLOAT32;
   const bool channelNormal = m_normalType == ANARI_FLOAT32;
+  const bool channelBentNormal = m_bentNormalType == ANARI_FLOAT32_VEC3;
+  const bool channelColorDepth = m_colorDepthType == ANARI_UINT32_VEC2;
 
   const bool channelDepth = m_depthType == ANARI_FLOAT32 || channelPrimID
-      || channelObjID || channelInstID;
+      || channelObjID || channelInstID || channelColorDepth;
   if (channelDepth && m_depthType != ANARI_FLOAT32)
     m_depthType = ANARI_FLOAT32;
 
@@ -159,6 +181,17 @@ void Frame::commit()
   m_deviceNormalBuffer.resize(channelNormal ? numPixels : 0);
   m_mappedNormalBuffer.resize(channelNormal ? numPixels : 0);
 
+  m_accumBentNormal.resize(channelBentNormal ? numPixels : 0);
+  m_deviceBentNormalBuffer.resize(channelBentNormal ? numPixels : 0);
+  m_mappedBentNormalBuffer.resize(channelBentNormal ? numPixels : 0);
+
+  const uvec2 numTiles =
+      compositingNumTiles(hd.fb.size, m_compositingTileSize);
+  m_deviceColorDepthBuffer.resize(channelColorDepth ? numPixels : 0);
+  m_mappedColorDepthBuffer.resize(channelColorDepth ? numPixels : 0);
+  m_deviceTileMask.resize(channelColorDepth ? numTiles.x * numTiles.y : 0);
+  m_mappedTileMask.resize(channelColorDepth ? numTiles.x * numTiles.y : 0);
+
   hd.fb.buffers.colorAccumulation =
       thrust::raw_pointer_cast(m_accumColor.data());
 
@@ -178,6 +211,9 @@ void Frame::commit()
       channelAlbedo ? thrust::raw_pointer_cast(m_accumAlbedo.data()) : nullptr;
   hd.fb.buffers.normal =
       channelNormal ? thrust::raw_pointer_cast(m_accumNormal.data()) : nullptr;
+  hd.fb.buffers.bentNormal = channelBentNormal
+      ? thrust::raw_pointer_cast(m_accumBentNormal.data())
+      : nullptr;
 
   if (m_denoise)
     m_denoiser.setup(hd.fb.size, m_pixelBuffer, format);
@@ -207,10 +243,57 @@ bool Frame::getProperty(
     if (flags & ANARI_WAIT)
       wait();
     if (ready())
-      deviceState()->commitBufferFlush();
+      deviceState()->flushCommits();
     checkAccumulationReset();
     helium::writeToVoidP(ptr, m_nextFrameReset);
     return true;
+  } else if (type == ANARI_FLOAT32 && name == "costScale") {
+    if (flags & ANARI_WAIT)
+      wait();
+    if (ready())
+      updateCostScale();
+    helium::writeToVoidP(ptr, m_costScale);
+    return true;
+  } else if (type == ANARI_BOOL && name == "bvhStale") {
+    if (flags & ANARI_WAIT)
+      wait();
+    helium::writeToVoidP(ptr, m_bvhStale);
+    return true;
+  } else if (type == ANARI_BOOL && name == "pick") {
+    const bool hit = pick() && m_pickResults.dataHost()[0].hit;
+    helium::writeToVoidP(ptr, hit);
+    return true;
+  } else if (type == ANARI_VOID_POINTER && name == "pick") {
+    const void *results = pick() ? m_pickResults.dataHost() : nullptr;
+    helium::writeToVoidP(ptr, results);
+    return true;
+  } else if (name.substr(0, 5) == "pick." && !m_pickResults.empty()) {
+    // Components of the first result of the last pick query
+    const auto &r = m_pickResults.dataHost()[0];
+    if (type == ANARI_FLOAT32_VEC3 && name == "pick.worldPosition") {
+      helium::writeToVoidP(ptr, r.position);
+      return true;
+    } else if (type == ANARI_FLOAT32 && name == "pick.distance") {
+      helium::writeToVoidP(ptr, r.distance);
+      return true;
+    } else if (type == ANARI_UINT32 && name == "pick.primitiveId") {
+      helium::writeToVoidP(ptr, r.primID);
+      return true;
+    } else if (type == ANARI_UINT32 && name == "pick.objectId") {
+      helium::writeToVoidP(ptr, r.objID);
+      return true;
+    } else if (type == ANARI_UINT32 && name == "pick.instanceId") {
+      helium::writeToVoidP(ptr, r.instID);
+      return true;
+    }
+  } else if (type == ANARI_FLOAT32_BOX2 && name == "screenBounds") {
+    if (!isValid())
+      return false;
+    box3 worldBounds;
+    m_world->getProperty("bounds", ANARI_FLOAT32_BOX3, &worldBounds, flags);
+    helium::writeToVoidP(
+        ptr, cameraScreenBounds(&m_camera->data(), worldBounds));
+    return true;
   }
 
   return 0;
@@ -222,19 +305,7 @@ void Frame::renderFrame()
 
   auto &state = *deviceState();
 
-  instrument::rangePush("update scene");
-  instrument::rangePush("flush commits");
-  state.commitBufferFlush();
-  instrument::rangePop(); // flush commits
-
-  instrument::rangePush("flush array uploads");
-  state.uploadBuffer.flush();
-  instrument::rangePop(); // flush array uploads
-
-  instrument::rangePush("rebuild BVHs");
-  m_world->rebuildBVHs();
-  instrument::rangePop(); // rebuild BVHs
-  instrument::rangePop(); // update scene
+  updateScene();
 
   if (!isValid()) {
     reportMessage(ANARI_SEVERITY_ERROR,
@@ -263,28 +334,19 @@ void Frame::renderFrame()
 
   cudaEventRecord(m_eventStart, state.stream);
 
-  m_renderer->populateFrameData(hd);
-
-  hd.camera = (CameraGPUData *)m_camera->deviceData();
-
-  hd.world.surfaceInstances = m_world->instanceSurfaceGPUData().data();
-  hd.world.numSurfaceInstances = m_world->instanceSurfaceGPUData().size();
-  hd.world.surfacesTraversable = m_world->optixTraversableHandleSurfaces();
+  fillFrameData(hd);
 
-  hd.world.volumeInstances = m_world->instanceVolumeGPUData().data();
-  hd.world.numVolumeInstances = m_world->instanceVolumeGPUData().size();
-  hd.world.volumesTraversable = m_world->optixTraversableHandleVolumes();
-
-  hd.world.lightInstances = m_world->instanceLightGPUData().data();
-  hd.world.numLightInstances = m_world->instanceLightGPUData().size();
-
-  hd.registry.samplers = state.registry.samplers.devicePtr();
-  hd.registry.geometries = state.registry.geometries.devicePtr();
-  hd.registry.materials = state.registry.materials.devicePtr();
-  hd.registry.surfaces = state.registry.surfaces.devicePtr();
-  hd.registry.lights = state.registry.lights.devicePtr();
-  hd.registry.fields = state.registry.fields.devicePtr();
-  hd.registry.volumes = state.registry.volumes.devicePtr();
+  if (m_renderer->tracksTraversalCost()) {
+    // Heat maps are scaled by the largest cost of the previous frame
+    updateCostScale();
+    const uint32_t zero = 0;
+    m_costMaxBuffer.upload(&zero);
+    hd.fb.costMax = (uint32_t *)m_costMaxBuffer.ptr();
+    hd.fb.costScale = m_costScale;
+  } else {
+    hd.fb.costMax = nullptr;
+    hd.fb.costScale = 0.f;
+  }
 
   const int spp = std::max(m_renderer->spp(), 1);
 
@@ -337,6 +399,8 @@ void *Frame::map(std::string_view channel,
   const bool channelInstID = m_instIDType == ANARI_UINT32;
   const bool channelAlbedo = m_albedoType == ANARI_FLOAT32;
   const bool channelNormal = m_normalType == ANARI_FLOAT32;
+  const bool channelBentNormal = m_bentNormalType == ANARI_FLOAT32_VEC3;
+  const bool channelColorDepth = m_colorDepthType == ANARI_UINT32_VEC2;
 
   if (channel == "channel.color") {
     type = m_colorType;
@@ -362,15 +426,27 @@ void *Frame::map(std::string_view channel,
   } else if (channelNormal && channel == "channel.normal") {
     type = ANARI_FLOAT32_VEC3;
     retval = mapNormalBuffer();
+  } else if (channelBentNormal && channel == "channel.bentNormal") {
+    type = ANARI_FLOAT32_VEC3;
+    retval = mapBentNormalBuffer();
   } else if (channelAlbedo && channel == "channel.albedo") {
     type = ANARI_FLOAT32_VEC3;
     retval = mapAlbedoBuffer();
+  } else if (channelColorDepth && channel == "channel.colorDepth") {
+    type = ANARI_UINT32_VEC2;
+    retval = mapColorDepthBuffer();
+  } else if (channelColorDepth && channel == "channel.tileMask") {
+    type = ANARI_UINT8;
+    retval = mapTileMaskBuffer();
   }
 
   if (type != ANARI_UNKNOWN) {
     const auto &hd = data();
-    *width = hd.fb.size.x;
-    *height = hd.fb.size.y;
+    const uvec2 size = channel == "channel.tileMask"
+        ? compositingNumTiles(hd.fb.size, m_compositingTileSize)
+        : hd.fb.size;
+    *width = size.x;
+    *height = size.y;
   }
 
   *pixelType = type;
@@ -499,6 +575,52 @@ void *Frame::mapNormalBuffer()
   return m_mappedNormalBuffer.data();
 }
 
+void *Frame::mapBentNormalBuffer()
+{
+  auto &state = *deviceState();
+  thrust::transform(thrust::cuda::par.on(state.stream),
+      m_accumBentNormal.begin(),
+      m_accumBentNormal.end(),
+      m_deviceBentNormalBuffer.begin(),
+      [] __device__(const vec3 &in) {
+        return in == vec3(0.f) ? in : normalize(in);
+      });
+  m_mappedBentNormalBuffer = m_deviceBentNormalBuffer;
+  m_frameMappedOnce = true;
+  return m_mappedBentNormalBuffer.data();
+}
+
+void *Frame::mapColorDepthBuffer()
+{
+  updateColorDepthBuffer();
+  m_mappedColorDepthBuffer = m_deviceColorDepthBuffer;
+  m_frameMappedOnce = true;
+  return m_mappedColorDepthBuffer.data();
+}
+
+void *Frame::mapTileMaskBuffer()
+{
+  updateColorDepthBuffer();
+
+  auto &state = *deviceState();
+  const auto *pixels =
+      thrust::raw_pointer_cast(m_deviceColorDepthBuffer.data());
+  const uvec2 size = data().fb.size;
+  const uint32_t tileSize = m_compositingTileSize;
+  const uvec2 numTiles = compositingNumTiles(size, tileSize);
+  thrust::transform(thrust::cuda::par.on(state.stream),
+      thrust::make_counting_iterator(0u),
+      thrust::make_counting_iterator(numTiles.x * numTiles.y),
+      m_deviceTileMask.begin(),
+      [=] __device__(uint32_t i) {
+        const uvec2 tile(i % numTiles.x, i / numTiles.x);
+        return uint8_t(!tileIsEmpty(pixels, size, tile, tileSize));
+      });
+  m_mappedTileMask = m_deviceTileMask;
+  m_frameMappedOnce = true;
+  return m_mappedTileMask.data();
+}
+
 bool Frame::ready() const
 {
   return cudaEventQuery(m_eventEnd) == cudaSuccess;
@@ -509,6 +631,15 @@ void Frame::wait() const
   cudaEventSynchronize(m_eventEnd);
 }
 
+void Frame::updateCostScale()
+{
+  if (!m_costMaxBuffer)
+    return;
+  uint32_t costMax = 0;
+  m_costMaxBuffer.download(&costMax);
+  m_costScale = costMaxValue(costMax);
+}
+
 bool Frame::checkerboarding() const
 {
   return m_renderer ? m_renderer->checkerboarding() : false;
@@ -530,6 +661,138 @@ void Frame::checkAccumulationReset()
   }
 }
 
+void Frame::updateScene()
+{
+  auto &state = *deviceState();
+
+  instrument::rangePush("update scene");
+  state.commitStats.beginFlush();
+
+  instrument::rangePush("flush commits");
+  state.commitBufferFlush();
+  instrument::rangePop(); // flush commits
+
+  instrument::rangePush("flush array uploads");
+  state.uploadBuffer.flush();
+  instrument::rangePop(); // flush array uploads
+
+  state.commitStats.endFlush();
+
+  instrument::rangePush("stream field data");
+  for (auto *field : state.streamedFields) {
+    // Newly streamed in data refines the image without a commit
+    if (field->updateStreamedData())
+      m_nextFrameReset = true;
+  }
+  instrument::rangePop(); // stream field data
+
+  instrument::rangePush("rebuild BVHs");
+  m_world->rebuildBVHs();
+  m_bvhStale = m_world->bvhIsStale();
+  if (m_bvhVersion != m_world->bvhVersion()) {
+    // A TLAS finished in the background changes the image without a commit
+    m_bvhVersion = m_world->bvhVersion();
+    m_nextFrameReset = true;
+  }
+  instrument::rangePop(); // rebuild BVHs
+  instrument::rangePop(); // update scene
+}
+
+void Frame::fillFrameData(FrameGPUData &fd)
+{
+  m_renderer->populateFrameData(fd);
+  m_world->populateFrameData(fd);
+  fd.camera = (CameraGPUData *)m_camera->deviceData();
+}
+
+bool Frame::pick()
+{
+  wait();
+
+  if (!isValid()) {
+    reportMessage(ANARI_SEVERITY_ERROR,
+        "skipping pick query on incomplete or invalid frame object");
+    return false;
+  }
+
+  std::vector<vec2> screens;
+  if (auto *positions = getParamObject<Array1D>("pick.screen")) {
+    if (positions->elementType() != ANARI_FLOAT32_VEC2) {
+      reportMessage(ANARI_SEVERITY_WARNING,
+          "'pick.screen' array on ANARIFrame must be of type FLOAT32_VEC2,"
+          " skipping pick query");
+      m_pickResults.clear();
+      return false;
+    }
+    const auto *begin = positions->beginAs<vec2>();
+    screens.assign(begin, begin + positions->size());
+  } else {
+    vec2 screen(0.f);
+    if (getParam("pick.screen", ANARI_FLOAT32_VEC2, &screen))
+      screens.push_back(screen);
+  }
+
+  if (screens.empty()) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "missing required parameter 'pick.screen' for frame pick query");
+    m_pickResults.clear();
+    return false;
+  }
+
+  auto &state = *deviceState();
+
+  instrument::rangePush("Frame::pick()");
+
+  updateScene();
+
+  // Trace with a copy of the frame data, so the next frame neither notices the
+  // launch nor needs to reset accumulation
+  auto fd = data();
+  fillFrameData(fd);
+  fd.fb.costMax = nullptr;
+
+  m_pickScreens.resize(screens.size());
+  std::copy(screens.begin(), screens.end(), m_pickScreens.dataHost());
+  m_pickScreens.upload();
+  m_pickResults.resize(screens.size());
+
+  fd.pick.screens = m_pickScreens.dataDevice();
+  fd.pick.results = m_pickResults.dataDevice();
+  fd.pick.count = uint32_t(screens.size());
+  m_pickFrameData.upload(&fd);
+
+  const auto *sbt = m_renderer->sbt(); // creates the pipeline if needed
+  OPTIX_CHECK(optixLaunch(m_renderer->pipeline(),
+      state.stream,
+      (CUdeviceptr)m_pickFrameData.ptr(),
+      sizeof(FrameGPUData),
+      sbt,
+      fd.pick.count,
+      1,
+      1));
+  CUDA_STREAM_SYNC_CHECK_OBJECT(state.stream, this);
+
+  m_pickResults.download();
+
+  instrument::rangePop(); // Frame::pick()
+
+  return true;
+}
+
+void Frame::updateColorDepthBuffer()
+{
+  auto &state = *deviceState();
+  const float invFrameID = m_invFrameID;
+  thrust::transform(thrust::cuda::par.on(state.stream),
+      m_accumColor.begin(),
+      m_accumColor.end(),
+      thrust::device_pointer_cast(m_depthBuffer.dataDevice()),
+      m_deviceColorDepthBuffer.begin(),
+      [=] __device__(const vec4 &color, float rayDistance) {
+        return packColorDepth(color * invFrameID, rayDistance);
+      });
+}
+
 void Frame::newFrame()
 {
   auto &hd = data();
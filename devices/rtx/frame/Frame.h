@@ -84,13 +84,21 @@ struct Frame : public helium::BaseFrame, public DeviceObject<FrameGPUData>
   void *mapInstIDBuffer();
   void *mapAlbedoBuffer();
   void *mapNormalBuffer();
+  void *mapBentNormalBuffer();
+  void *mapColorDepthBuffer();
+  void *mapTileMaskBuffer();
 
  private:
   bool ready() const;
   void wait() const;
   bool checkerboarding() const;
   void checkAccumulationReset();
+  void updateCostScale();
   void newFrame();
+  void updateScene();
+  void fillFrameData(FrameGPUData &fd);
+  bool pick();
+  void updateColorDepthBuffer();
 
   //// Data ////
 
@@ -100,6 +108,8 @@ struct Frame : public helium::BaseFrame, public DeviceObject<FrameGPUData>
   bool m_denoise{false};
   bool m_nextFrameReset{true};
   bool m_frameMappedOnce{false}; // NOTE(jda) - for instrumented events
+  bool m_bvhStale{false}; // last frame rendered with an outdated TLAS
+  uint64_t m_bvhVersion{0};
 
   anari::DataType m_colorType{ANARI_UNKNOWN};
   anari::DataType m_depthType{ANARI_UNKNOWN};
@@ -108,6 +118,8 @@ struct Frame : public helium::BaseFrame, public DeviceObject<FrameGPUData>
   anari::DataType m_instIDType{ANARI_UNKNOWN};
   anari::DataType m_albedoType{ANARI_UNKNOWN};
   anari::DataType m_normalType{ANARI_UNKNOWN};
+  anari::DataType m_bentNormalType{ANARI_UNKNOWN};
+  anari::DataType m_colorDepthType{ANARI_UNKNOWN};
 
   thrust::device_vector<vec4> m_accumColor;
   HostDeviceArray<uint8_t> m_pixelBuffer;
@@ -125,6 +137,16 @@ struct Frame : public helium::BaseFrame, public DeviceObject<FrameGPUData>
   thrust::device_vector<vec3> m_deviceNormalBuffer;
   thrust::host_vector<vec3> m_mappedNormalBuffer;
 
+  thrust::device_vector<vec3> m_accumBentNormal;
+  thrust::device_vector<vec3> m_deviceBentNormalBuffer;
+  thrust::host_vector<vec3> m_mappedBentNormalBuffer;
+
+  thrust::device_vector<uvec2> m_deviceColorDepthBuffer;
+  thrust::host_vector<uvec2> m_mappedColorDepthBuffer;
+  thrust::device_vector<uint8_t> m_deviceTileMask;
+  thrust::host_vector<uint8_t> m_mappedTileMask;
+  uint32_t m_compositingTileSize{32};
+
   helium::IntrusivePtr<Renderer> m_renderer;
   helium::IntrusivePtr<Camera> m_camera;
   helium::IntrusivePtr<World> m_world;
@@ -134,6 +156,13 @@ struct Frame : public helium::BaseFrame, public DeviceObject<FrameGPUData>
 
   float m_duration{0.f};
 
+  DeviceBuffer m_costMaxBuffer;
+  float m_costScale{0.f};
+
+  DeviceBuffer m_pickFrameData;
+  HostDeviceArray<vec2> m_pickScreens;
+  HostDeviceArray<PickResult> m_pickResults;
+
   bool m_frameChanged{false};
   helium::TimeStamp m_cameraLastChanged{0};
   helium::TimeStamp m_rendererLastChanged{0};
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/bsdf.h"
+#include "gpu/cameraCreateRay.h"
+
+// Hemisphere directions for ambient occlusion. Directions are cosine
+// weighted, so every unoccluded ray contributes equally to the estimate,
+// and are generated from 2D points which are either independent, jittered
+// in strata of the samples of a frame, or a low-discrepancy sequence that
+// continues through the frames of an accumulation.
+
+namespace visrtx {
+
+enum class AOSampling
+{
+  RANDOM,
+  STRATIFIED,
+  LOW_DISCREPANCY
+};
+
+namespace detail {
+
+RT_FUNCTION uint32_t reverseBits(uint32_t i)
+{
+  i = (i << 16) | (i >> 16);
+  i = ((i & 0x00ff00ffu) << 8) | ((i & 0xff00ff00u) >> 8);
+  i = ((i & 0x0f0f0f0fu) << 4) | ((i & 0xf0f0f0f0u) >> 4);
+  i = ((i & 0x33333333u) << 2) | ((i & 0xccccccccu) >> 2);
+  i = ((i & 0x55555555u) << 1) | ((i & 0xaaaaaaaau) >> 1);
+  return i;
+}
+
+// Kollig and Keller 2002, "Efficient Multidimensional Sampling": together
+// with the bit reversed index, the second dimension of the Sobol sequence
+RT_FUNCTION uint32_t sobol2(uint32_t i)
+{
+  uint32_t r = 0;
+  for (uint32_t v = 1u << 31; i; i >>= 1, v ^= v >> 1) {
+    if (i & 1)
+      r ^= v;
+  }
+  return r;
+}
+
+// 32-bit integer hash with good avalanche ("lowbias32", C. Wellons)
+RT_FUNCTION uint32_t hashBits(uint32_t x)
+{
+  x ^= x >> 16;
+  x *= 0x7feb352du;
+  x ^= x >> 15;
+  x *= 0x846ca68bu;
+  x ^= x >> 16;
+  return x;
+}
+
+RT_FUNCTION float bitsToUnitFloat(uint32_t bits)
+{
+  return float(bits >> 8) * (1.f / 16777216.f);
+}
+
+} // namespace detail
+
+// Columns of a grid of exactly 'n' strata which is as square as possible
+RT_FUNCTION uint32_t aoStrataColumns(uint32_t n)
+{
+  uint32_t c = uint32_t(sqrtf(float(n)));
+  while (c > 1 && n % c != 0)
+    c--;
+  return c > 0 ? c : 1;
+}
+
+// Point 'i' of the 'n' points of frame 'frameID' in [0, 1)^2. RANDOM returns
+// the uniform pair 'u', STRATIFIED uses it to jitter inside stratum 'i', and
+// LOW_DISCREPANCY ignores it: the (0,2)-sequence is scrambled per 'pixel'
+// with random digit scrambling, which keeps it stratified in every frame as
+// well as over any number of accumulated frames
+RT_FUNCTION vec2 aoSample2D(AOSampling mode,
+    uint32_t i,
+    uint32_t n,
+    uint32_t frameID,
+    uint32_t pixel,
+    const vec2 &u)
+{
+  switch (mode) {
+  case AOSampling::STRATIFIED: {
+    const uint32_t columns = aoStrataColumns(n);
+    const uint32_t rows = n / columns;
+    return vec2((float(i % columns) + u.x) / float(columns),
+        (float(i / columns) + u.y) / float(rows));
+  }
+  case AOSampling::LOW_DISCREPANCY: {
+    const uint32_t k = frameID * n + i;
+    const uint32_t scrambleX = detail::hashBits(pixel + 1);
+    const uint32_t scrambleY = detail::hashBits(scrambleX);
+    return vec2(detail::bitsToUnitFloat(detail::reverseBits(k) ^ scrambleX),
+        detail::bitsToUnitFloat(detail::sobol2(k) ^ scrambleY));
+  }
+  case AOSampling::RANDOM:
+  default:
+    return u;
+  }
+}
+
+// Malley's method: lifting uniform points on the unit disk onto the
+// hemisphere around +z gives directions with pdf cos(theta) / pi
+RT_FUNCTION vec3 cosineSampleHemisphere(const vec2 &u)
+{
+  const vec2 d = sampleUnitDisk(u);
+  return vec3(d.x, d.y, sqrtf(fmaxf(0.f, 1.f - dot(d, d))));
+}
+
+// Fraction of the cosine-weighted hemisphere around the shading normal of
+// 'hit' which is unoccluded within 'dist', independent of how rays are
+// traced: 'occluded(ray)' tests one AO ray and 'uniform()' returns a uniform
+// float in [0, 1). If requested, also returns the bent normal: the mean
+// unoccluded direction, or the shading normal if all rays are occluded.
+template <typename OCCLUDED_FCN, typename UNIFORM_FCN>
+RT_FUNCTION float estimateAO(const Hit &hit,
+    float dist,
+    int numSamples,
+    AOSampling mode,
+    uint32_t frameID,
+    uint32_t pixel,
+    OCCLUDED_FCN &&occluded,
+    UNIFORM_FCN &&uniform,
+    vec3 *bentNormal = nullptr)
+{
+  const auto frame = makeShadingFrame(hit.Ns);
+
+  int unoccluded = 0;
+  vec3 bent(0.f);
+  for (int i = 0; i < numSamples; i++) {
+    vec2 u(0.f);
+    if (mode != AOSampling::LOW_DISCREPANCY) {
+      u.x = uniform();
+      u.y = uniform();
+    }
+    const vec2 p = aoSample2D(mode, i, numSamples, frameID, pixel, u);
+
+    Ray aoRay;
+    aoRay.org = hit.hitpoint + (hit.epsilon * hit.Ng);
+    aoRay.dir = frame.toWorld(cosineSampleHemisphere(p));
+    aoRay.t.upper = dist;
+    if (!occluded(aoRay)) {
+      unoccluded++;
+      bent += aoRay.dir;
+    }
+  }
+
+  if (bentNormal)
+    *bentNormal = unoccluded > 0 ? normalize(bent) : hit.Ns;
+
+  return float(unoccluded) / float(numSamples);
+}
+
+} // namespace visrtx
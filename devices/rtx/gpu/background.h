@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/gpu_objects.h"
+
+// Mapping of background images: either stretched over the screen or, as an
+// environment, an equirectangular image looked up by world space direction
+// with +y up and -z at the center of the image. Both are mip-mapped, where
+// level 0 is the full image and every further level halves its size.
+
+namespace visrtx {
+
+// Inverse of equirectangularDirection() for the default orientation
+RT_FUNCTION vec2 equirectangularCoords(const vec3 &dir)
+{
+  const vec3 d = normalize(dir);
+  const float phi = atan2f(d.x, -d.z);
+  const float theta = asinf(glm::clamp(d.y, -1.f, 1.f));
+  return vec2(phi / (2.f * float(M_PI)) + 0.5f, theta / float(M_PI) + 0.5f);
+}
+
+// Difference of two texture coordinates which wrap around horizontally, so a
+// footprint crossing the seam of an environment stays small
+RT_FUNCTION vec2 wrappedCoordsDifference(const vec2 &a, const vec2 &b)
+{
+  vec2 d = a - b;
+  d.x -= roundf(d.x);
+  return d;
+}
+
+RT_FUNCTION uint32_t numMipLevels(const uvec2 &size)
+{
+  uint32_t levels = 1;
+  for (uint32_t s = glm::max(size.x, size.y); s > 1; s >>= 1)
+    levels++;
+  return levels;
+}
+
+RT_FUNCTION uvec2 mipLevelSize(const uvec2 &size, uint32_t level)
+{
+  return glm::max(uvec2(size.x >> level, size.y >> level), uvec2(1));
+}
+
+} // namespace visrtx
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/gpu_objects.h"
+
+// The BSDF of all materials: a Lambertian base under a GGX microfacet
+// specular layer, weighted by 'metallic' as in the glTF metallic-roughness
+// model. All vectors are in the local shading frame (normal == +z), and
+// eval() returns f(wo, wi) * cos(wi) so path weights only need the pdf.
+
+namespace visrtx {
+
+constexpr float BSDF_PI = 3.14159265358979323846f;
+constexpr float BSDF_MIN_ALPHA = 1e-3f;
+
+struct ShadingFrame
+{
+  vec3 t;
+  vec3 b;
+  vec3 n;
+
+  RT_FUNCTION vec3 toLocal(const vec3 &v) const
+  {
+    return vec3(dot(v, t), dot(v, b), dot(v, n));
+  }
+
+  RT_FUNCTION vec3 toWorld(const vec3 &v) const
+  {
+    return v.x * t + v.y * b + v.z * n;
+  }
+};
+
+RT_FUNCTION ShadingFrame makeShadingFrame(const vec3 &n)
+{
+  // Duff et al. 2017, "Building an Orthonormal Basis, Revisited"
+  const float sign = n.z >= 0.f ? 1.f : -1.f;
+  const float a = -1.f / (sign + n.z);
+  const float b = n.x * n.y * a;
+  ShadingFrame f;
+  f.t = vec3(1.f + sign * n.x * n.x * a, sign * b, -sign * n.x);
+  f.b = vec3(b, sign + n.y * n.y * a, -n.y);
+  f.n = n;
+  return f;
+}
+
+RT_FUNCTION float luminance(const vec3 &c)
+{
+  return dot(c, vec3(0.2126f, 0.7152f, 0.0722f));
+}
+
+RT_FUNCTION vec3 fresnelSchlick(const vec3 &F0, float cosTheta)
+{
+  const float m = glm::clamp(1.f - cosTheta, 0.f, 1.f);
+  const float m2 = m * m;
+  return F0 + (vec3(1.f) - F0) * (m2 * m2 * m);
+}
+
+RT_FUNCTION float ggxD(const vec3 &h, float alpha)
+{
+  const float a2 = alpha * alpha;
+  const float d = h.z * h.z * (a2 - 1.f) + 1.f;
+  return a2 / (BSDF_PI * d * d);
+}
+
+RT_FUNCTION float ggxLambda(const vec3 &v, float alpha)
+{
+  const float cos2 = v.z * v.z;
+  if (cos2 <= 0.f)
+    return 0.f;
+  const float tan2 = glm::max(1.f - cos2, 0.f) / cos2;
+  return 0.5f * (glm::sqrt(1.f + alpha * alpha * tan2) - 1.f);
+}
+
+RT_FUNCTION float ggxG1(const vec3 &v, float alpha)
+{
+  return 1.f / (1.f + ggxLambda(v, alpha));
+}
+
+// Height-correlated masking-shadowing
+RT_FUNCTION float ggxG2(const vec3 &wo, const vec3 &wi, float alpha)
+{
+  return 1.f / (1.f + ggxLambda(wo, alpha) + ggxLambda(wi, alpha));
+}
+
+// Heitz 2018, "Sampling the GGX Distribution of Visible Normals": returns a
+// microfacet normal distributed as D_wo(h) = G1(wo) max(0, wo.h) D(h) / wo.z
+RT_FUNCTION vec3 sampleGGXVNDF(const vec3 &wo, float alpha, float u1, float u2)
+{
+  const vec3 vh = normalize(vec3(alpha * wo.x, alpha * wo.y, wo.z));
+
+  const float lensq = vh.x * vh.x + vh.y * vh.y;
+  const vec3 t1 = lensq > 0.f ? vec3(-vh.y, vh.x, 0.f) / glm::sqrt(lensq)
+                              : vec3(1.f, 0.f, 0.f);
+  const vec3 t2 = cross(vh, t1);
+
+  const float r = glm::sqrt(u1);
+  const float phi = 2.f * BSDF_PI * u2;
+  const float p1 = r * glm::cos(phi);
+  const float s = 0.5f * (1.f + vh.z);
+  const float p2 =
+      (1.f - s) * glm::sqrt(1.f - p1 * p1) + s * r * glm::sin(phi);
+
+  const vec3 nh = p1 * t1 + p2 * t2
+      + glm::sqrt(glm::max(0.f, 1.f - p1 * p1 - p2 * p2)) * vh;
+
+  return normalize(vec3(alpha * nh.x, alpha * nh.y, glm::max(0.f, nh.z)));
+}
+
+namespace detail {
+
+struct BSDFLobes
+{
+  float dielectricF0;
+  float specular;
+  vec3 metalF0;
+  float metallic;
+  vec3 diffuse; // Lambertian albedo
+  float alpha;
+  float specularProbability;
+
+  RT_FUNCTION vec3 fresnel(float cosTheta) const
+  {
+    const vec3 dielectric =
+        specular * fresnelSchlick(vec3(dielectricF0), cosTheta);
+    return glm::mix(dielectric, fresnelSchlick(metalF0, cosTheta), metallic);
+  }
+};
+
+RT_FUNCTION BSDFLobes bsdfLobes(const MaterialValues &m, const vec3 &wo)
+{
+  BSDFLobes l;
+
+  const float r = (m.ior - 1.f) / (m.ior + 1.f);
+  l.dielectricF0 = r * r;
+  l.specular = m.specular;
+  l.metalF0 = m.baseColor;
+  l.metallic = m.metallic;
+  l.diffuse = (1.f - m.metallic) * m.baseColor;
+  l.alpha = glm::max(m.roughness * m.roughness, BSDF_MIN_ALPHA);
+
+  // Pick lobes by their estimated contribution
+  const float spec = luminance(l.fresnel(wo.z));
+  const float diff = luminance(l.diffuse) * (1.f - spec);
+  l.specularProbability = spec + diff > 0.f ? spec / (spec + diff) : 1.f;
+
+  return l;
+}
+
+} // namespace detail
+
+RT_FUNCTION vec3 bsdfEval(
+    const MaterialValues &m, const vec3 &wo, const vec3 &wi)
+{
+  if (wo.z <= 0.f || wi.z <= 0.f)
+    return vec3(0.f);
+
+  const auto l = detail::bsdfLobes(m, wo);
+
+  const vec3 h = normalize(wo + wi);
+  const vec3 F = l.fresnel(dot(wi, h));
+
+  const vec3 diffuse = (vec3(1.f) - F) * l.diffuse * (wi.z / BSDF_PI);
+  const vec3 specular =
+      F * (ggxD(h, l.alpha) * ggxG2(wo, wi, l.alpha) / (4.f * wo.z));
+
+  return diffuse + specular;
+}
+
+RT_FUNCTION float bsdfPdf(
+    const MaterialValues &m, const vec3 &wo, const vec3 &wi)
+{
+  if (wo.z <= 0.f || wi.z <= 0.f)
+    return 0.f;
+
+  const auto l = detail::bsdfLobes(m, wo);
+
+  const vec3 h = normalize(wo + wi);
+  const float specularPdf =
+      ggxG1(wo, l.alpha) * ggxD(h, l.alpha) / (4.f * wo.z);
+  const float diffusePdf = wi.z / BSDF_PI;
+
+  return glm::mix(diffusePdf, specularPdf, l.specularProbability);
+}
+
+// Sample 'wi' given three uniform random numbers, returning the path weight
+// bsdfEval() / bsdfPdf(), or zero if the sample is absorbed
+RT_FUNCTION vec3 bsdfSample(const MaterialValues &m,
+    const vec3 &wo,
+    const vec3 &u,
+    vec3 &wi,
+    float &pdf)
+{
+  pdf = 0.f;
+  if (wo.z <= 0.f)
+    return vec3(0.f);
+
+  const auto l = detail::bsdfLobes(m, wo);
+
+  if (u.z < l.specularProbability) {
+    const vec3 h = sampleGGXVNDF(wo, l.alpha, u.x, u.y);
+    wi = reflect(-wo, h);
+  } else {
+    const float r = glm::sqrt(u.x);
+    const float phi = 2.f * BSDF_PI * u.y;
+    wi = vec3(r * glm::cos(phi),
+        r * glm::sin(phi),
+        glm::sqrt(glm::max(0.f, 1.f - u.x)));
+  }
+
+  pdf = bsdfPdf(m, wo, wi);
+  return pdf > 0.f ? bsdfEval(m, wo, wi) / pdf : vec3(0.f);
+}
+
+} // namespace visrtx
@@ -35,18 +35,108 @@
 
 namespace visrtx {
 
-RT_FUNCTION Ray cameraCreateRay(const CameraGPUData *c, vec2 screen)
+// Which eye a screen position belongs to (-1 left, 1 right, 0 mono), and
+// the position remapped to cover that eye's whole view
+RT_FUNCTION float stereoEye(StereoMode mode, vec2 &screen)
+{
+  switch (mode) {
+  case StereoMode::LEFT:
+    return -1.f;
+  case StereoMode::RIGHT:
+    return 1.f;
+  case StereoMode::SIDE_BY_SIDE: {
+    const bool left = screen.x < 0.5f;
+    screen.x = 2.f * screen.x - (left ? 0.f : 1.f);
+    return left ? -1.f : 1.f;
+  }
+  case StereoMode::TOP_BOTTOM: {
+    const bool left = screen.y >= 0.5f;
+    screen.y = 2.f * screen.y - (left ? 1.f : 0.f);
+    return left ? -1.f : 1.f;
+  }
+  default:
+    return 0.f;
+  }
+}
+
+// Equirectangular mapping: the frame center looks along 'forward', x spans
+// 360 degrees of longitude and y 180 degrees of latitude
+RT_FUNCTION vec3 equirectangularDirection(vec2 screen,
+    const vec3 &forward,
+    const vec3 &right,
+    const vec3 &up,
+    float *phiOut = nullptr)
+{
+  const float phi = 2.f * float(M_PI) * (screen.x - 0.5f);
+  const float theta = float(M_PI) * (screen.y - 0.5f);
+  if (phiOut)
+    *phiOut = phi;
+  return cosf(theta) * (sinf(phi) * right + cosf(phi) * forward)
+      + sinf(theta) * up;
+}
+
+// Shirley and Chiu 1997, "A Low Distortion Map Between Disk and Square":
+// maps uniform samples in [0, 1]^2 to uniform points on the unit disk
+RT_FUNCTION vec2 sampleUnitDisk(const vec2 &u)
+{
+  const vec2 p = 2.f * u - 1.f;
+  if (p.x == 0.f && p.y == 0.f)
+    return vec2(0.f);
+
+  float r, phi;
+  if (fabsf(p.x) > fabsf(p.y)) {
+    r = p.x;
+    phi = float(M_PI / 4) * (p.y / p.x);
+  } else {
+    r = p.y;
+    phi = float(M_PI / 2) - float(M_PI / 4) * (p.x / p.y);
+  }
+  return r * vec2(cosf(phi), sinf(phi));
+}
+
+// Move a pinhole ray's origin to a point on a thin lens, keeping the point
+// where it crosses the focal plane (at 'focusDistance' along 'forward')
+RT_FUNCTION void applyThinLens(Ray &ray,
+    const vec3 &forward,
+    const vec3 &right,
+    const vec3 &up,
+    float apertureRadius,
+    float focusDistance,
+    const vec2 &lensSample)
+{
+  const vec3 focalPoint =
+      ray.org + ray.dir * (focusDistance / dot(ray.dir, forward));
+  const vec2 lens = apertureRadius * sampleUnitDisk(lensSample);
+  ray.org += lens.x * right + lens.y * up;
+  ray.dir = normalize(focalPoint - ray.org);
+}
+
+RT_FUNCTION Ray cameraCreateRay(
+    const CameraGPUData *c, vec2 screen, vec2 lensSample = vec2(0.5f))
 {
   Ray ray;
 
+  // The frame is split between eyes first, so each eye shows the whole region
+  const float eye = stereoEye(c->stereoMode, screen);
+  const float eyeOffset = 0.5f * eye * c->interpupillaryDistance;
+
   screen.x = glm::mix(c->region[0], c->region[2], screen.x);
   screen.y = glm::mix(c->region[1], c->region[3], screen.y);
 
   switch (c->type) {
   case CameraType::PERSPECTIVE: {
     const auto &p = c->perspective;
-    ray.org = c->pos;
+    ray.org = c->pos + eyeOffset * normalize(p.dir_du);
     ray.dir = normalize(p.dir_00 + screen.x * p.dir_du + screen.y * p.dir_dv);
+    if (p.apertureRadius > 0.f) {
+      applyThinLens(ray,
+          c->dir,
+          normalize(p.dir_du),
+          normalize(p.dir_dv),
+          p.apertureRadius,
+          p.focusDistance,
+          lensSample);
+    }
     break;
   }
   case CameraType::ORTHOGRAPHIC: {
@@ -55,6 +145,14 @@ RT_FUNCTION Ray cameraCreateRay(const CameraGPUData *c, vec2 screen)
     ray.org = o.pos_00 + screen.x * o.pos_du + screen.y * o.pos_dv;
     break;
   }
+  case CameraType::OMNIDIRECTIONAL: {
+    const auto &o = c->omnidirectional;
+    float phi = 0.f;
+    ray.dir = equirectangularDirection(screen, c->dir, o.right, o.up, &phi);
+    // Eyes sit on a circle, offset along the local 'right' of each column
+    ray.org = c->pos + eyeOffset * (cosf(phi) * o.right - sinf(phi) * c->dir);
+    break;
+  }
   default:
     break;
   }
@@ -62,12 +160,88 @@ RT_FUNCTION Ray cameraCreateRay(const CameraGPUData *c, vec2 screen)
   return ray;
 }
 
+// Screen position whose camera ray passes through world position 'p', the
+// inverse of cameraCreateRay() for pinhole perspective and orthographic
+// cameras showing a single eye. Returns false if 'p' has no such position, as
+// for points behind the camera or points shown once per eye.
+RT_FUNCTION bool cameraProjectPoint(
+    const CameraGPUData *c, const vec3 &p, vec2 &screen)
+{
+  if (c->stereoMode == StereoMode::SIDE_BY_SIDE
+      || c->stereoMode == StereoMode::TOP_BOTTOM)
+    return false;
+
+  vec2 unused(0.f);
+  const float eye = stereoEye(c->stereoMode, unused);
+  const float eyeOffset = 0.5f * eye * c->interpupillaryDistance;
+
+  switch (c->type) {
+  case CameraType::PERSPECTIVE: {
+    // 'dir_du' and 'dir_dv' span the image plane, orthogonal to 'dir'
+    const auto &pc = c->perspective;
+    const vec3 d = p - (c->pos + eyeOffset * normalize(pc.dir_du));
+    const float dn = dot(d, c->dir);
+    if (dn <= 0.f)
+      return false;
+    const vec3 q = d * (dot(c->dir, c->dir) / dn) - pc.dir_00;
+    screen = vec2(dot(q, pc.dir_du) / dot(pc.dir_du, pc.dir_du),
+        dot(q, pc.dir_dv) / dot(pc.dir_dv, pc.dir_dv));
+    break;
+  }
+  case CameraType::ORTHOGRAPHIC: {
+    const auto &o = c->orthographic;
+    const vec3 q = p - o.pos_00;
+    screen = vec2(dot(q, o.pos_du) / dot(o.pos_du, o.pos_du),
+        dot(q, o.pos_dv) / dot(o.pos_dv, o.pos_dv));
+    break;
+  }
+  default:
+    return false;
+  }
+
+  screen = (screen - vec2(c->region.x, c->region.y))
+      / (vec2(c->region.z, c->region.w) - vec2(c->region.x, c->region.y));
+  return true;
+}
+
+// Part of the frame in [0, 1]^2 covered by a world space box, conservative
+// for boxes reaching behind the camera and cameras cameraProjectPoint()
+// doesn't handle, which get the whole frame. Empty boxes give empty bounds.
+RT_FUNCTION box2 cameraScreenBounds(const CameraGPUData *c, const box3 &b)
+{
+  box2 retval;
+  if (glm::any(glm::greaterThan(b.lower, b.upper)))
+    return retval;
+
+  for (int i = 0; i < 8; i++) {
+    const vec3 corner((i & 1) ? b.upper.x : b.lower.x,
+        (i & 2) ? b.upper.y : b.lower.y,
+        (i & 4) ? b.upper.z : b.lower.z);
+    vec2 screen(0.f);
+    if (!cameraProjectPoint(c, corner, screen))
+      return box2(vec2(0.f), vec2(1.f));
+    retval.extend(screen);
+  }
+
+  retval.lower = glm::clamp(retval.lower, vec2(0.f), vec2(1.f));
+  retval.upper = glm::clamp(retval.upper, vec2(0.f), vec2(1.f));
+  return retval;
+}
+
 RT_FUNCTION Ray makePrimaryRay(ScreenSample &ss)
 {
   const vec2 r(curand_uniform(&ss.rs) - 0.5f, curand_uniform(&ss.rs) - 0.5f);
   ss.screen =
       vec2(ss.pixel.x + r.x, ss.pixel.y + r.y) * ss.frameData->fb.invSize;
-  return cameraCreateRay(ss.frameData->camera, ss.screen);
+
+  // Only thin lens cameras use up random numbers for the lens
+  const auto *camera = ss.frameData->camera;
+  vec2 lens(0.5f);
+  if (camera->type == CameraType::PERSPECTIVE
+      && camera->perspective.apertureRadius > 0.f)
+    lens = vec2(curand_uniform(&ss.rs), curand_uniform(&ss.rs));
+
+  return cameraCreateRay(camera, ss.screen, lens);
 }
 
 } // namespace visrtx
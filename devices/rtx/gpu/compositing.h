@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/gpu_math.h"
+
+// Pixels of the 'channel.colorDepth' frame channel, for sort-last compositing
+// of frames rendered from parts of a distributed scene. Each pixel packs
+// linear, premultiplied RGBA8 in 'x' and the bits of the float ray distance
+// of the closest sample in 'y', like 'channel.depth'. Ranks trace the same
+// camera rays, so ray distances order their pixels like linear depth would,
+// including for cameras without a single view direction.
+
+namespace visrtx {
+
+VISRTX_HOST_DEVICE uvec2 packColorDepth(const vec4 &color, float rayDistance)
+{
+  return uvec2(glm::packUnorm4x8(color), glm::floatBitsToUint(rayDistance));
+}
+
+VISRTX_HOST_DEVICE vec4 unpackColor(const uvec2 &pixel)
+{
+  return glm::unpackUnorm4x8(pixel.x);
+}
+
+VISRTX_HOST_DEVICE float unpackRayDistance(const uvec2 &pixel)
+{
+  return glm::uintBitsToFloat(pixel.y);
+}
+
+VISRTX_HOST_DEVICE bool pixelIsEmpty(const uvec2 &pixel)
+{
+  return (pixel.x >> 24) == 0; // zero alpha, nothing to blend
+}
+
+// Blend two partial frame pixels, the closer one over the other
+VISRTX_HOST_DEVICE uvec2 compositeColorDepth(const uvec2 &a, const uvec2 &b)
+{
+  if (pixelIsEmpty(b))
+    return a;
+  if (pixelIsEmpty(a))
+    return b;
+
+  const bool aFirst = unpackRayDistance(a) <= unpackRayDistance(b);
+  const uvec2 &front = aFirst ? a : b;
+  const uvec2 &back = aFirst ? b : a;
+  const vec4 f = unpackColor(front);
+  return packColorDepth(
+      f + (1.f - f.w) * unpackColor(back), unpackRayDistance(front));
+}
+
+VISRTX_HOST_DEVICE uvec2 compositingNumTiles(
+    const uvec2 &frameSize, uint32_t tileSize)
+{
+  return (frameSize + uvec2(tileSize - 1)) / tileSize;
+}
+
+// Whether all pixels of a tile in a 'channel.colorDepth' frame are empty,
+// which lets compositors skip the tile
+VISRTX_HOST_DEVICE bool tileIsEmpty(const uvec2 *pixels,
+    const uvec2 &frameSize,
+    const uvec2 &tile,
+    uint32_t tileSize)
+{
+  const uvec2 begin = tile * tileSize;
+  const uvec2 end = glm::min(begin + uvec2(tileSize), frameSize);
+  for (uint32_t y = begin.y; y < end.y; y++) {
+    for (uint32_t x = begin.x; x < end.x; x++) {
+      if (!pixelIsEmpty(pixels[x + y * frameSize.x]))
+        return false;
+    }
+  }
+  return true;
+}
+
+} // namespace visrtx
@@ -31,32 +31,43 @@
 
 #pragma once
 
+#include "gpu/aoSampling.h"
 #include "gpu/intersectRay.h"
 
 namespace visrtx {
 
+// 'ambientOcclusionDistance', bounded to a fraction of the world's diagonal
+// unless 'ambientOcclusionDistanceScale' is zero
+RT_FUNCTION float aoDistance(const FrameGPUData &fd)
+{
+  const auto &rd = fd.renderer;
+  if (rd.occlusionDistanceScale <= 0.f)
+    return rd.occlusionDistance;
+  const float diagonal =
+      empty(fd.world.bounds) ? 0.f : length(size(fd.world.bounds));
+  return min(rd.occlusionDistance, rd.occlusionDistanceScale * diagonal);
+}
+
+// estimateAO() at 'currentHit', tracing occlusion rays of 'rayType'
 template <typename T>
 RT_FUNCTION float computeAO(ScreenSample &ss,
     const Ray &primaryRay,
     T rayType,
     const Hit &currentHit,
     float dist,
-    int numSamples)
+    int numSamples,
+    vec3 *bentNormal = nullptr)
 {
-  float weights = 0.0f;
-  float hits = 0.0f;
-  for (int i = 0; i < numSamples; i++) {
-    Ray aoRay;
-    aoRay.org = currentHit.hitpoint + (currentHit.epsilon * currentHit.Ng);
-    aoRay.dir = randomDir(ss.rs, currentHit.Ns);
-    aoRay.t.upper = dist;
-    const float weight = max(0.f, dot(aoRay.dir, currentHit.Ns));
-    weights += weight;
-    if (weight != 0.f && isOccluded(ss, aoRay, rayType))
-      hits += weight;
-  }
-
-  return 1.f - hits / weights;
+  const auto &fd = *ss.frameData;
+  return estimateAO(currentHit,
+      dist,
+      numSamples,
+      AOSampling(fd.renderer.aoSampling),
+      fd.fb.frameID,
+      ss.pixel.x + ss.pixel.y * fd.fb.size.x,
+      [&](const Ray &r) { return isOccluded(ss, r, rayType); },
+      [&]() { return curand_uniform(&ss.rs); },
+      bentNormal);
 }
 
 } // namespace visrtx
@@ -62,6 +62,7 @@ RT_FUNCTION ScreenSample createScreenSample(const FrameGPUData &frameData)
   ss.pixel.x = x;
   ss.pixel.y = y;
   ss.frameData = &frameData;
+  ss.cost = nullptr;
 
   return ss;
 }
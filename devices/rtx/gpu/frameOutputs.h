@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/gpu_objects.h"
+
+// Writing the samples of raygen programs to the frame buffers. These don't
+// depend on OptiX, so host code can accumulate frames the same way.
+
+namespace visrtx {
+
+RT_FUNCTION bool pixelOutOfFrame(
+    const uvec2 &pixel, const FramebufferGPUData &fb)
+{
+  return pixel.x >= fb.size.x || pixel.y >= fb.size.y;
+}
+
+namespace detail {
+
+template <typename T>
+RT_FUNCTION void accumValue(T *arr, size_t idx, size_t fid, const T &v)
+{
+  if (!arr)
+    return;
+
+  if (fid == 0)
+    arr[idx] = v;
+  else
+    arr[idx] += v;
+}
+
+RT_FUNCTION bool accumDepth(float *arr, size_t idx, size_t fid, const float &v)
+{
+  if (!arr)
+    return true; // no previous depth to compare with
+
+  const bool closerSample = fid == 0 || arr[idx] < v;
+
+  if (closerSample)
+    arr[idx] = v;
+
+  return closerSample;
+}
+
+RT_FUNCTION void writeOutputColor(
+    const FramebufferGPUData &fb, const vec4 &color, uint32_t idx)
+{
+  const auto c = color * fb.invFrameID;
+  if (fb.format == FrameFormat::SRGB) {
+    fb.buffers.outColorUint[idx] =
+        glm::packUnorm4x8(glm::convertLinearToSRGB(c));
+  } else if (fb.format == FrameFormat::UINT)
+    fb.buffers.outColorUint[idx] = glm::packUnorm4x8(c);
+  else
+    fb.buffers.outColorVec4[idx] = c;
+}
+
+RT_FUNCTION uint32_t pixelIndex(
+    const FramebufferGPUData &fb, const uvec2 &pixel)
+{
+  return pixel.x + pixel.y * fb.size.x;
+}
+
+} // namespace detail
+
+RT_FUNCTION void accumResults(const FramebufferGPUData &fb,
+    const uvec2 &pixel,
+    const vec4 &color,
+    float depth,
+    const vec3 &albedo,
+    const vec3 &normal,
+    uint32_t primID,
+    uint32_t objID,
+    uint32_t instID)
+{
+  const uint32_t idx = detail::pixelIndex(fb, pixel);
+
+  detail::accumValue(fb.buffers.colorAccumulation, idx, fb.frameID, color);
+  detail::accumValue(fb.buffers.albedo, idx, fb.frameID, albedo);
+  detail::accumValue(fb.buffers.normal, idx, fb.frameID, normal);
+
+  if (detail::accumDepth(fb.buffers.depth, idx, fb.frameID, depth)) {
+    if (fb.buffers.primID)
+      fb.buffers.primID[idx] = primID;
+    if (fb.buffers.objID)
+      fb.buffers.objID[idx] = objID;
+    if (fb.buffers.instID)
+      fb.buffers.instID[idx] = instID;
+  }
+
+  const auto accumColor = fb.buffers.colorAccumulation[idx];
+  detail::writeOutputColor(fb, accumColor, idx);
+
+  if (fb.checkerboardID == 0 && fb.frameID == 0) {
+    auto adjPix = uvec2(pixel.x + 1, pixel.y + 0);
+    if (!pixelOutOfFrame(adjPix, fb))
+      detail::writeOutputColor(fb, accumColor, detail::pixelIndex(fb, adjPix));
+
+    adjPix = uvec2(pixel.x + 0, pixel.y + 1);
+    if (!pixelOutOfFrame(adjPix, fb))
+      detail::writeOutputColor(fb, accumColor, detail::pixelIndex(fb, adjPix));
+
+    adjPix = uvec2(pixel.x + 1, pixel.y + 1);
+    if (!pixelOutOfFrame(adjPix, fb))
+      detail::writeOutputColor(fb, accumColor, detail::pixelIndex(fb, adjPix));
+  }
+}
+
+RT_FUNCTION void accumBentNormal(
+    const FramebufferGPUData &fb, const uvec2 &pixel, const vec3 &bentNormal)
+{
+  detail::accumValue(fb.buffers.bentNormal,
+      detail::pixelIndex(fb, pixel),
+      fb.frameID,
+      bentNormal);
+}
+
+} // namespace visrtx
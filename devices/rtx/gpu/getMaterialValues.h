@@ -31,7 +31,10 @@
 
 #pragma once
 
+#include "gpu/bsdf.h"
 #include "gpu/gpu_util.h"
+#include "gpu/materialValues.h"
+#include "gpu/sampleSpatialField.h"
 #include "utility/AnariTypeHelpers.h"
 
 namespace visrtx {
@@ -169,7 +172,8 @@ RT_FUNCTION uint32_t decodeCurveAttributeIndices(
   return ggd.curve.indices[hit.primID];
 }
 
-RT_FUNCTION vec4 readAttributeValue(uint32_t attributeID, const SurfaceHit &hit)
+RT_FUNCTION vec4 readAttributeValue(
+    const FrameGPUData &fd, uint32_t attributeID, const SurfaceHit &hit)
 {
   const auto &ggd = *hit.geometry;
 
@@ -228,14 +232,32 @@ RT_FUNCTION vec4 readAttributeValue(uint32_t attributeID, const SurfaceHit &hit)
     const uint32_t idx = decodeSphereAttributeIndices(ggd, hit);
     if (isPopulated(ap))
       return getAttributeValue(ap, idx);
+  } else if (ggd.type == GeometryType::SLICE && attributeID == 4) {
+    // Slices are colored by the volume, from the field value sampled at 'u'
+    vec4 c = classifySample(getVolumeData(fd, ggd.slice.volume), hit.uvw.y);
+    c.w = glm::min(c.w, 1.f); // undo 'densityScale' > 1
+    return c;
   }
 
   // Else fall through to per-primitive attributes
   const auto &ap = ggd.attr[attributeID];
-  if (ggd.type == GeometryType::QUAD)
-    return getAttributeValue(ap, hit.primID / 2);
-  else
-    return getAttributeValue(ap, hit.primID);
+  if (isPopulated(ap)) {
+    if (ggd.type == GeometryType::QUAD)
+      return getAttributeValue(ap, hit.primID / 2);
+    else if (ggd.type == GeometryType::ISOSURFACE) // one per isovalue
+      return getAttributeValue(ap, uint32_t(hit.uvw.y));
+    else
+      return getAttributeValue(ap, hit.primID);
+  }
+
+  // Else fall through to per-instance attributes
+  if (hit.instance && hit.instance->attr) {
+    const auto &iap = hit.instance->attr[attributeID];
+    if (isPopulated(iap))
+      return getAttributeValue(iap, hit.instance->arrayIndex);
+  }
+
+  return vec4(0.f, 0.f, 0.f, 1.f);
 }
 
 template <typename T>
@@ -245,7 +267,7 @@ RT_FUNCTION T evaluateSampler(
   vec4 retval{0.f};
   const auto &sampler = getSamplerData(fd, _s);
   const vec4 tc =
-      sampler.inTransform * readAttributeValue(sampler.attribute, hit)
+      sampler.inTransform * readAttributeValue(fd, sampler.attribute, hit)
       + sampler.inOffset;
   switch (sampler.type) {
   case SamplerType::TEXTURE1D: {
@@ -282,15 +304,15 @@ RT_FUNCTION T getMaterialParameter(const FrameGPUData &fd,
   case MaterialParameterType::SAMPLER:
     return evaluateSampler<T>(fd, mp.sampler, hit);
   case MaterialParameterType::ATTRIB_0:
-    return bit_cast<T>(readAttributeValue(0, hit));
+    return bit_cast<T>(readAttributeValue(fd, 0, hit));
   case MaterialParameterType::ATTRIB_1:
-    return bit_cast<T>(readAttributeValue(1, hit));
+    return bit_cast<T>(readAttributeValue(fd, 1, hit));
   case MaterialParameterType::ATTRIB_2:
-    return bit_cast<T>(readAttributeValue(2, hit));
+    return bit_cast<T>(readAttributeValue(fd, 2, hit));
   case MaterialParameterType::ATTRIB_3:
-    return bit_cast<T>(readAttributeValue(3, hit));
+    return bit_cast<T>(readAttributeValue(fd, 3, hit));
   case MaterialParameterType::ATTRIB_COLOR:
-    return bit_cast<T>(readAttributeValue(4, hit));
+    return bit_cast<T>(readAttributeValue(fd, 4, hit));
   case MaterialParameterType::WORLD_POSITION:
     return bit_cast<T>(vec4(hit.hitpoint, 1.f));
   case MaterialParameterType::WORLD_NORMAL:
@@ -312,19 +334,11 @@ RT_FUNCTION T getMaterialParameter(const FrameGPUData &fd,
 RT_FUNCTION MaterialValues getMaterialValues(
     const FrameGPUData &fd, const MaterialGPUData &md, const SurfaceHit &hit)
 {
-  MaterialValues retval;
-  const auto c = getMaterialParameter(fd, md.baseColor, hit);
-  retval.baseColor = vec3(c);
-  if (md.mode == AlphaMode::OPAQUE)
-    retval.opacity = 1.f;
-  else {
-    float opacity = getMaterialParameter(fd, md.opacity, hit) * c.w;
-    if (md.mode == AlphaMode::BLEND)
-      retval.opacity = opacity;
-    else
-      retval.opacity = opacity < md.cutoff ? 0.f : 1.f;
-  }
-  return retval;
+  return evaluateMaterialValues(
+      md,
+      hit,
+      [&](const auto &mp) { return getMaterialParameter(fd, mp, hit); },
+      [&](DeviceObjectIndex s) { return evaluateSampler<vec4>(fd, s, hit); });
 }
 
 } // namespace visrtx
@@ -45,3 +45,11 @@
 #define SBT_TRIANGLE_OFFSET 0
 #define SBT_CURVE_OFFSET 1
 #define SBT_CUSTOM_OFFSET 2
+
+// Instance visibility mask bits: the low nibble selects which ray categories
+// see an instance's surfaces, the high nibble the same for its volumes
+#define VISIBILITY_MASK_CAMERA 0x1u
+#define VISIBILITY_MASK_SHADOW 0x2u
+#define VISIBILITY_MASK_SECONDARY 0x4u
+#define VISIBILITY_MASK_ALL 0xFu
+#define VISIBILITY_MASK_VOLUME_SHIFT 4
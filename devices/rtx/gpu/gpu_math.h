@@ -87,6 +87,7 @@ struct Ray
 };
 
 struct GeometryGPUData;
+struct InstanceSurfaceGPUData;
 struct MaterialGPUData;
 struct VolumeGPUData;
 
@@ -104,6 +105,7 @@ struct SurfaceHit
   float epsilon;
   const GeometryGPUData *geometry{nullptr};
   const MaterialGPUData *material{nullptr};
+  const InstanceSurfaceGPUData *instance{nullptr};
 };
 
 struct VolumeHit
@@ -195,6 +197,12 @@ VISRTX_HOST_DEVICE bool empty(const box3 &r)
       || r.lower.z > r.upper.z;
 }
 
+VISRTX_HOST_DEVICE bool contains(const vec3 &p, const box3 &r)
+{
+  return p.x >= r.lower.x && p.y >= r.lower.y && p.z >= r.lower.z
+      && p.x <= r.upper.x && p.y <= r.upper.y && p.z <= r.upper.z;
+}
+
 // Helper functions ///////////////////////////////////////////////////////////
 
 VISRTX_HOST_DEVICE int64_t iDivUp(int64_t a, int64_t b)
@@ -202,6 +210,13 @@ VISRTX_HOST_DEVICE int64_t iDivUp(int64_t a, int64_t b)
   return (a + b - 1) / b;
 }
 
+#define ulpEpsilon 0x1.fp-21
+
+VISRTX_HOST_DEVICE float epsilonFrom(const vec3 &P, const vec3 &dir, float t)
+{
+  return glm::compMax(vec4(abs(P), glm::compMax(abs(dir)) * t)) * ulpEpsilon;
+}
+
 VISRTX_HOST_DEVICE bool intersectBox(
     const box3 &b, const vec3 &org, const vec3 &dir, box1 &inout)
 {
@@ -216,4 +231,14 @@ VISRTX_HOST_DEVICE bool intersectBox(
   return tin < tout;
 }
 
+// Normalized texture coordinates of 'p' in a structured regular grid, whose
+// voxel values sit at the texel centers ('invSpacing' spans the whole grid)
+VISRTX_HOST_DEVICE vec3 structuredRegularTexCoords(const vec3 &p,
+    const vec3 &origin,
+    const vec3 &spacing,
+    const vec3 &invSpacing)
+{
+  return ((p - origin) + 0.5f * spacing) * invSpacing;
+}
+
 } // namespace visrtx
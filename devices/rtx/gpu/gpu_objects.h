@@ -32,6 +32,7 @@
 #pragma once
 
 #include "gpu/gpu_math.h"
+#include "gpu/traversalCost.h"
 // optix
 #include <optix.h>
 // curand
@@ -59,14 +60,26 @@ enum class CameraType
 {
   PERSPECTIVE,
   ORTHOGRAPHIC,
+  OMNIDIRECTIONAL,
   UNKNOWN
 };
 
+enum class StereoMode
+{
+  NONE,
+  LEFT,
+  RIGHT,
+  SIDE_BY_SIDE, // left eye in the left half of the frame
+  TOP_BOTTOM // left eye in the top half of the frame
+};
+
 struct PerspectiveCameraGPUData
 {
   vec3 dir_du;
   vec3 dir_dv;
   vec3 dir_00;
+  float apertureRadius; // thin lens depth of field when > 0
+  float focusDistance;
 };
 
 struct OrthographicCameraGPUData
@@ -76,6 +89,12 @@ struct OrthographicCameraGPUData
   vec3 pos_00;
 };
 
+struct OmnidirectionalCameraGPUData
+{
+  vec3 right;
+  vec3 up; // orthogonal to 'dir', unlike CameraGPUData::up
+};
+
 struct CameraGPUData
 {
   CameraType type{CameraType::UNKNOWN};
@@ -83,10 +102,13 @@ struct CameraGPUData
   vec3 pos;
   vec3 dir;
   vec3 up;
+  StereoMode stereoMode{StereoMode::NONE};
+  float interpupillaryDistance{0.f};
   union
   {
     PerspectiveCameraGPUData perspective;
     OrthographicCameraGPUData orthographic;
+    OmnidirectionalCameraGPUData omnidirectional;
   };
 };
 
@@ -100,6 +122,8 @@ enum class GeometryType
   CURVE,
   CONE,
   SPHERE,
+  ISOSURFACE,
+  SLICE,
   UNKNOWN
 };
 
@@ -169,6 +193,21 @@ struct SphereGeometryData
   float radius;
 };
 
+struct IsosurfaceGeometryData
+{
+  DeviceObjectIndex field;
+  const float *isovalues;
+  uint32_t numIsovalues;
+  const uint32_t *cellMasks; // per macrocell, bit i set if isovalue i is in it
+  float stepSize;
+};
+
+struct SliceGeometryData
+{
+  const vec4 *planes; // (normal, offset), holding p where dot(normal, p) == w
+  DeviceObjectIndex volume; // field sampled on the planes + transfer function
+};
+
 struct GeometryGPUData
 {
   GeometryType type{GeometryType::UNKNOWN};
@@ -181,6 +220,8 @@ struct GeometryGPUData
     CurveGeometryData curve;
     ConeGeometryData cone;
     SphereGeometryData sphere;
+    IsosurfaceGeometryData isosurface;
+    SliceGeometryData slice;
   };
 };
 
@@ -274,6 +315,12 @@ struct MaterialGPUData
 {
   MaterialParameter<vec4> baseColor{vec4(1.f)};
   MaterialParameter<float> opacity{1.f};
+  MaterialParameter<float> metallic{0.f};
+  MaterialParameter<float> roughness{1.f};
+  MaterialParameter<vec3> emissive{vec3(0.f)};
+  DeviceObjectIndex normalSampler{-1}; // tangent space normal map
+  float specular{0.f}; // scales the dielectric reflectance given by 'ior'
+  float ior{1.5f};
   float cutoff;
   AlphaMode mode;
 };
@@ -282,6 +329,12 @@ struct MaterialValues
 {
   vec3 baseColor;
   float opacity;
+  float metallic{0.f};
+  float roughness{1.f};
+  vec3 emissive{0.f};
+  float specular{0.f};
+  float ior{1.5f};
+  vec3 normal{0.f}; // shading normal, after normal mapping
 };
 
 // Surface //
@@ -298,6 +351,7 @@ struct SurfaceGPUData
 enum class SpatialFieldType
 {
   STRUCTURED_REGULAR,
+  STREAMED_REGULAR,
   UNKNOWN
 };
 
@@ -309,6 +363,22 @@ struct StructuredRegularData
   vec3 invSpacing;
 };
 
+// Bricks of a pyramid of decimated levels, sampled from a cache of resident
+// bricks with a fallback to coarser levels (see gpu/streamedField.h)
+struct StreamedRegularData
+{
+  cudaTextureObject_t texObj{}; // brick cache atlas
+  const uint32_t *pageTable; // cache slot of each brick
+  uint8_t *usedBricks; // set for each finest level brick sampled
+  uvec3 dims;
+  uvec3 atlasSlots;
+  uint32_t brickSize;
+  uint32_t numLevels;
+  vec3 origin;
+  vec3 spacing;
+  vec3 invSpacing;
+};
+
 struct UniformGridData
 {
   ivec3 dims;
@@ -323,6 +393,7 @@ struct SpatialFieldGPUData
   union
   {
     StructuredRegularData structuredRegular{};
+    StreamedRegularData streamedRegular;
   } data;
   UniformGridData grid;
 };
@@ -394,6 +465,9 @@ struct InstanceSurfaceGPUData
 {
   const DeviceObjectIndex *surfaces;
   uint32_t id;
+  uint32_t arrayIndex; // element of the instance's transform array
+  const AttributePtr *attr; // attribute0-3 + color, nullptr if not present
+  const uint32_t *ids; // per-surface ids of a merged BLAS, nullptr otherwise
 };
 
 struct InstanceVolumeGPUData
@@ -422,6 +496,8 @@ struct WorldGPUData
 
   const InstanceLightGPUData *lightInstances;
   size_t numLightInstances;
+
+  box3 bounds;
 };
 
 // Renderer //
@@ -460,7 +536,8 @@ union RendererParametersGPUData
 enum class BackgroundMode
 {
   COLOR,
-  IMAGE
+  IMAGE,
+  ENVIRONMENT
 };
 
 union RendererBackgroundGPUData
@@ -477,6 +554,8 @@ struct RendererGPUData
   glm::vec3 ambientColor;
   float ambientIntensity;
   float occlusionDistance;
+  float occlusionDistanceScale;
+  int aoSampling;
 };
 
 // Frame //
@@ -500,6 +579,7 @@ struct FrameBuffers
   uint32_t *instID;
   glm::vec3 *albedo;
   glm::vec3 *normal;
+  glm::vec3 *bentNormal;
 };
 
 struct FramebufferGPUData
@@ -511,6 +591,51 @@ struct FramebufferGPUData
   FrameFormat format;
   glm::uvec2 size;
   glm::vec2 invSize;
+  float costScale; // cost mapped to the top of debug heat maps
+  uint32_t *costMax; // bits of the largest cost in the frame, if tracked
+};
+
+struct PickResult
+{
+  vec3 position;
+  float distance;
+  uint32_t primID;
+  uint32_t objID;
+  uint32_t instID;
+  uint32_t hit;
+};
+
+struct PickGPUData
+{
+  const vec2 *screens{nullptr};
+  PickResult *results{nullptr}; // only set for pick launches
+  uint32_t count{0};
+};
+
+struct RayQueryRay
+{
+  vec3 org;
+  float tmin;
+  vec3 dir;
+  float tmax;
+};
+
+struct RayQueryHit
+{
+  float t;
+  vec3 Ng;
+  uint32_t primID;
+  uint32_t objID;
+  uint32_t instID;
+  uint32_t hit;
+};
+
+struct RayQueryGPUData
+{
+  const RayQueryRay *rays{nullptr};
+  RayQueryHit *hits{nullptr};
+  uint32_t count{0};
+  bool terminateOnFirstHit{false};
 };
 
 struct FrameGPUData
@@ -519,6 +644,8 @@ struct FrameGPUData
   RendererGPUData renderer;
   WorldGPUData world;
   CameraGPUData *camera;
+  PickGPUData pick;
+  RayQueryGPUData rayQuery;
 
   // Objects //
 
@@ -545,6 +672,7 @@ struct ScreenSample
   glm::vec2 screen;
   RandState rs;
   const FrameGPUData *frameData;
+  TraversalCost *cost;
 };
 
 } // namespace visrtx
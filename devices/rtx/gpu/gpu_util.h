@@ -31,7 +31,9 @@
 
 #pragma once
 
+#include "gpu/background.h"
 #include "gpu/cameraCreateRay.h"
+#include "gpu/frameOutputs.h"
 #include "gpu/gpu_objects.h"
 // optix
 #include <optix_device.h>
@@ -183,19 +185,6 @@ RT_FUNCTION vec3 sampleUnitSphere(RandState &rs, const vec3 &normal)
   return normalize(sint * cosf(phi) * u + sint * sinf(phi) * v + cost * -w);
 }
 
-#define ulpEpsilon 0x1.fp-21
-
-RT_FUNCTION float epsilonFrom(const vec3 &P, const vec3 &dir, float t)
-{
-  return glm::compMax(vec4(abs(P), glm::compMax(abs(dir)) * t)) * ulpEpsilon;
-}
-
-RT_FUNCTION bool pixelOutOfFrame(
-    const uvec2 &pixel, const FramebufferGPUData &fb)
-{
-  return pixel.x >= fb.size.x || pixel.y >= fb.size.y;
-}
-
 RT_FUNCTION bool isFirstPixel(const uvec2 &pixel, const FramebufferGPUData &fb)
 {
   return pixel.x == 0 && pixel.y == 0;
@@ -206,105 +195,44 @@ RT_FUNCTION bool isMiddelPixel(const uvec2 &pixel, const FramebufferGPUData &fb)
   return pixel.x == (fb.size.x / 2) && pixel.y == (fb.size.y / 2);
 }
 
-RT_FUNCTION vec4 getBackground(const RendererGPUData &rd, const vec2 &loc)
-{
-  return rd.backgroundMode == BackgroundMode::COLOR
-      ? rd.background.color
-      : make_vec4(tex2D<::float4>(rd.background.texobj, loc.x, loc.y));
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Outputs ////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////
-
-namespace detail {
-
-template <typename T>
-RT_FUNCTION void accumValue(T *arr, size_t idx, size_t fid, const T &v)
-{
-  if (!arr)
-    return;
-
-  if (fid == 0)
-    arr[idx] = v;
-  else
-    arr[idx] += v;
-}
-
-RT_FUNCTION bool accumDepth(float *arr, size_t idx, size_t fid, const float &v)
+// Background seen along 'dir' from screen position 'screen'. Image
+// backgrounds are filtered over the footprint of one pixel, which is taken
+// from the camera rays of the neighboring pixels for primary rays and is a
+// single texel for secondary rays.
+RT_FUNCTION vec4 getBackground(const FrameGPUData &fd,
+    const vec2 &screen,
+    const vec3 &dir,
+    bool primaryRay = true)
 {
-  if (!arr)
-    return true; // no previous depth to compare with
+  const auto &rd = fd.renderer;
+  const auto texobj = rd.background.texobj;
 
-  const bool closerSample = fid == 0 || arr[idx] < v;
-
-  if (closerSample)
-    arr[idx] = v;
-
-  return closerSample;
-}
-
-RT_FUNCTION void writeOutputColor(
-    const FramebufferGPUData &fb, const vec4 &color, uint32_t idx)
-{
-  const auto c = color * fb.invFrameID;
-  if (fb.format == FrameFormat::SRGB) {
-    fb.buffers.outColorUint[idx] =
-        glm::packUnorm4x8(glm::convertLinearToSRGB(c));
-  } else if (fb.format == FrameFormat::UINT)
-    fb.buffers.outColorUint[idx] = glm::packUnorm4x8(c);
-  else
-    fb.buffers.outColorVec4[idx] = c;
-}
-
-RT_FUNCTION uint32_t pixelIndex(
-    const FramebufferGPUData &fb, const uvec2 &pixel)
-{
-  return pixel.x + pixel.y * fb.size.x;
-}
-
-} // namespace detail
-
-RT_FUNCTION void accumResults(const FramebufferGPUData &fb,
-    const uvec2 &pixel,
-    const vec4 &color,
-    float depth,
-    const vec3 &albedo,
-    const vec3 &normal,
-    uint32_t primID,
-    uint32_t objID,
-    uint32_t instID)
-{
-  const uint32_t idx = detail::pixelIndex(fb, pixel);
-
-  detail::accumValue(fb.buffers.colorAccumulation, idx, fb.frameID, color);
-  detail::accumValue(fb.buffers.albedo, idx, fb.frameID, albedo);
-  detail::accumValue(fb.buffers.normal, idx, fb.frameID, normal);
-
-  if (detail::accumDepth(fb.buffers.depth, idx, fb.frameID, depth)) {
-    if (fb.buffers.primID)
-      fb.buffers.primID[idx] = primID;
-    if (fb.buffers.objID)
-      fb.buffers.objID[idx] = objID;
-    if (fb.buffers.instID)
-      fb.buffers.instID[idx] = instID;
+  switch (rd.backgroundMode) {
+  case BackgroundMode::IMAGE: {
+    const ::float2 dx = make_float2(fd.fb.invSize.x, 0.f);
+    const ::float2 dy = make_float2(0.f, fd.fb.invSize.y);
+    return make_vec4(tex2DGrad<::float4>(texobj, screen.x, screen.y, dx, dy));
   }
-
-  const auto accumColor = fb.buffers.colorAccumulation[idx];
-  detail::writeOutputColor(fb, accumColor, idx);
-
-  if (fb.checkerboardID == 0 && fb.frameID == 0) {
-    auto adjPix = uvec2(pixel.x + 1, pixel.y + 0);
-    if (!pixelOutOfFrame(adjPix, fb))
-      detail::writeOutputColor(fb, accumColor, detail::pixelIndex(fb, adjPix));
-
-    adjPix = uvec2(pixel.x + 0, pixel.y + 1);
-    if (!pixelOutOfFrame(adjPix, fb))
-      detail::writeOutputColor(fb, accumColor, detail::pixelIndex(fb, adjPix));
-
-    adjPix = uvec2(pixel.x + 1, pixel.y + 1);
-    if (!pixelOutOfFrame(adjPix, fb))
-      detail::writeOutputColor(fb, accumColor, detail::pixelIndex(fb, adjPix));
+  case BackgroundMode::ENVIRONMENT: {
+    const vec2 uv = equirectangularCoords(dir);
+    if (!primaryRay)
+      return make_vec4(tex2DLod<::float4>(texobj, uv.x, uv.y, 0.f));
+
+    const vec2 sx = screen + vec2(fd.fb.invSize.x, 0.f);
+    const vec2 sy = screen + vec2(0.f, fd.fb.invSize.y);
+    const vec2 dx = wrappedCoordsDifference(
+        equirectangularCoords(cameraCreateRay(fd.camera, sx).dir), uv);
+    const vec2 dy = wrappedCoordsDifference(
+        equirectangularCoords(cameraCreateRay(fd.camera, sy).dir), uv);
+    return make_vec4(tex2DGrad<::float4>(texobj,
+        uv.x,
+        uv.y,
+        make_float2(dx.x, dx.y),
+        make_float2(dy.x, dy.y)));
+  }
+  case BackgroundMode::COLOR:
+  default:
+    return rd.background.color;
   }
 }
 
@@ -42,10 +42,15 @@ RT_FUNCTION void launchRay(ScreenSample &ss,
     T rayType,
     bool tracingSurfaces,
     void *dataPtr,
-    uint32_t optixFlags)
+    uint32_t optixFlags,
+    uint32_t visibility)
 {
   uint32_t bvhSelection = tracingSurfaces;
 
+  const uint32_t mask = tracingSurfaces
+      ? visibility
+      : (visibility << VISIBILITY_MASK_VOLUME_SHIFT);
+
   uint32_t u0, u1;
   packPointer(&ss, u0, u1);
 
@@ -62,7 +67,7 @@ RT_FUNCTION void launchRay(ScreenSample &ss,
       r.t.lower,
       r.t.upper,
       0.0f,
-      OptixVisibilityMask(255),
+      OptixVisibilityMask(mask),
       optixFlags,
       static_cast<uint32_t>(rayType) * NUM_SBT_PRIMITIVE_INTERSECTOR_ENTRIES,
       0u,
@@ -81,9 +86,10 @@ RT_FUNCTION void intersectSurface(ScreenSample &ss,
     Ray r,
     T rayType,
     void *dataPtr = nullptr,
-    uint32_t optixFlags = OPTIX_RAY_FLAG_DISABLE_ANYHIT)
+    uint32_t optixFlags = OPTIX_RAY_FLAG_DISABLE_ANYHIT,
+    uint32_t visibility = VISIBILITY_MASK_CAMERA)
 {
-  detail::launchRay(ss, r, rayType, true, dataPtr, optixFlags);
+  detail::launchRay(ss, r, rayType, true, dataPtr, optixFlags, visibility);
 }
 
 template <typename T>
@@ -91,16 +97,24 @@ RT_FUNCTION void intersectVolume(ScreenSample &ss,
     Ray r,
     T rayType,
     void *dataPtr = nullptr,
-    uint32_t optixFlags = OPTIX_RAY_FLAG_DISABLE_ANYHIT)
+    uint32_t optixFlags = OPTIX_RAY_FLAG_DISABLE_ANYHIT,
+    uint32_t visibility = VISIBILITY_MASK_CAMERA)
 {
-  detail::launchRay(ss, r, rayType, false, dataPtr, optixFlags);
+  detail::launchRay(ss, r, rayType, false, dataPtr, optixFlags, visibility);
 }
 
 template <typename T>
 RT_FUNCTION bool isOccluded(ScreenSample &ss, Ray r, T rayType)
 {
   uint32_t o = 0;
-  intersectSurface(ss, r, rayType, &o, OPTIX_RAY_FLAG_DISABLE_CLOSESTHIT);
+  // Opaque instances skip any-hit, so the closest-hit program of the ray type
+  // must mark the ray as occluded
+  intersectSurface(ss,
+      r,
+      rayType,
+      &o,
+      OPTIX_RAY_FLAG_TERMINATE_ON_FIRST_HIT,
+      VISIBILITY_MASK_SHADOW);
   return static_cast<bool>(o);
 }
 
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/gpu_math.h"
+// std
+#include <cstdint>
+
+namespace visrtx {
+
+// Most isovalues one isosurface geometry can hold, one bit each in the
+// per-macrocell masks
+constexpr uint32_t MAX_ISOVALUES = 32;
+
+// Bit i is set if isovalues[i] lies in the value range of a macrocell, so
+// cells with an empty mask can't contain any of the surfaces
+RT_FUNCTION uint32_t isovalueMask(
+    const box1 &valueRange, const float *isovalues, uint32_t numIsovalues)
+{
+  uint32_t mask = 0;
+  for (uint32_t i = 0; i < numIsovalues && i < MAX_ISOVALUES; i++) {
+    const float v = isovalues[i];
+    if (v >= valueRange.lower && v <= valueRange.upper)
+      mask |= 1u << i;
+  }
+  return mask;
+}
+
+RT_FUNCTION box3 macrocellBounds(
+    const ivec3 &dims, const box3 &worldBounds, uint32_t cellID)
+{
+  const ivec3 cell(cellID % dims.x,
+      cellID / dims.x % dims.y,
+      cellID / (size_t(dims.x) * dims.y));
+  const vec3 cellSize = (worldBounds.upper - worldBounds.lower) / vec3(dims);
+  const vec3 lower = worldBounds.lower + vec3(cell) * cellSize;
+  return box3(lower, lower + cellSize);
+}
+
+RT_FUNCTION box1 clipRayToBox(
+    const vec3 &org, const vec3 &dir, const box3 &bounds, const box1 &rayT)
+{
+  const vec3 mins = (bounds.lower - org) * (1.f / dir);
+  const vec3 maxs = (bounds.upper - org) * (1.f / dir);
+  const vec3 nears = glm::min(mins, maxs);
+  const vec3 fars = glm::max(mins, maxs);
+  return box1(glm::max(glm::compMax(nears), rayT.lower),
+      glm::min(glm::compMin(fars), rayT.upper));
+}
+
+// Narrow down a crossing of 'isovalue' known to lie between t0 and t1 by
+// bisection, then interpolate linearly within the final interval
+template <typename SAMPLE_FCN>
+RT_FUNCTION float refineIsoCrossing(const SAMPLE_FCN &sample,
+    float isovalue,
+    float t0,
+    float s0,
+    float t1,
+    float s1,
+    int iterations = 6)
+{
+  for (int i = 0; i < iterations; i++) {
+    const float tm = 0.5f * (t0 + t1);
+    const float sm = sample(tm);
+    if ((s0 - isovalue) * (sm - isovalue) <= 0.f) {
+      t1 = tm;
+      s1 = sm;
+    } else {
+      t0 = tm;
+      s0 = sm;
+    }
+  }
+  const float ds = s1 - s0;
+  const float f = ds != 0.f ? glm::clamp((isovalue - s0) / ds, 0.f, 1.f) : 0.f;
+  return t0 + f * (t1 - t0);
+}
+
+// March 't' in steps of 'dt' and find the first crossing of any isovalue
+// enabled in 'mask'; returns false if there is none in the interval
+template <typename SAMPLE_FCN>
+RT_FUNCTION bool findIsoCrossing(const SAMPLE_FCN &sample,
+    const float *isovalues,
+    uint32_t mask,
+    const box1 &t,
+    float dt,
+    float &tHit,
+    uint32_t &isoID)
+{
+  if (!(t.lower <= t.upper) || !(dt > 0.f) || mask == 0)
+    return false;
+
+  float t0 = t.lower;
+  float s0 = sample(t0);
+
+  while (t0 < t.upper) {
+    const float t1 = glm::min(t0 + dt, t.upper);
+    const float s1 = sample(t1);
+
+    bool found = false;
+    for (uint32_t m = mask; m != 0; m &= m - 1) {
+#ifdef __CUDACC__
+      const uint32_t i = __ffs(m) - 1;
+#else
+      uint32_t i = 0;
+      while (!(m & (1u << i)))
+        i++;
+#endif
+      const float v = isovalues[i];
+      const float d0 = s0 - v;
+      const float d1 = s1 - v;
+      if (d0 * d1 <= 0.f && d0 != d1) {
+        const float tc = refineIsoCrossing(sample, v, t0, s0, t1, s1);
+        if (!found || tc < tHit) {
+          tHit = tc;
+          isoID = i;
+          found = true;
+        }
+      }
+    }
+
+    if (found)
+      return true;
+
+    t0 = t1;
+    s0 = s1;
+  }
+
+  return false;
+}
+
+template <typename SAMPLE_FCN>
+RT_FUNCTION vec3 centralDifferenceGradient(
+    const SAMPLE_FCN &sample, const vec3 &p, float h)
+{
+  const float inv = 0.5f / h;
+  return vec3(sample(p + vec3(h, 0.f, 0.f)) - sample(p - vec3(h, 0.f, 0.f)),
+             sample(p + vec3(0.f, h, 0.f)) - sample(p - vec3(0.f, h, 0.f)),
+             sample(p + vec3(0.f, 0.f, h)) - sample(p - vec3(0.f, 0.f, h)))
+      * inv;
+}
+
+} // namespace visrtx
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/bsdf.h"
+
+namespace visrtx {
+
+// Combine the parameters of material 'md' at 'hit' into the values shading
+// uses. 'param(mp)' evaluates a MaterialParameter<> and 'normalMap(s)' returns
+// the texel of normal sampler 's', which lets host code reuse this without the
+// samplers and attributes only the GPU can read.
+template <typename PARAM_FCN, typename NORMAL_MAP_FCN>
+RT_FUNCTION MaterialValues evaluateMaterialValues(const MaterialGPUData &md,
+    const SurfaceHit &hit,
+    PARAM_FCN &&param,
+    NORMAL_MAP_FCN &&normalMap)
+{
+  MaterialValues retval;
+  const auto c = param(md.baseColor);
+  retval.baseColor = vec3(c);
+  if (md.mode == AlphaMode::OPAQUE)
+    retval.opacity = 1.f;
+  else {
+    float opacity = param(md.opacity) * c.w;
+    if (md.mode == AlphaMode::BLEND)
+      retval.opacity = opacity;
+    else
+      retval.opacity = opacity < md.cutoff ? 0.f : 1.f;
+  }
+  retval.metallic = glm::clamp(param(md.metallic), 0.f, 1.f);
+  retval.roughness = glm::clamp(param(md.roughness), 0.f, 1.f);
+  retval.emissive = param(md.emissive);
+  retval.specular = md.specular;
+  retval.ior = md.ior;
+  retval.normal = hit.Ns;
+  if (md.normalSampler >= 0) {
+    // Geometries carry no tangents, so the map is applied in a frame built
+    // around the interpolated normal
+    const vec3 n = 2.f * vec3(normalMap(md.normalSampler)) - 1.f;
+    const auto frame = makeShadingFrame(normalize(hit.Ns));
+    retval.normal = normalize(frame.toWorld(n));
+  }
+  return retval;
+}
+
+} // namespace visrtx
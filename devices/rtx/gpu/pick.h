@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/gpu_objects.h"
+
+namespace visrtx {
+
+// The closest of a surface and a volume hit along a pick ray, reported with
+// the same IDs the primitiveId/objectId/instanceId channels would hold
+RT_FUNCTION PickResult resolvePick(
+    const Ray &ray, const SurfaceHit &surfaceHit, const VolumeHit &volumeHit)
+{
+  PickResult result;
+  result.position = vec3(0.f);
+  result.distance = ray.t.upper;
+  result.primID = ~0u;
+  result.objID = ~0u;
+  result.instID = ~0u;
+  result.hit = surfaceHit.foundHit || volumeHit.foundHit;
+
+  const bool volumeFirst = volumeHit.foundHit
+      && (!surfaceHit.foundHit || volumeHit.localRay.t.lower < surfaceHit.t);
+
+  if (volumeFirst) {
+    result.distance = volumeHit.localRay.t.lower;
+    result.primID = 0;
+    result.objID = volumeHit.volumeData->id;
+    result.instID = volumeHit.instID;
+  } else if (surfaceHit.foundHit) {
+    result.distance = surfaceHit.t;
+    result.primID = surfaceHit.primID;
+    result.objID = surfaceHit.objID;
+    result.instID = surfaceHit.instID;
+  }
+
+  if (result.hit)
+    result.position = ray.org + result.distance * ray.dir;
+
+  return result;
+}
+
+} // namespace visrtx
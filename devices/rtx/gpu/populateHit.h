@@ -154,7 +154,7 @@ RT_FUNCTION uint32_t objID()
 
 RT_FUNCTION uint32_t instID()
 {
-  return optixGetInstanceIndex();
+  return optixGetInstanceId();
 }
 
 RT_FUNCTION ScreenSample &screenSample()
@@ -238,7 +238,9 @@ RT_FUNCTION void computeNormal(
   }
   case GeometryType::SPHERE:
   case GeometryType::CONE:
-  case GeometryType::CYLINDER: {
+  case GeometryType::CYLINDER:
+  case GeometryType::ISOSURFACE:
+  case GeometryType::SLICE: {
     hit.Ng = hit.Ns = vec3(bit_cast<float>(optixGetAttribute_1()),
         bit_cast<float>(optixGetAttribute_2()),
         bit_cast<float>(optixGetAttribute_3()));
@@ -283,12 +285,13 @@ RT_FUNCTION void populateSurfaceHit(SurfaceHit &hit)
   hit.foundHit = true;
   hit.geometry = &gd;
   hit.material = &md;
+  hit.instance = &isd;
   hit.t = ray::t();
   hit.hitpoint = ray::hitpoint();
   hit.uvw = ray::uvw(gd.type);
   hit.primID = ray::primID();
   hit.objID = sd.id;
-  hit.instID = isd.id;
+  hit.instID = isd.ids ? isd.ids[ray::objID()] : isd.id;
   hit.epsilon = epsilonFrom(ray::hitpoint(), ray::direction(), ray::t());
   ray::computeNormal(gd, ray::primID(), hit);
 }
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/gpu_objects.h"
+
+namespace visrtx {
+namespace detail {
+
+RT_FUNCTION bool isFinite(const vec3 &v)
+{
+  return !glm::any(glm::isnan(v)) && !glm::any(glm::isinf(v));
+}
+
+} // namespace detail
+
+// Rays OptiX can trace: finite origin and direction, a non-zero direction and
+// an interval with 0 <= tmin <= tmax, where tmax may be infinite
+RT_FUNCTION bool isValidQueryRay(const RayQueryRay &r)
+{
+  return detail::isFinite(r.org) && detail::isFinite(r.dir)
+      && r.dir != vec3(0.f) && r.tmin >= 0.f && r.tmin <= r.tmax;
+}
+
+RT_FUNCTION RayQueryHit rayQueryMiss(const RayQueryRay &r)
+{
+  RayQueryHit h;
+  h.t = r.tmax;
+  h.Ng = vec3(0.f);
+  h.primID = ~0u;
+  h.objID = ~0u;
+  h.instID = ~0u;
+  h.hit = false;
+  return h;
+}
+
+RT_FUNCTION RayQueryHit rayQueryHit(const SurfaceHit &hit)
+{
+  RayQueryHit h;
+  h.t = hit.t;
+  h.Ng = hit.Ng;
+  h.primID = hit.primID;
+  h.objID = hit.objID;
+  h.instID = hit.instID;
+  h.hit = true;
+  return h;
+}
+
+} // namespace visrtx
@@ -31,7 +31,8 @@
 
 #pragma once
 
-#include "gpu/gpu_objects.h"
+#include "gpu/gpu_util.h"
+#include "gpu/streamedField.h"
 
 namespace visrtx {
 
@@ -41,6 +42,28 @@ RT_FUNCTION const SpatialFieldGPUData &getSpatialFieldData(
   return frameData.registry.fields[idx];
 }
 
+RT_FUNCTION const VolumeGPUData &getVolumeData(
+    const FrameGPUData &frameData, DeviceObjectIndex idx)
+{
+  return frameData.registry.volumes[idx];
+}
+
+RT_FUNCTION float sampleStreamedRegularField(
+    const StreamedRegularData &sf, const vec3 &location)
+{
+  const auto sample = streamedFieldLookup(sf, location);
+
+  // Marks the finest brick as used, so the host loads it if it isn't resident
+  if (!sf.usedBricks[sample.brick])
+    sf.usedBricks[sample.brick] = 1;
+
+  if (!sample.resident)
+    return 0.f;
+
+  const auto &tc = sample.atlasCoords;
+  return tex3D<float>(sf.texObj, tc.x, tc.y, tc.z);
+}
+
 RT_FUNCTION float sampleSpatialField(
     const SpatialFieldGPUData &sf, const vec3 &location)
 {
@@ -48,13 +71,32 @@ RT_FUNCTION float sampleSpatialField(
 
   // TODO: runtime compile errors if these are in the switch()
   const auto &srf = sf.data.structuredRegular;
-  const auto srfCoords =
-      ((location - srf.origin) + 0.5f * srf.spacing) * srf.invSpacing;
+  const auto srfCoords = structuredRegularTexCoords(
+      location, srf.origin, srf.spacing, srf.invSpacing);
 
   switch (sf.type) {
   case SpatialFieldType::STRUCTURED_REGULAR:
     retval = tex3D<float>(srf.texObj, srfCoords.x, srfCoords.y, srfCoords.z);
     break;
+  case SpatialFieldType::STREAMED_REGULAR:
+    retval = sampleStreamedRegularField(sf.data.streamedRegular, location);
+    break;
+  default:
+    break;
+  }
+  return retval;
+}
+
+RT_FUNCTION vec4 classifySample(const VolumeGPUData &v, float s)
+{
+  vec4 retval(0.f);
+  switch (v.type) {
+  case VolumeType::SCIVIS: {
+    float coord = position(s, v.data.scivis.valueRange);
+    retval = make_vec4(tex1D<::float4>(v.data.scivis.tfTex, coord));
+    retval.w *= v.data.scivis.densityScale;
+    break;
+  }
   default:
     break;
   }
@@ -39,4 +39,5 @@
 #include "gpu/populateHit.h"
 #include "gpu/sampleLight.h"
 #include "gpu/sampleSpatialField.h"
+#include "gpu/tracePick.h"
 #include "gpu/volumeIntegration.h"
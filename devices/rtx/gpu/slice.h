@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/gpu_math.h"
+
+namespace visrtx {
+
+// Slice planes are stored as (normal, offset) with a unit normal, holding the
+// points p where dot(normal, p) == offset
+RT_FUNCTION vec4 normalizeSlicePlane(const vec4 &plane)
+{
+  const float len = length(vec3(plane));
+  return len > 0.f ? plane / len : vec4(0.f);
+}
+
+RT_FUNCTION bool intersectSlicePlane(const vec3 &org,
+    const vec3 &dir,
+    const vec4 &plane,
+    const box1 &rayT,
+    float &t)
+{
+  const vec3 n(plane);
+  const float denom = dot(n, dir);
+  if (denom == 0.f)
+    return false;
+  t = (plane.w - dot(n, org)) / denom;
+  return contains(t, rayT);
+}
+
+// Geometric normal of a slice plane, facing against the incoming ray
+RT_FUNCTION vec3 slicePlaneNormal(const vec4 &plane, const vec3 &dir)
+{
+  const vec3 n(plane);
+  return dot(n, dir) > 0.f ? -n : n;
+}
+
+// Bounds of the polygon cut out of 'bounds' by a slice plane, empty if the
+// plane misses the box
+RT_FUNCTION box3 slicePlaneBounds(const vec4 &plane, const box3 &bounds)
+{
+  const vec3 n(plane);
+  const vec3 corners[2] = {bounds.lower, bounds.upper};
+
+  box3 retval;
+
+  // Crossings of the plane with each of the 12 box edges, 4 along each axis
+  for (int axis = 0; axis < 3; axis++) {
+    const int a1 = (axis + 1) % 3;
+    const int a2 = (axis + 2) % 3;
+    for (int i = 0; i < 4; i++) {
+      vec3 v0;
+      v0[a1] = corners[i & 1][a1];
+      v0[a2] = corners[i >> 1][a2];
+      v0[axis] = bounds.lower[axis];
+      vec3 v1 = v0;
+      v1[axis] = bounds.upper[axis];
+
+      const float d0 = dot(n, v0) - plane.w;
+      const float d1 = dot(n, v1) - plane.w;
+      if (d0 == d1) {
+        if (d0 == 0.f) // edge lies in the plane
+          retval.extend(v0).extend(v1);
+      } else if (d0 * d1 <= 0.f)
+        retval.extend(v0 + (v1 - v0) * (d0 / (d0 - d1)));
+    }
+  }
+
+  return retval;
+}
+
+} // namespace visrtx
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "gpu/gpu_objects.h"
+
+namespace visrtx {
+
+// Page table entry of bricks which aren't in the brick cache
+constexpr uint32_t BRICK_NOT_RESIDENT = ~0u;
+
+// Level l of a streamed field holds every 2^l-th voxel of the full volume in
+// each direction. Bricks of 'brickSize' cells overlap their neighbors by one
+// voxel, so they can be filtered on their own.
+
+RT_FUNCTION uvec3 brickLevelDims(const uvec3 &dims, uint32_t level)
+{
+  return (max(dims, uvec3(1u)) - 1u) / (1u << level) + 1u;
+}
+
+RT_FUNCTION uvec3 brickLevelBricks(const uvec3 &levelDims, uint32_t brickSize)
+{
+  return max((levelDims - 1u + brickSize - 1u) / brickSize, uvec3(1u));
+}
+
+RT_FUNCTION uint32_t numBricks(const uvec3 &levelBricks)
+{
+  return levelBricks.x * levelBricks.y * levelBricks.z;
+}
+
+// Lower corner of a cache slot in the texels of the brick atlas, holding
+// 'brickSize' + 1 voxels in each direction
+RT_FUNCTION uvec3 brickAtlasOrigin(
+    uint32_t slot, const uvec3 &atlasSlots, uint32_t brickSize)
+{
+  const uvec3 s(slot % atlasSlots.x,
+      slot / atlasSlots.x % atlasSlots.y,
+      slot / (atlasSlots.x * atlasSlots.y));
+  return s * (brickSize + 1u);
+}
+
+struct StreamedFieldSample
+{
+  uint32_t brick{BRICK_NOT_RESIDENT}; // finest level brick at the location
+  uint32_t level{0}; // level the sample is taken from
+  bool resident{false}; // false if not even the coarsest level is resident
+  vec3 atlasCoords{0.f}; // unnormalized texture coordinates in the atlas
+};
+
+// Find the finest resident brick at 'location' by walking up the levels
+RT_FUNCTION StreamedFieldSample streamedFieldLookup(
+    const StreamedRegularData &sf, const vec3 &location)
+{
+  StreamedFieldSample retval;
+
+  const vec3 p0 = (location - sf.origin) * sf.invSpacing;
+
+  uint32_t levelOffset = 0;
+  for (uint32_t l = 0; l < sf.numLevels; l++) {
+    const uvec3 levelDims = brickLevelDims(sf.dims, l);
+    const uvec3 levelBricks = brickLevelBricks(levelDims, sf.brickSize);
+
+    const vec3 p =
+        clamp(p0 / float(1u << l), vec3(0.f), vec3(levelDims - 1u));
+    const uvec3 b = min(uvec3(p) / sf.brickSize, levelBricks - 1u);
+    const uint32_t id =
+        levelOffset + b.x + levelBricks.x * (b.y + levelBricks.y * b.z);
+
+    if (l == 0)
+      retval.brick = id;
+
+    const uint32_t slot = sf.pageTable[id];
+    if (slot != BRICK_NOT_RESIDENT) {
+      const vec3 local = p - vec3(b * sf.brickSize);
+      retval.level = l;
+      retval.resident = true;
+      retval.atlasCoords =
+          vec3(brickAtlasOrigin(slot, sf.atlasSlots, sf.brickSize)) + local
+          + 0.5f;
+      break;
+    }
+
+    levelOffset += numBricks(levelBricks);
+  }
+
+  return retval;
+}
+
+} // namespace visrtx
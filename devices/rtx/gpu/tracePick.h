@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/cameraCreateRay.h"
+#include "gpu/intersectRay.h"
+#include "gpu/pick.h"
+
+namespace visrtx {
+
+RT_FUNCTION bool pickRequested(const FrameGPUData &frameData)
+{
+  return frameData.pick.results != nullptr;
+}
+
+// Trace the pick ray of the current launch index and write its result, leaving
+// all frame buffers untouched
+template <typename T>
+RT_FUNCTION void tracePick(const FrameGPUData &frameData, T rayType)
+{
+  ScreenSample ss;
+  ss.launchIdx = optixGetLaunchIndex();
+
+  const uint32_t i = ss.launchIdx.x;
+  if (i >= frameData.pick.count)
+    return;
+
+  ss.screen = frameData.pick.screens[i];
+  ss.pixel = uvec2(clamp(ss.screen, vec2(0.f), vec2(1.f))
+      * vec2(frameData.fb.size - uvec2(1)));
+  ss.frameData = &frameData;
+  ss.cost = nullptr;
+  curand_init(i, 0, 0, &ss.rs);
+
+  // Pick rays go through the center of the lens, so repeated picks agree
+  const auto ray = cameraCreateRay(frameData.camera, ss.screen);
+
+  SurfaceHit surfaceHit{};
+  intersectSurface(ss, ray, rayType, &surfaceHit);
+
+  VolumeHit volumeHit{};
+  intersectVolume(ss, ray, rayType, &volumeHit);
+
+  frameData.pick.results[i] = resolvePick(ray, surfaceHit, volumeHit);
+}
+
+} // namespace visrtx
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/gpu_math.h"
+// std
+#include <cstdint>
+#include <cstring>
+
+namespace visrtx {
+
+enum class TraversalCostMetric
+{
+  CLOCKS,
+  ANY_HITS,
+  INTERSECTIONS,
+  VOLUME_SAMPLES
+};
+
+// Per-pixel work counters, reached by all programs through the screen sample
+// so they stay null (and free) outside of debug renderings
+struct TraversalCost
+{
+  uint64_t clocks{0};
+  uint32_t anyHits{0};
+  uint32_t intersections{0};
+  uint32_t volumeSamples{0};
+};
+
+RT_FUNCTION void countAnyHit(TraversalCost *cost)
+{
+  if (cost)
+    cost->anyHits++;
+}
+
+RT_FUNCTION void countIntersection(TraversalCost *cost)
+{
+  if (cost)
+    cost->intersections++;
+}
+
+RT_FUNCTION void countVolumeSample(TraversalCost *cost)
+{
+  if (cost)
+    cost->volumeSamples++;
+}
+
+RT_FUNCTION void countClocks(TraversalCost *cost, int64_t start, int64_t end)
+{
+  // clock64() is per SM, so a warp migrating between SMs can go backwards
+  if (cost && end > start)
+    cost->clocks += uint64_t(end - start);
+}
+
+RT_FUNCTION float costValue(const TraversalCost &cost, TraversalCostMetric m)
+{
+  switch (m) {
+  case TraversalCostMetric::CLOCKS:
+    return float(cost.clocks);
+  case TraversalCostMetric::ANY_HITS:
+    return float(cost.anyHits);
+  case TraversalCostMetric::INTERSECTIONS:
+    return float(cost.intersections);
+  case TraversalCostMetric::VOLUME_SAMPLES:
+    return float(cost.volumeSamples);
+  default:
+    return 0.f;
+  }
+}
+
+// Track the largest cost value of a frame, which is non-negative and so
+// orders the same as its bits do
+RT_FUNCTION void recordCostMax(uint32_t *costMax, float value)
+{
+  if (!costMax || !(value > 0.f))
+    return;
+#ifdef __CUDACC__
+  atomicMax(costMax, __float_as_uint(value));
+#else
+  uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  *costMax = *costMax < bits ? bits : *costMax;
+#endif
+}
+
+inline float costMaxValue(uint32_t costMax)
+{
+  float value = 0.f;
+  std::memcpy(&value, &costMax, sizeof(value));
+  return value;
+}
+
+// Map a cost to black -> blue -> cyan -> green -> yellow -> red as it goes
+// from zero to 'scale', saturating above it
+RT_FUNCTION vec3 heatColor(float value, float scale)
+{
+  const vec3 stops[6] = {vec3(0.f, 0.f, 0.f),
+      vec3(0.f, 0.f, 1.f),
+      vec3(0.f, 1.f, 1.f),
+      vec3(0.f, 1.f, 0.f),
+      vec3(1.f, 1.f, 0.f),
+      vec3(1.f, 0.f, 0.f)};
+
+  const float t = scale > 0.f ? glm::clamp(value / scale, 0.f, 1.f)
+                              : (value > 0.f ? 1.f : 0.f);
+  const float x = t * 5.f;
+  const int i = glm::min(int(x), 4);
+  return glm::mix(stops[i], stops[i + 1], x - i);
+}
+
+} // namespace visrtx
@@ -41,22 +41,6 @@ namespace visrtx {
 
 namespace detail {
 
-RT_FUNCTION vec4 classifySample(const VolumeGPUData &v, float s)
-{
-  vec4 retval(0.f);
-  switch (v.type) {
-  case VolumeType::SCIVIS: {
-    float coord = position(s, v.data.scivis.valueRange);
-    retval = make_vec4(tex1D<::float4>(v.data.scivis.tfTex, coord));
-    retval.w *= v.data.scivis.densityScale;
-    break;
-  }
-  default:
-    break;
-  }
-  return retval;
-}
-
 RT_FUNCTION float rayMarchVolume(
     ScreenSample &ss, const VolumeHit &hit, vec3 *color, float &opacity)
 {
@@ -76,8 +60,9 @@ RT_FUNCTION float rayMarchVolume(
     const vec3 p = hit.localRay.org + hit.localRay.dir * currentInterval.lower;
 
     const float s = sampleSpatialField(field, p);
+    countVolumeSample(ss.cost);
     if (!glm::isnan(s)) {
-      const vec4 co = detail::classifySample(volume, s);
+      const vec4 co = classifySample(volume, s);
       if (color)
         accumulateValue(*color, vec3(co) * co.w, opacity);
       accumulateValue(opacity, co.w, opacity);
@@ -127,8 +112,9 @@ RT_FUNCTION float sampleDistance(ScreenSample &ss,
       const vec3 p =
           hit.localRay.org + hit.localRay.dir * (t + hit.localRay.t.lower);
       const float s = sampleSpatialField(field, p);
+      countVolumeSample(ss.cost);
       if (!glm::isnan(s)) {
-        const vec4 co = detail::classifySample(volume, s);
+        const vec4 co = classifySample(volume, s);
         *albedo = vec3(co);
         extinction = co.w;
         float u = curand_uniform(&ss.rs);
@@ -181,7 +167,8 @@ RT_FUNCTION float rayMarchAllVolumes(ScreenSample &ss,
     vec3 &color,
     float &opacity,
     uint32_t &objID,
-    uint32_t &instID)
+    uint32_t &instID,
+    uint32_t visibility = VISIBILITY_MASK_CAMERA)
 {
   VolumeHit hit;
   ray.t.upper = tfar;
@@ -190,7 +177,12 @@ RT_FUNCTION float rayMarchAllVolumes(ScreenSample &ss,
 
   do {
     hit.foundHit = false;
-    intersectVolume(ss, ray, type, &hit);
+    intersectVolume(ss,
+        ray,
+        type,
+        &hit,
+        OPTIX_RAY_FLAG_DISABLE_ANYHIT,
+        visibility);
     if (!hit.foundHit)
       break;
     else if (firstHit) {
@@ -216,7 +208,8 @@ RT_FUNCTION float sampleDistanceAllVolumes(ScreenSample &ss,
     float &extinction,
     float &transmittance,
     uint32_t &objID,
-    uint32_t &instID)
+    uint32_t &instID,
+    uint32_t visibility = VISIBILITY_MASK_CAMERA)
 {
   VolumeHit hit;
   ray.t.upper = tfar;
@@ -225,7 +218,12 @@ RT_FUNCTION float sampleDistanceAllVolumes(ScreenSample &ss,
 
   while (true) {
     hit.foundHit = false;
-    intersectVolume(ss, ray, type, &hit);
+    intersectVolume(ss,
+        ray,
+        type,
+        &hit,
+        OPTIX_RAY_FLAG_DISABLE_ANYHIT,
+        visibility);
     if (!hit.foundHit)
       break;
     hit.localRay.t.upper = glm::min(tfar, hit.localRay.t.upper);
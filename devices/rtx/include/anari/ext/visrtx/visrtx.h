@@ -56,7 +56,13 @@ typedef struct
 {
   int VISRTX_ARRAY1D_DYNAMIC_REGION;
   int VISRTX_CUDA_OUTPUT_BUFFERS;
+  int VISRTX_GEOMETRY_ISOSURFACE;
+  int VISRTX_GEOMETRY_SLICE;
+  int VISRTX_INSTANCE_TRANSFORM_ARRAY;
+  int VISRTX_RAY_QUERY;
   int VISRTX_SAMPLER_COLOR_MAP;
+  int VISRTX_SPATIAL_FIELD_STREAMED_REGULAR;
+  int VISRTX_TIME_SERIES;
   int VISRTX_TRIANGLE_ATTRIBUTE_INDEXING;
 } VisRTXExtensions;
 
@@ -69,6 +75,60 @@ VISRTX_DEVICE_INTERFACE int visrtxGetObjectExtensions(
 VISRTX_DEVICE_INTERFACE int visrtxGetInstanceExtensions(
     VisRTXExtensions *extensions, ANARIDevice device, ANARIObject object);
 
+// Frame pick query results ///////////////////////////////////////////////////
+
+typedef struct
+{
+  float worldPosition[3];
+  float distance;
+  uint32_t primitiveId;
+  uint32_t objectId;
+  uint32_t instanceId;
+  uint32_t hit;
+} VisRTXPickResult;
+
+// World ray queries //////////////////////////////////////////////////////////
+
+typedef struct
+{
+  float origin[3];
+  float tmin;
+  float direction[3];
+  float tmax;
+} VisRTXRay;
+
+typedef struct
+{
+  float t;
+  float normal[3];
+  uint32_t primitiveId;
+  uint32_t objectId;
+  uint32_t instanceId;
+  uint32_t hit;
+} VisRTXRayHit;
+
+// Trace 'numRays' rays through 'world', where 'rays' and 'hits' may each be in
+// host or CUDA device memory. With 'anyHit' set, rays stop at the first hit
+// found instead of the closest one. Returns 0 if the query failed.
+VISRTX_DEVICE_INTERFACE int visrtxTraceRays(ANARIDevice device,
+    ANARIWorld world,
+    const VisRTXRay *rays,
+    VisRTXRayHit *hits,
+    uint64_t numRays,
+    int anyHit);
+
+// Streamed spatial fields ////////////////////////////////////////////////////
+
+// Fill 'values' with the dims[0] * dims[1] * dims[2] voxels (x-fastest) of a
+// "streamedRegular" spatial field starting at voxel 'origin' of 'level', where
+// level l holds every 2^l-th voxel of the full volume along each axis. Called
+// from anariRenderFrame() for bricks sampled by the previous frame.
+typedef void (*VisRTXBrickCallback)(const void *userData,
+    uint32_t level,
+    const uint32_t origin[3],
+    const uint32_t dims[3],
+    float *values);
+
 #ifdef __cplusplus
 } // extern "C"
 
@@ -82,5 +142,12 @@ VISRTX_DEVICE_INTERFACE Extensions getObjectExtensions(
 VISRTX_DEVICE_INTERFACE
 Extensions getInstanceExtensions(anari::Device, anari::Object);
 
+VISRTX_DEVICE_INTERFACE bool traceRays(anari::Device d,
+    anari::World w,
+    const VisRTXRay *rays,
+    VisRTXRayHit *hits,
+    uint64_t numRays,
+    bool anyHit = false);
+
 } // namespace visrtx
 #endif
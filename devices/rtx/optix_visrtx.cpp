@@ -31,93 +31,340 @@
 
 #include "optix_visrtx.h"
 #include "Object.h"
+// std
+#include <algorithm>
+#include <cstddef>
+#include <limits>
 
 namespace visrtx {
 
-void buildOptixBVH(std::vector<OptixBuildInput> buildInput,
+void prepareOptixBVH(std::vector<OptixBuildInput> buildInput,
+    PreparedBVHBuild &build,
+    DeviceBuffer &bvh,
+    Object *obj)
+{
+  build.buildInput = std::move(buildInput);
+  if (build.buildInput.empty())
+    return;
+
+  auto &state = *obj->deviceState();
+
+  // Flags must match the ones used by updateOptixBVH() //
+
+  OptixAccelBuildOptions accelOptions{};
+  accelOptions.buildFlags =
+      OPTIX_BUILD_FLAG_ALLOW_COMPACTION | OPTIX_BUILD_FLAG_ALLOW_UPDATE;
+  accelOptions.operation = OPTIX_BUILD_OPERATION_BUILD;
+
+  OptixAccelBufferSizes bufferSizes;
+  OPTIX_CHECK_OBJECT(optixAccelComputeMemoryUsage(state.optixContext,
+                         &accelOptions,
+                         build.buildInput.data(),
+                         build.buildInput.size(),
+                         &bufferSizes),
+      obj);
+
+  build.temp.reserve(bufferSizes.tempSizeInBytes);
+  build.emittedBounds.reserve(sizeof(box3));
+  bvh.reserve(bufferSizes.outputSizeInBytes);
+}
+
+void buildPreparedOptixBVH(PreparedBVHBuild &build,
     DeviceBuffer &bvh,
     OptixTraversableHandle &traversable,
     box3 &bounds,
-    Object *obj)
+    Object *obj,
+    CUstream stream)
 {
   traversable = {};
   bounds = {};
 
-  if (buildInput.empty()) {
+  if (build.buildInput.empty()) {
     obj->reportMessage(ANARI_SEVERITY_DEBUG, "skipping BVH build");
     return;
   }
 
   auto &state = *obj->deviceState();
+  if (!stream)
+    stream = state.stream;
+
+  OptixAccelBuildOptions accelOptions{};
+  accelOptions.buildFlags =
+      OPTIX_BUILD_FLAG_ALLOW_COMPACTION | OPTIX_BUILD_FLAG_ALLOW_UPDATE;
+  accelOptions.operation = OPTIX_BUILD_OPERATION_BUILD;
 
-  // TLAS setup //
+  OptixAccelEmitDesc emitDesc;
+  emitDesc.type = OPTIX_PROPERTY_TYPE_AABBS;
+  emitDesc.result = (CUdeviceptr)build.emittedBounds.ptr();
+
+  OPTIX_CHECK_OBJECT(optixAccelBuild(state.optixContext,
+                         stream,
+                         &accelOptions,
+                         build.buildInput.data(),
+                         build.buildInput.size(),
+                         (CUdeviceptr)build.temp.ptr(),
+                         build.temp.bytes(),
+                         (CUdeviceptr)bvh.ptr(),
+                         bvh.bytes(),
+                         &traversable,
+                         &emitDesc,
+                         1),
+      obj);
+
+  build.emittedBounds.downloadAsync(&bounds, 1, stream);
+  CUDA_STREAM_SYNC_CHECK_OBJECT(stream, obj);
+}
+
+// Properties emitted by each build, downloaded together once per batch
+struct EmittedProperties
+{
+  uint64_t compactedSize;
+  box3 bounds;
+};
+
+static void issueOptixBVHBatch(const std::vector<BVHBuildRequest *> &builds,
+    const std::vector<BVHBuildSizes> &sizes,
+    const BVHBuildBatch &batch,
+    uint8_t *arenaPtr,
+    Object *obj,
+    CUstream stream)
+{
+  auto &state = *obj->deviceState();
 
   OptixAccelBuildOptions accelOptions{};
   accelOptions.buildFlags = OPTIX_BUILD_FLAG_ALLOW_COMPACTION;
   accelOptions.operation = OPTIX_BUILD_OPERATION_BUILD;
 
-  OptixAccelBufferSizes tlasBufferSizes;
-  OPTIX_CHECK_OBJECT(optixAccelComputeMemoryUsage(state.optixContext,
-                         &accelOptions,
-                         buildInput.data(),
-                         buildInput.size(),
-                         &tlasBufferSizes),
+  for (size_t i = batch.begin; i < batch.end; i++) {
+    auto &r = *builds[i];
+    const size_t k = i - batch.begin;
+
+    auto *emitPtr = arenaPtr + batch.emitOffset + k * sizeof(EmittedProperties);
+
+    OptixAccelEmitDesc emitDesc[2];
+    emitDesc[0].type = OPTIX_PROPERTY_TYPE_COMPACTED_SIZE;
+    emitDesc[0].result = (CUdeviceptr)emitPtr;
+    emitDesc[1].type = OPTIX_PROPERTY_TYPE_AABBS;
+    emitDesc[1].result =
+        (CUdeviceptr)(emitPtr + offsetof(EmittedProperties, bounds));
+
+    OPTIX_CHECK_OBJECT(optixAccelBuild(state.optixContext,
+                           stream,
+                           &accelOptions,
+                           r.buildInput.data(),
+                           r.buildInput.size(),
+                           (CUdeviceptr)(arenaPtr + batch.tempOffset),
+                           sizes[i].tempBytes,
+                           (CUdeviceptr)(arenaPtr + batch.outputOffsets[k]),
+                           sizes[i].outputBytes,
+                           r.traversable,
+                           emitDesc,
+                           2),
+        obj);
+  }
+}
+
+static void compactOptixBVHBatch(const std::vector<BVHBuildRequest *> &builds,
+    const BVHBuildBatch &batch,
+    DeviceBuffer &arena,
+    Object *obj,
+    CUstream stream)
+{
+  auto &state = *obj->deviceState();
+
+  std::vector<EmittedProperties> emitted(batch.end - batch.begin);
+  arena.downloadAsync(emitted.data(), emitted.size(), stream, batch.emitOffset);
+  CUDA_STREAM_SYNC_CHECK_OBJECT(stream, obj);
+
+  for (size_t i = batch.begin; i < batch.end; i++) {
+    auto &r = *builds[i];
+    const auto &e = emitted[i - batch.begin];
+
+    *r.bounds = e.bounds;
+
+    r.bvh->reserve(e.compactedSize);
+    OPTIX_CHECK_OBJECT(optixAccelCompact(state.optixContext,
+                           stream,
+                           *r.traversable,
+                           (CUdeviceptr)r.bvh->ptr(),
+                           r.bvh->bytes(),
+                           r.traversable),
+        obj);
+  }
+  CUDA_STREAM_SYNC_CHECK_OBJECT(stream, obj);
+}
+
+static std::vector<BVHBuildBatch> planOptixBVHBuilds(
+    std::vector<BVHBuildRequest> &requests,
+    std::vector<BVHBuildRequest *> &builds,
+    std::vector<BVHBuildSizes> &sizes,
+    size_t maxArenaBytes,
+    Object *obj)
+{
+  auto &state = *obj->deviceState();
+
+  OptixAccelBuildOptions accelOptions{};
+  accelOptions.buildFlags = OPTIX_BUILD_FLAG_ALLOW_COMPACTION;
+  accelOptions.operation = OPTIX_BUILD_OPERATION_BUILD;
+
+  builds.clear();
+  sizes.clear();
+  builds.reserve(requests.size());
+  sizes.reserve(requests.size());
+
+  for (auto &r : requests) {
+    *r.traversable = {};
+    *r.bounds = {};
+
+    if (r.buildInput.empty())
+      continue;
+
+    OptixAccelBufferSizes bufferSizes;
+    OPTIX_CHECK_OBJECT(optixAccelComputeMemoryUsage(state.optixContext,
+                           &accelOptions,
+                           r.buildInput.data(),
+                           r.buildInput.size(),
+                           &bufferSizes),
+        obj);
+
+    builds.push_back(&r);
+    sizes.push_back(
+        {bufferSizes.tempSizeInBytes, bufferSizes.outputSizeInBytes});
+  }
+
+  if (builds.empty()) {
+    obj->reportMessage(ANARI_SEVERITY_DEBUG, "skipping BVH builds");
+    return {};
+  }
+
+  auto batches = planBVHBuildBatches(sizes,
+      sizeof(EmittedProperties),
+      OPTIX_ACCEL_BUFFER_BYTE_ALIGNMENT,
+      maxArenaBytes);
+
+  obj->reportMessage(ANARI_SEVERITY_DEBUG,
+      "building %zu BVHs in %zu batches",
+      builds.size(),
+      batches.size());
+
+  return batches;
+}
+
+void buildOptixBVHs(std::vector<BVHBuildRequest> &requests, Object *obj)
+{
+  constexpr size_t maxArenaBytes = size_t(1) << 30;
+
+  auto &state = *obj->deviceState();
+
+  std::vector<BVHBuildRequest *> builds;
+  std::vector<BVHBuildSizes> sizes;
+  const auto batches =
+      planOptixBVHBuilds(requests, builds, sizes, maxArenaBytes, obj);
+
+  // One arena fits every batch, as freeing device memory syncs the device
+  size_t arenaBytes = 0;
+  for (auto &batch : batches)
+    arenaBytes = std::max(arenaBytes, batch.arenaBytes);
+
+  DeviceBuffer arena;
+  arena.reserve(arenaBytes);
+
+  for (auto &batch : batches) {
+    issueOptixBVHBatch(
+        builds, sizes, batch, (uint8_t *)arena.ptr(), obj, state.stream);
+    compactOptixBVHBatch(builds, batch, arena, obj, state.stream);
+  }
+}
+
+void issueOptixBVHBuilds(std::vector<BVHBuildRequest> &requests,
+    IssuedBVHBuilds &issued,
+    Object *obj,
+    CUstream stream)
+{
+  std::vector<BVHBuildSizes> sizes;
+  auto batches = planOptixBVHBuilds(requests,
+      issued.builds,
+      sizes,
+      std::numeric_limits<size_t>::max(),
       obj);
 
-  // Prepare compaction //
+  if (batches.empty())
+    return;
 
-  DeviceBuffer compactedSizeBuffer;
-  compactedSizeBuffer.reserve(sizeof(uint64_t));
+  issued.batch = std::move(batches.front());
+  issued.arena.reserve(issued.batch.arenaBytes);
+  issueOptixBVHBatch(issued.builds,
+      sizes,
+      issued.batch,
+      (uint8_t *)issued.arena.ptr(),
+      obj,
+      stream);
+}
 
-  OptixAccelEmitDesc emitDesc[2];
-  emitDesc[0].type = OPTIX_PROPERTY_TYPE_COMPACTED_SIZE;
-  emitDesc[0].result = (CUdeviceptr)compactedSizeBuffer.ptr();
+void compactOptixBVHs(IssuedBVHBuilds &issued, Object *obj, CUstream stream)
+{
+  if (issued.builds.empty())
+    return;
 
-  DeviceBuffer aabbBuffer;
-  aabbBuffer.reserve(sizeof(box3));
+  compactOptixBVHBatch(issued.builds, issued.batch, issued.arena, obj, stream);
+}
 
-  emitDesc[1].type = OPTIX_PROPERTY_TYPE_AABBS;
-  emitDesc[1].result = (CUdeviceptr)aabbBuffer.ptr();
+void updateOptixBVH(std::vector<OptixBuildInput> buildInput,
+    DeviceBuffer &bvh,
+    DeviceBuffer &scratch,
+    OptixTraversableHandle &traversable,
+    box3 &bounds,
+    Object *obj)
+{
+  if (buildInput.empty() || !bvh) {
+    obj->reportMessage(ANARI_SEVERITY_DEBUG, "skipping BVH update");
+    return;
+  }
 
-  // Execute BVH build //
+  auto &state = *obj->deviceState();
 
-  DeviceBuffer tempBuffer;
-  tempBuffer.reserve(tlasBufferSizes.tempSizeInBytes);
+  // Flags must match the ones used to build 'bvh' //
 
-  DeviceBuffer outputBuffer;
-  outputBuffer.reserve(tlasBufferSizes.outputSizeInBytes);
+  OptixAccelBuildOptions accelOptions{};
+  accelOptions.buildFlags =
+      OPTIX_BUILD_FLAG_ALLOW_COMPACTION | OPTIX_BUILD_FLAG_ALLOW_UPDATE;
+  accelOptions.operation = OPTIX_BUILD_OPERATION_UPDATE;
 
-  OPTIX_CHECK_OBJECT(optixAccelBuild(state.optixContext,
-                         state.stream,
+  OptixAccelBufferSizes bufferSizes;
+  OPTIX_CHECK_OBJECT(optixAccelComputeMemoryUsage(state.optixContext,
                          &accelOptions,
                          buildInput.data(),
                          buildInput.size(),
-                         (CUdeviceptr)tempBuffer.ptr(),
-                         tempBuffer.bytes(),
-                         (CUdeviceptr)outputBuffer.ptr(),
-                         outputBuffer.bytes(),
-                         &traversable,
-                         emitDesc,
-                         2),
+                         &bufferSizes),
       obj);
-  CUDA_SYNC_CHECK_OBJECT(obj);
 
-  aabbBuffer.download(&bounds);
+  scratch.reserve(bufferSizes.tempUpdateSizeInBytes);
 
-  // Perform compaction //
+  DeviceBuffer aabbBuffer;
+  aabbBuffer.reserve(sizeof(box3));
 
-  uint64_t compactedSize;
-  compactedSizeBuffer.download(&compactedSize, 1);
+  OptixAccelEmitDesc emitDesc;
+  emitDesc.type = OPTIX_PROPERTY_TYPE_AABBS;
+  emitDesc.result = (CUdeviceptr)aabbBuffer.ptr();
 
-  bvh.reserve(compactedSize);
-  OPTIX_CHECK_OBJECT(optixAccelCompact(state.optixContext,
+  // Refit in place //
+
+  OPTIX_CHECK_OBJECT(optixAccelBuild(state.optixContext,
                          state.stream,
-                         traversable,
+                         &accelOptions,
+                         buildInput.data(),
+                         buildInput.size(),
+                         (CUdeviceptr)scratch.ptr(),
+                         scratch.bytes(),
                          (CUdeviceptr)bvh.ptr(),
                          bvh.bytes(),
-                         &traversable),
+                         &traversable,
+                         &emitDesc,
+                         1),
       obj);
   CUDA_SYNC_CHECK_OBJECT(obj);
+
+  aabbBuffer.download(&bounds);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -128,6 +375,13 @@ DeviceGlobalState::DeviceGlobalState(ANARIDevice d)
     : helium::BaseGlobalDeviceState(d)
 {}
 
+void DeviceGlobalState::flushCommits()
+{
+  commitStats.beginFlush();
+  commitBufferFlush();
+  commitStats.endFlush();
+}
+
 } // namespace visrtx
 
 VISRTX_ANARI_TYPEFOR_DEFINITION(visrtx::box1);
@@ -32,6 +32,8 @@
 #pragma once
 
 #include "gpu/gpu_objects.h"
+#include "utility/BVHBuildPlanner.h"
+#include "utility/CommitStats.h"
 #include "utility/DeferredArrayUploadBuffer.h"
 #include "utility/DeviceObjectArray.h"
 // helium
@@ -104,6 +106,19 @@ constexpr int ATTRIBUTE_VALUES = 4;
     }                                                                          \
   }
 
+#define CUDA_STREAM_SYNC_CHECK_OBJECT(stream, obj)                             \
+  {                                                                            \
+    cudaStreamSynchronize(stream);                                             \
+    cudaError_t error = cudaGetLastError();                                    \
+    if (error != cudaSuccess) {                                                \
+      obj->reportMessage(ANARI_SEVERITY_FATAL_ERROR,                           \
+          "error (%s: line %d): %s\n",                                         \
+          __FILE__,                                                            \
+          __LINE__,                                                            \
+          cudaGetErrorString(error));                                          \
+    }                                                                          \
+  }
+
 #define VISRTX_ANARI_TYPEFOR_SPECIALIZATION(type, anari_type)                  \
   namespace anari {                                                            \
   ANARI_TYPEFOR_SPECIALIZATION(type, anari_type);                              \
@@ -120,6 +135,8 @@ namespace visrtx {
 
 using ptx_ptr = unsigned char *;
 
+struct SpatialField;
+
 struct DeviceGlobalState : public helium::BaseGlobalDeviceState
 {
   CUcontext cudaContext;
@@ -136,6 +153,7 @@ struct DeviceGlobalState : public helium::BaseGlobalDeviceState
     OptixModule diffusePathTracer{nullptr};
     OptixModule scivis{nullptr};
     OptixModule test{nullptr};
+    OptixModule rayQuery{nullptr};
   } rendererModules;
 
   struct IntersectionModules
@@ -148,10 +166,17 @@ struct DeviceGlobalState : public helium::BaseGlobalDeviceState
   {
     helium::TimeStamp lastBLASChange{0};
     helium::TimeStamp lastTLASChange{0};
+    helium::TimeStamp lastTransformChange{0};
+    helium::TimeStamp lastOpacityChange{0};
   } objectUpdates;
 
   DeferredArrayUploadBuffer uploadBuffer;
 
+  CommitStats commitStats;
+
+  // Fields streaming in data between frames, see SpatialField
+  std::vector<SpatialField *> streamedFields;
+
   struct DeviceObjectRegistry
   {
     DeviceObjectArray<SamplerGPUData> samplers;
@@ -166,12 +191,69 @@ struct DeviceGlobalState : public helium::BaseGlobalDeviceState
   // Helper methods //
 
   DeviceGlobalState(ANARIDevice d);
+
+  // commitBufferFlush(), recording the cost of each commit in 'commitStats'
+  void flushCommits();
 };
 
 struct Object;
 
-void buildOptixBVH(std::vector<OptixBuildInput> buildInput,
+// A BVH build split in two: prepareOptixBVH() sizes and allocates all buffers,
+// so buildPreparedOptixBVH() only issues work on a stream and can run on a
+// background thread. Prepared BVHs allow updates and are not compacted.
+struct PreparedBVHBuild
+{
+  std::vector<OptixBuildInput> buildInput;
+  DeviceBuffer temp;
+  DeviceBuffer emittedBounds;
+};
+
+void prepareOptixBVH(std::vector<OptixBuildInput> buildInput,
+    PreparedBVHBuild &build,
+    DeviceBuffer &bvh,
+    Object *obj);
+
+void buildPreparedOptixBVH(PreparedBVHBuild &build,
+    DeviceBuffer &bvh,
+    OptixTraversableHandle &traversable,
+    box3 &bounds,
+    Object *obj,
+    CUstream stream = {}); // defaults to the device stream
+
+// A BVH to be built by buildOptixBVHs(), which fills in the outputs
+struct BVHBuildRequest
+{
+  std::vector<OptixBuildInput> buildInput;
+  DeviceBuffer *bvh{nullptr};
+  OptixTraversableHandle *traversable{nullptr};
+  box3 *bounds{nullptr};
+};
+
+// Build many BVHs with one allocation and one sync per batch of builds, then
+// compact them all in a second pass
+void buildOptixBVHs(std::vector<BVHBuildRequest> &requests, Object *obj);
+
+// buildOptixBVHs() split in two, with all builds in a single batch:
+// issueOptixBVHBuilds() reads the build inputs and queues the builds on
+// 'stream', leaving compactOptixBVHs() to wait for them (e.g. on a background
+// thread). The requests must outlive both calls.
+struct IssuedBVHBuilds
+{
+  std::vector<BVHBuildRequest *> builds;
+  BVHBuildBatch batch;
+  DeviceBuffer arena;
+};
+
+void issueOptixBVHBuilds(std::vector<BVHBuildRequest> &requests,
+    IssuedBVHBuilds &issued,
+    Object *obj,
+    CUstream stream);
+void compactOptixBVHs(IssuedBVHBuilds &issued, Object *obj, CUstream stream);
+
+// Refit a BVH previously built with buildPreparedOptixBVH() in place
+void updateOptixBVH(std::vector<OptixBuildInput> buildInput,
     DeviceBuffer &bvh,
+    DeviceBuffer &scratch,
     OptixTraversableHandle &traversable,
     box3 &bounds,
     Object *obj);
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/gpu_math.h"
+// std
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace visrtx {
+
+// Bounding volume hierarchy over arbitrary primitives on the host, built
+// with binned SAH (Wald 2007, "On fast Construction of SAH-based Bounding
+// Volume Hierarchies"). It stands in for OptiX's BVHs in the CPU reference
+// renderer, so it favors simplicity over build and traversal speed.
+struct HostBVH
+{
+  struct Node
+  {
+    box3 bounds;
+    uint32_t first{0}; // first primitive index of a leaf, else right child
+    uint32_t count{0}; // number of primitives of a leaf, 0 for inner nodes
+  };
+
+  void build(const std::vector<box3> &primBounds, uint32_t maxLeafSize = 4);
+
+  // Visit the primitives 'ray' may hit, front to back, calling
+  // 'intersect(primID, ray)'. It returns whether the primitive was hit and
+  // then shortens 'ray.t.upper' to the hit distance. With 'anyHit' the
+  // traversal stops at the first hit. Returns whether anything was hit.
+  template <typename FCN>
+  bool traverse(Ray &ray, FCN &&intersect, bool anyHit = false) const;
+
+  box3 bounds() const;
+  const std::vector<Node> &nodes() const;
+  const std::vector<uint32_t> &primIndices() const;
+
+ private:
+  uint32_t buildNode(const std::vector<box3> &primBounds,
+      const std::vector<vec3> &centroids,
+      uint32_t begin,
+      uint32_t end,
+      uint32_t maxLeafSize,
+      uint32_t depth);
+
+  static constexpr uint32_t MAX_DEPTH = 60; // bounds the traversal stack
+
+  std::vector<Node> m_nodes; // inner nodes are followed by their left child
+  std::vector<uint32_t> m_primIndices;
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline void HostBVH::build(
+    const std::vector<box3> &primBounds, uint32_t maxLeafSize)
+{
+  m_nodes.clear();
+  m_primIndices.resize(primBounds.size());
+  for (uint32_t i = 0; i < m_primIndices.size(); i++)
+    m_primIndices[i] = i;
+
+  if (primBounds.empty())
+    return;
+
+  std::vector<vec3> centroids(primBounds.size());
+  for (size_t i = 0; i < primBounds.size(); i++)
+    centroids[i] = center(primBounds[i]);
+
+  m_nodes.reserve(2 * primBounds.size());
+  buildNode(primBounds,
+      centroids,
+      0,
+      uint32_t(primBounds.size()),
+      std::max(maxLeafSize, 1u),
+      0);
+}
+
+inline uint32_t HostBVH::buildNode(const std::vector<box3> &primBounds,
+    const std::vector<vec3> &centroids,
+    uint32_t begin,
+    uint32_t end,
+    uint32_t maxLeafSize,
+    uint32_t depth)
+{
+  constexpr int NUM_BINS = 16;
+
+  const uint32_t nodeID = uint32_t(m_nodes.size());
+  m_nodes.emplace_back();
+
+  box3 bounds;
+  box3 centroidBounds;
+  for (uint32_t i = begin; i < end; i++) {
+    bounds.extend(primBounds[m_primIndices[i]]);
+    centroidBounds.extend(centroids[m_primIndices[i]]);
+  }
+  m_nodes[nodeID].bounds = bounds;
+
+  auto makeLeaf = [&]() {
+    m_nodes[nodeID].first = begin;
+    m_nodes[nodeID].count = end - begin;
+    return nodeID;
+  };
+
+  const uint32_t count = end - begin;
+  if (count <= maxLeafSize || depth >= MAX_DEPTH)
+    return makeLeaf();
+
+  const int axis = int(largest_axis(centroidBounds));
+  const float lo = centroidBounds.lower[axis];
+  const float extent = centroidBounds.upper[axis] - lo;
+  if (!(extent > 0.f))
+    return makeLeaf(); // all centroids coincide
+
+  auto binOf = [&](uint32_t prim) {
+    const int b = int(NUM_BINS * (centroids[prim][axis] - lo) / extent);
+    return std::clamp(b, 0, NUM_BINS - 1);
+  };
+
+  box3 binBounds[NUM_BINS];
+  uint32_t binCounts[NUM_BINS] = {};
+  for (uint32_t i = begin; i < end; i++) {
+    const int b = binOf(m_primIndices[i]);
+    binBounds[b].extend(primBounds[m_primIndices[i]]);
+    binCounts[b]++;
+  }
+
+  // Sweep from the right, then evaluate every split plane from the left
+  float rightCost[NUM_BINS] = {};
+  box3 acc;
+  uint32_t accCount = 0;
+  for (int b = NUM_BINS - 1; b > 0; b--) {
+    acc.extend(binBounds[b]);
+    accCount += binCounts[b];
+    rightCost[b] = accCount ? accCount * half_area(acc) : 0.f;
+  }
+
+  int bestSplit = -1;
+  float bestCost = count * half_area(bounds);
+  acc = box3();
+  accCount = 0;
+  for (int b = 0; b < NUM_BINS - 1; b++) {
+    acc.extend(binBounds[b]);
+    accCount += binCounts[b];
+    if (accCount == 0 || accCount == count)
+      continue;
+    const float cost = accCount * half_area(acc) + rightCost[b + 1];
+    if (cost < bestCost) {
+      bestCost = cost;
+      bestSplit = b;
+    }
+  }
+
+  uint32_t mid = begin;
+  if (bestSplit >= 0) {
+    auto *first = m_primIndices.data() + begin;
+    auto *last = m_primIndices.data() + end;
+    mid = begin
+        + uint32_t(std::partition(first, last, [&](uint32_t p) {
+            return binOf(p) <= bestSplit;
+          }) - first);
+  } else if (count > 4 * maxLeafSize) {
+    // No split beats a leaf, but huge leaves are slow: split at the median
+    mid = begin + count / 2;
+    std::nth_element(m_primIndices.begin() + begin,
+        m_primIndices.begin() + mid,
+        m_primIndices.begin() + end,
+        [&](uint32_t a, uint32_t b) {
+          return centroids[a][axis] < centroids[b][axis];
+        });
+  } else
+    return makeLeaf();
+
+  // The left child directly follows its parent
+  buildNode(primBounds, centroids, begin, mid, maxLeafSize, depth + 1);
+  m_nodes[nodeID].first =
+      buildNode(primBounds, centroids, mid, end, maxLeafSize, depth + 1);
+  m_nodes[nodeID].count = 0;
+  return nodeID;
+}
+
+template <typename FCN>
+inline bool HostBVH::traverse(Ray &ray, FCN &&intersect, bool anyHit) const
+{
+  if (m_nodes.empty())
+    return false;
+
+  // Slab test which, unlike intersectBox(), keeps boxes which are flat in
+  // one dimension, as around axis aligned triangles
+  const vec3 invDir = 1.f / ray.dir;
+  auto entry = [&](uint32_t n, float &tEnter) {
+    const auto &b = m_nodes[n].bounds;
+    const vec3 t0 = (b.lower - ray.org) * invDir;
+    const vec3 t1 = (b.upper - ray.org) * invDir;
+    const vec3 nears = glm::min(t0, t1);
+    const vec3 fars = glm::max(t0, t1);
+    tEnter = std::max(glm::compMax(nears), ray.t.lower);
+    return tEnter <= std::min(glm::compMin(fars), ray.t.upper);
+  };
+
+  bool foundHit = false;
+  uint32_t stack[MAX_DEPTH + 2];
+  int stackSize = 0;
+
+  float tRoot = 0.f;
+  if (entry(0, tRoot))
+    stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const auto &node = m_nodes[stack[--stackSize]];
+
+    if (node.count > 0) {
+      for (uint32_t i = node.first; i < node.first + node.count; i++) {
+        if (intersect(m_primIndices[i], ray)) {
+          foundHit = true;
+          if (anyHit)
+            return true;
+        }
+      }
+      continue;
+    }
+
+    // Push the farther child first so the nearer one is visited next
+    const uint32_t left = uint32_t(&node - m_nodes.data()) + 1;
+    const uint32_t right = node.first;
+    float tLeft = 0.f, tRight = 0.f;
+    const bool hitLeft = entry(left, tLeft);
+    const bool hitRight = entry(right, tRight);
+    if (hitLeft && hitRight) {
+      const bool leftFirst = tLeft <= tRight;
+      stack[stackSize++] = leftFirst ? right : left;
+      stack[stackSize++] = leftFirst ? left : right;
+    } else if (hitLeft)
+      stack[stackSize++] = left;
+    else if (hitRight)
+      stack[stackSize++] = right;
+  }
+
+  return foundHit;
+}
+
+inline box3 HostBVH::bounds() const
+{
+  return m_nodes.empty() ? box3() : m_nodes[0].bounds;
+}
+
+inline const std::vector<HostBVH::Node> &HostBVH::nodes() const
+{
+  return m_nodes;
+}
+
+inline const std::vector<uint32_t> &HostBVH::primIndices() const
+{
+  return m_primIndices;
+}
+
+} // namespace visrtx
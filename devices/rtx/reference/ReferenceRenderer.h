@@ -0,0 +1,554 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/aoSampling.h"
+#include "gpu/bsdf.h"
+#include "gpu/cameraCreateRay.h"
+#include "gpu/frameOutputs.h"
+#include "gpu/materialValues.h"
+#include "reference/HostBVH.h"
+#include "utility/Parallel.h"
+// std
+#include <type_traits>
+#include <vector>
+
+// CPU reference versions of the 'ao' and 'dpt' renderers. They follow the
+// raygen programs of the GPU renderers while sharing their camera, sampling,
+// material evaluation, BSDF and frame accumulation code, but trace rays
+// through a HostBVH instead of OptiX. Images converge to what the GPU
+// renderers produce, so they are a correctness oracle which runs without a
+// GPU. Scenes are limited to opaque triangle meshes whose materials have
+// constant parameters, and the random numbers differ from the GPU's, so images
+// only match statistically.
+
+namespace visrtx {
+
+// Opaque material with constant parameters, like the default 'matte' one
+MaterialGPUData referenceMaterial(const vec3 &baseColor = vec3(0.8f));
+
+// Values of the material of 'hit', as getMaterialValues() gives them. Samplers
+// and attributes can't be read on the host, so parameters using them evaluate
+// to zero and normal maps are ignored.
+MaterialValues referenceMaterialValues(const SurfaceHit &hit);
+
+struct ReferenceMesh
+{
+  std::vector<vec3> vertices;
+  std::vector<uvec3> indices; // if empty, every 3 vertices are a triangle
+  MaterialGPUData material{referenceMaterial()};
+  uint32_t id{~0u};
+};
+
+struct ReferenceScene
+{
+  void addMesh(ReferenceMesh mesh);
+  void commit(); // (re)build the BVH after meshes were added
+
+  // Closest hit along 'ray', filled in like populateSurfaceHit() does
+  bool intersect(const Ray &ray, SurfaceHit &hit) const;
+  bool occluded(const Ray &ray) const;
+
+  box3 bounds() const;
+
+ private:
+  struct TriangleRef
+  {
+    uint32_t mesh;
+    uint32_t primID;
+  };
+
+  void vertices(const TriangleRef &t, vec3 &v0, vec3 &v1, vec3 &v2) const;
+  bool intersectTriangle(uint32_t i, Ray &ray, vec2 *barycentrics) const;
+
+  std::vector<ReferenceMesh> m_meshes;
+  std::vector<TriangleRef> m_triangles;
+  HostBVH m_bvh;
+};
+
+enum class ReferenceRendererType
+{
+  AO,
+  DPT
+};
+
+// Parameters of the renderer being checked, with the same defaults
+struct ReferenceRendererSettings
+{
+  ReferenceRendererType type{ReferenceRendererType::AO};
+  vec4 background{vec3(0.f), 1.f};
+  vec3 ambientColor{1.f};
+  float ambientRadiance{1.f};
+  float occlusionDistance{1e20f};
+  int aoSamples{1};
+  AOSampling aoSampling{AOSampling::LOW_DISCREPANCY};
+  int maxDepth{5};
+};
+
+// Host stand-in for curand: a PCG32 generator per pixel and frame
+struct ReferenceRandom
+{
+  ReferenceRandom(uint32_t pixel, uint32_t frameID);
+  float operator()();
+
+ private:
+  uint64_t m_state{0};
+};
+
+// Accumulating frame rendered in multithreaded tiles, written through
+// accumResults() like the frame buffers of the GPU renderers
+struct ReferenceFrame
+{
+  ReferenceFrame(uvec2 size, uint32_t tileSize = 16);
+
+  // Render one more sample per pixel into the accumulation
+  void render(const ReferenceScene &scene,
+      const CameraGPUData &camera,
+      const ReferenceRendererSettings &settings);
+  void resetAccumulation();
+
+  uvec2 size() const;
+  int numSamples() const;
+  vec4 color(const uvec2 &pixel) const; // mean of all accumulated samples
+  float depth(const uvec2 &pixel) const;
+  uint32_t primID(const uvec2 &pixel) const;
+  uint32_t objID(const uvec2 &pixel) const;
+
+ private:
+  void renderPixel(const ReferenceScene &scene,
+      const CameraGPUData &camera,
+      const ReferenceRendererSettings &settings,
+      const uvec2 &pixel);
+
+  uvec2 m_size;
+  uint32_t m_tileSize{16};
+  int m_frameID{0};
+  FramebufferGPUData m_fb{};
+  std::vector<vec4> m_accumColor;
+  std::vector<vec4> m_color;
+  std::vector<float> m_depth;
+  std::vector<uint32_t> m_primID;
+  std::vector<uint32_t> m_objID;
+  std::vector<uint32_t> m_instID;
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline MaterialGPUData referenceMaterial(const vec3 &baseColor)
+{
+  MaterialGPUData md;
+  md.baseColor = vec4(baseColor, 1.f);
+  md.cutoff = 0.5f;
+  md.mode = AlphaMode::OPAQUE;
+  return md;
+}
+
+inline MaterialValues referenceMaterialValues(const SurfaceHit &hit)
+{
+  auto param = [](const auto &mp) {
+    using T = std::decay_t<decltype(mp.value)>;
+    return mp.type == MaterialParameterType::VALUE ? mp.value : T{};
+  };
+  auto flatNormalMap = [](DeviceObjectIndex) {
+    return vec4(0.5f, 0.5f, 1.f, 1.f);
+  };
+  return evaluateMaterialValues(*hit.material, hit, param, flatNormalMap);
+}
+
+// ReferenceScene //
+
+inline void ReferenceScene::addMesh(ReferenceMesh mesh)
+{
+  m_meshes.push_back(std::move(mesh));
+}
+
+inline void ReferenceScene::commit()
+{
+  m_triangles.clear();
+  for (uint32_t m = 0; m < m_meshes.size(); m++) {
+    const auto &mesh = m_meshes[m];
+    const size_t numTriangles = mesh.indices.empty()
+        ? mesh.vertices.size() / 3
+        : mesh.indices.size();
+    for (uint32_t i = 0; i < numTriangles; i++)
+      m_triangles.push_back({m, i});
+  }
+
+  std::vector<box3> bounds(m_triangles.size());
+  for (size_t i = 0; i < m_triangles.size(); i++) {
+    vec3 v0, v1, v2;
+    vertices(m_triangles[i], v0, v1, v2);
+    bounds[i] = box3(v0, v0);
+    bounds[i].extend(v1);
+    bounds[i].extend(v2);
+  }
+
+  m_bvh.build(bounds);
+}
+
+inline bool ReferenceScene::intersect(const Ray &ray, SurfaceHit &hit) const
+{
+  Ray r = ray;
+  uint32_t closest = ~0u;
+  vec2 b(0.f);
+
+  hit.foundHit = m_bvh.traverse(r, [&](uint32_t i, Ray &r) {
+    vec2 bi;
+    if (!intersectTriangle(i, r, &bi))
+      return false;
+    closest = i;
+    b = bi;
+    return true;
+  });
+
+  if (!hit.foundHit)
+    return false;
+
+  const auto &tri = m_triangles[closest];
+  vec3 v0, v1, v2;
+  vertices(tri, v0, v1, v2);
+
+  // Like OptiX's triangles, the geometric normal faces the ray
+  vec3 Ng = normalize(cross(v1 - v0, v2 - v0));
+  if (dot(Ng, ray.dir) > 0.f)
+    Ng = -Ng;
+
+  hit.t = r.t.upper;
+  hit.hitpoint = ray.org + hit.t * ray.dir;
+  hit.Ng = Ng;
+  hit.Ns = Ng;
+  hit.uvw = vec3(1.f - b.x - b.y, b.x, b.y);
+  hit.primID = tri.primID;
+  hit.objID = m_meshes[tri.mesh].id;
+  hit.instID = 0;
+  hit.epsilon = epsilonFrom(hit.hitpoint, ray.dir, hit.t);
+  hit.geometry = nullptr;
+  hit.material = &m_meshes[tri.mesh].material;
+  hit.instance = nullptr;
+  return true;
+}
+
+inline bool ReferenceScene::occluded(const Ray &ray) const
+{
+  Ray r = ray;
+  return m_bvh.traverse(
+      r,
+      [&](uint32_t i, Ray &r) { return intersectTriangle(i, r, nullptr); },
+      true);
+}
+
+inline box3 ReferenceScene::bounds() const
+{
+  return m_bvh.bounds();
+}
+
+inline void ReferenceScene::vertices(
+    const TriangleRef &t, vec3 &v0, vec3 &v1, vec3 &v2) const
+{
+  const auto &mesh = m_meshes[t.mesh];
+  const uvec3 idx = mesh.indices.empty() ? uvec3(0, 1, 2) + 3 * t.primID
+                                         : mesh.indices[t.primID];
+  v0 = mesh.vertices[idx.x];
+  v1 = mesh.vertices[idx.y];
+  v2 = mesh.vertices[idx.z];
+}
+
+// Moller and Trumbore 1997, "Fast, Minimum Storage Ray/Triangle Intersection"
+inline bool ReferenceScene::intersectTriangle(
+    uint32_t i, Ray &ray, vec2 *barycentrics) const
+{
+  vec3 v0, v1, v2;
+  vertices(m_triangles[i], v0, v1, v2);
+
+  const vec3 e1 = v1 - v0;
+  const vec3 e2 = v2 - v0;
+  const vec3 p = cross(ray.dir, e2);
+  const float det = dot(e1, p);
+  if (det == 0.f)
+    return false;
+
+  const float invDet = 1.f / det;
+  const vec3 s = ray.org - v0;
+  const float u = dot(s, p) * invDet;
+  if (u < 0.f || u > 1.f)
+    return false;
+
+  const vec3 q = cross(s, e1);
+  const float v = dot(ray.dir, q) * invDet;
+  if (v < 0.f || u + v > 1.f)
+    return false;
+
+  const float t = dot(e2, q) * invDet;
+  if (t <= ray.t.lower || t >= ray.t.upper)
+    return false;
+
+  ray.t.upper = t;
+  if (barycentrics)
+    *barycentrics = vec2(u, v);
+  return true;
+}
+
+// ReferenceRandom //
+
+inline ReferenceRandom::ReferenceRandom(uint32_t pixel, uint32_t frameID)
+    : m_state((uint64_t(frameID) << 32 | pixel) * 2 + 1)
+{
+  (*this)();
+}
+
+inline float ReferenceRandom::operator()()
+{
+  // O'Neill 2014, "PCG: A Family of Simple Fast Space-Efficient
+  // Statistically Good Algorithms for Random Number Generation"
+  const uint64_t old = m_state;
+  m_state = old * 6364136223846793005ull + 1442695040888963407ull;
+  const uint32_t xorshifted = uint32_t(((old >> 18u) ^ old) >> 27u);
+  const uint32_t rot = uint32_t(old >> 59u);
+  const uint32_t bits = (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+  return detail::bitsToUnitFloat(bits);
+}
+
+// ReferenceFrame //
+
+inline ReferenceFrame::ReferenceFrame(uvec2 size, uint32_t tileSize)
+    : m_size(size), m_tileSize(std::max(tileSize, 1u))
+{
+  const size_t numPixels = size_t(size.x) * size.y;
+  m_accumColor.resize(numPixels);
+  m_color.resize(numPixels);
+  m_depth.resize(numPixels);
+  m_primID.resize(numPixels);
+  m_objID.resize(numPixels);
+  m_instID.resize(numPixels);
+  resetAccumulation();
+
+  // Checkerboarding is off, so each pixel only writes its own outputs
+  m_fb.buffers.colorAccumulation = m_accumColor.data();
+  m_fb.buffers.outColorVec4 = m_color.data();
+  m_fb.buffers.depth = m_depth.data();
+  m_fb.buffers.primID = m_primID.data();
+  m_fb.buffers.objID = m_objID.data();
+  m_fb.buffers.instID = m_instID.data();
+  m_fb.checkerboardID = -1;
+  m_fb.format = FrameFormat::FLOAT;
+  m_fb.size = size;
+  m_fb.invSize = 1.f / vec2(size);
+}
+
+inline void ReferenceFrame::render(const ReferenceScene &scene,
+    const CameraGPUData &camera,
+    const ReferenceRendererSettings &settings)
+{
+  const uvec2 numTiles = (m_size + uvec2(m_tileSize - 1)) / m_tileSize;
+  m_fb.frameID = m_frameID;
+  m_fb.invFrameID = 1.f / (m_frameID + 1);
+
+  parallelFor(
+      size_t(numTiles.x) * numTiles.y,
+      [&](size_t tile) {
+        const uvec2 begin = m_tileSize
+            * uvec2(uint32_t(tile % numTiles.x), uint32_t(tile / numTiles.x));
+        const uvec2 end = glm::min(begin + uvec2(m_tileSize), m_size);
+        for (uint32_t y = begin.y; y < end.y; y++) {
+          for (uint32_t x = begin.x; x < end.x; x++)
+            renderPixel(scene, camera, settings, uvec2(x, y));
+        }
+      },
+      1);
+
+  m_frameID++;
+}
+
+inline void ReferenceFrame::resetAccumulation()
+{
+  m_frameID = 0;
+  std::fill(m_accumColor.begin(), m_accumColor.end(), vec4(0.f));
+  std::fill(m_color.begin(), m_color.end(), vec4(0.f));
+  std::fill(m_depth.begin(), m_depth.end(), 1e30f);
+  std::fill(m_primID.begin(), m_primID.end(), ~0u);
+  std::fill(m_objID.begin(), m_objID.end(), ~0u);
+  std::fill(m_instID.begin(), m_instID.end(), ~0u);
+}
+
+inline uvec2 ReferenceFrame::size() const
+{
+  return m_size;
+}
+
+inline int ReferenceFrame::numSamples() const
+{
+  return m_frameID;
+}
+
+inline vec4 ReferenceFrame::color(const uvec2 &p) const
+{
+  return m_color[p.x + size_t(p.y) * m_size.x];
+}
+
+inline float ReferenceFrame::depth(const uvec2 &p) const
+{
+  return m_depth[p.x + size_t(p.y) * m_size.x];
+}
+
+inline uint32_t ReferenceFrame::primID(const uvec2 &p) const
+{
+  return m_primID[p.x + size_t(p.y) * m_size.x];
+}
+
+inline uint32_t ReferenceFrame::objID(const uvec2 &p) const
+{
+  return m_objID[p.x + size_t(p.y) * m_size.x];
+}
+
+inline void ReferenceFrame::renderPixel(const ReferenceScene &scene,
+    const CameraGPUData &camera,
+    const ReferenceRendererSettings &settings,
+    const uvec2 &pixel)
+{
+  const uint32_t idx = pixel.x + pixel.y * m_size.x;
+  ReferenceRandom rng(idx, uint32_t(m_frameID));
+
+  // As makePrimaryRay()
+  const float rx = rng() - 0.5f;
+  const float ry = rng() - 0.5f;
+  const vec2 screen = vec2(pixel.x + rx, pixel.y + ry) / vec2(m_size);
+  vec2 lens(0.5f);
+  if (camera.type == CameraType::PERSPECTIVE
+      && camera.perspective.apertureRadius > 0.f) {
+    lens.x = rng();
+    lens.y = rng();
+  }
+  Ray ray = cameraCreateRay(&camera, screen, lens);
+
+  vec4 color = settings.background;
+  vec3 albedo = vec3(settings.background);
+  vec3 normal = ray.dir;
+  float depth = 1e30f;
+  uint32_t primID = ~0u;
+  uint32_t objID = ~0u;
+  uint32_t instID = ~0u;
+  SurfaceHit hit;
+
+  if (settings.type == ReferenceRendererType::AO) {
+    // As the 'ao' raygen program for opaque surfaces
+    if (scene.intersect(ray, hit)) {
+      const auto mat = referenceMaterialValues(hit);
+      auto occluded = [&](const Ray &r) { return scene.occluded(r); };
+      const float aoFactor = settings.aoSamples > 0
+          ? estimateAO(hit,
+              settings.occlusionDistance,
+              settings.aoSamples,
+              settings.aoSampling,
+              uint32_t(m_frameID),
+              idx,
+              occluded,
+              rng)
+          : 1.f;
+      color = vec4(mat.baseColor * aoFactor * settings.ambientColor
+              * settings.ambientRadiance,
+          1.f);
+      albedo = vec3(color);
+      normal = hit.Ng;
+      depth = hit.t;
+      primID = hit.primID;
+      objID = hit.objID;
+      instID = hit.instID;
+    }
+  } else {
+    // As the 'dpt' raygen program for surfaces
+    int pathDepth = 0;
+    vec3 Lw(1.f);
+    vec3 L(0.f);
+    SurfaceHit pathHit;
+
+    while (scene.intersect(ray, pathHit)) {
+      if (pathDepth == 0) {
+        normal = pathHit.Ng;
+        depth = pathHit.t;
+        primID = pathHit.primID;
+        objID = pathHit.objID;
+        instID = pathHit.instID;
+      }
+
+      if (pathDepth++ >= settings.maxDepth) {
+        Lw = vec3(0.f);
+        break;
+      }
+
+      const auto mat = referenceMaterialValues(pathHit);
+      L += Lw * mat.emissive;
+
+      const vec3 wo = -ray.dir;
+      vec3 Ns = mat.normal;
+      if (dot(Ns, wo) < 0.f)
+        Ns = -Ns;
+      const auto frame = makeShadingFrame(Ns);
+
+      const float u0 = rng();
+      const float u1 = rng();
+      const vec3 u(u0, u1, rng());
+      vec3 wi(0.f);
+      float pdf = 0.f;
+      Lw *= bsdfSample(mat, frame.toLocal(wo), u, wi, pdf);
+      const vec3 scatterDir = frame.toWorld(wi);
+
+      const vec3 Ng = dot(pathHit.Ng, wo) < 0.f ? -pathHit.Ng : pathHit.Ng;
+      if (pdf == 0.f || dot(scatterDir, Ng) <= 0.f) {
+        Lw = vec3(0.f);
+        break;
+      }
+
+      const float P = glm::compMax(Lw);
+      if (P < .2f) {
+        if (rng() > P) {
+          Lw = vec3(0.f);
+          break;
+        }
+        Lw /= P;
+      }
+
+      ray.org = pathHit.hitpoint + (pathHit.epsilon * Ng);
+      ray.dir = scatterDir;
+      ray.t.lower = 0.f;
+      ray.t.upper = settings.occlusionDistance;
+    }
+
+    const vec3 Ld(settings.ambientRadiance);
+    if (pathDepth > 0)
+      color = vec4(L + Lw * Ld, 1.f);
+  }
+
+  accumResults(
+      m_fb, pixel, color, depth, albedo, normal, primID, objID, instID);
+}
+
+} // namespace visrtx
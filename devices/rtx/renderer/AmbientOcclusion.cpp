@@ -42,9 +42,9 @@ static const std::vector<std::string> g_aoMissNames = {"__miss__", "__miss__"};
 
 AmbientOcclusion::AmbientOcclusion(DeviceGlobalState *s) : Renderer(s) {}
 
-void AmbientOcclusion::commit()
+void AmbientOcclusion::commitObject()
 {
-  Renderer::commit();
+  Renderer::commitObject();
   m_aoSamples = std::clamp(getParam<int>("aoSamples", 1), 0, 256);
 }
 
@@ -45,7 +45,8 @@ DECLARE_FRAME_DATA(frameData)
 
 RT_PROGRAM void __closesthit__ao()
 {
-  // no-op
+  auto &occluded = ray::rayData<uint32_t>();
+  occluded = true;
 }
 
 RT_PROGRAM void __anyhit__ao()
@@ -74,6 +75,11 @@ RT_PROGRAM void __miss__()
 
 RT_PROGRAM void __raygen__()
 {
+  if (pickRequested(frameData)) {
+    tracePick(frameData, RayType::PRIMARY);
+    return;
+  }
+
   auto &rendererParams = frameData.renderer;
   auto &aoParams = rendererParams.params.ao;
 
@@ -90,12 +96,14 @@ RT_PROGRAM void __raygen__()
   VolumeHit volumeHit;
   vec3 outputColor(0.f);
   vec3 outputNormal = ray.dir;
+  vec3 outputBentNormal(0.f);
   float outputOpacity = 0.f;
   float depth = 1e30f;
   uint32_t primID = ~0u;
   uint32_t objID = ~0u;
   uint32_t instID = ~0u;
   bool firstHit = true;
+  bool firstSurface = true;
 
   while (outputOpacity < 0.99f) {
     ray.t.upper = tmax;
@@ -142,9 +150,11 @@ RT_PROGRAM void __raygen__()
                                  ray,
                                  RayType::AO,
                                  surfaceHit,
-                                 rendererParams.occlusionDistance,
-                                 aoParams.aoSamples)
+                                 aoDistance(frameData),
+                                 aoParams.aoSamples,
+                                 firstSurface ? &outputBentNormal : nullptr)
                                                     : 1.f;
+      firstSurface = false;
       const auto lighting = aoFactor * rendererParams.ambientColor
           * rendererParams.ambientIntensity;
 
@@ -177,7 +187,7 @@ RT_PROGRAM void __raygen__()
 
       color *= opacity;
 
-      const auto bg = getBackground(frameData.renderer, ss.screen);
+      const auto bg = getBackground(frameData, ss.screen, ray.dir);
       accumulateValue(color, vec3(bg), opacity);
       accumulateValue(opacity, bg.w, opacity);
       accumulateValue(outputColor, color, outputOpacity);
@@ -195,6 +205,8 @@ RT_PROGRAM void __raygen__()
       primID,
       objID,
       instID);
+
+  accumBentNormal(frameData.fb, ss.pixel, outputBentNormal);
 }
 
 } // namespace visrtx
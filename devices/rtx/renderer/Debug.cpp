@@ -35,6 +35,9 @@
 
 namespace visrtx {
 
+static const std::vector<HitgroupFunctionNames> g_debugHitNames = {
+    {"__closesthit__", "__anyhit__"}};
+
 static DebugMethod methodFromString(const std::string &name)
 {
   if (name == "primID")
@@ -69,15 +72,23 @@ static DebugMethod methodFromString(const std::string &name)
     return DebugMethod::GEOMETRY_ATTRIBUTE_3;
   else if (name == "geometry.color")
     return DebugMethod::GEOMETRY_ATTRIBUTE_COLOR;
+  else if (name == "cost.clocks")
+    return DebugMethod::COST_CLOCKS;
+  else if (name == "cost.anyHits")
+    return DebugMethod::COST_ANY_HITS;
+  else if (name == "cost.intersections")
+    return DebugMethod::COST_INTERSECTIONS;
+  else if (name == "cost.volumeSamples")
+    return DebugMethod::COST_VOLUME_SAMPLES;
   else
     return DebugMethod::BACKFACE;
 }
 
 Debug::Debug(DeviceGlobalState *s) : Renderer(s) {}
 
-void Debug::commit()
+void Debug::commitObject()
 {
-  Renderer::commit();
+  Renderer::commitObject();
   m_method = methodFromString(getParamString("method", "primID"));
 }
 
@@ -87,6 +98,16 @@ void Debug::populateFrameData(FrameGPUData &fd) const
   fd.renderer.params.debug.method = static_cast<int>(m_method);
 }
 
+bool Debug::tracksTraversalCost() const
+{
+  return isTraversalCostMethod(m_method);
+}
+
+Span<HitgroupFunctionNames> Debug::hitgroupSbtNames() const
+{
+  return make_Span(g_debugHitNames.data(), g_debugHitNames.size());
+}
+
 OptixModule Debug::optixModule() const
 {
   return deviceState()->rendererModules.debug;
@@ -39,8 +39,10 @@ namespace visrtx {
 struct Debug : public Renderer
 {
   Debug(DeviceGlobalState *s);
-  void commit() override;
+  void commitObject() override;
   void populateFrameData(FrameGPUData &fd) const override;
+  bool tracksTraversalCost() const override;
+  Span<HitgroupFunctionNames> hitgroupSbtNames() const override;
   OptixModule optixModule() const override;
   static ptx_ptr ptx();
  private:
@@ -31,6 +31,8 @@
 
 #pragma once
 
+#include "gpu/gpu_decl.h"
+
 namespace visrtx {
 
 enum class DebugMethod
@@ -51,7 +53,16 @@ enum class DebugMethod
   GEOMETRY_ATTRIBUTE_1,
   GEOMETRY_ATTRIBUTE_2,
   GEOMETRY_ATTRIBUTE_3,
-  GEOMETRY_ATTRIBUTE_COLOR
+  GEOMETRY_ATTRIBUTE_COLOR,
+  COST_CLOCKS,
+  COST_ANY_HITS,
+  COST_INTERSECTIONS,
+  COST_VOLUME_SAMPLES
 };
 
+VISRTX_HOST_DEVICE bool isTraversalCostMethod(DebugMethod m)
+{
+  return m >= DebugMethod::COST_CLOCKS;
+}
+
 } // namespace visrtx
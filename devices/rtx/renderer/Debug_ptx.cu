@@ -97,19 +97,19 @@ RT_FUNCTION void handleSurfaceHit()
     rd.outColor = boolColor(rd.material);
     break;
   case DebugMethod::GEOMETRY_ATTRIBUTE_0:
-    rd.outColor = readAttributeValue(0, rd);
+    rd.outColor = readAttributeValue(frameData, 0, rd);
     break;
   case DebugMethod::GEOMETRY_ATTRIBUTE_1:
-    rd.outColor = readAttributeValue(1, rd);
+    rd.outColor = readAttributeValue(frameData, 1, rd);
     break;
   case DebugMethod::GEOMETRY_ATTRIBUTE_2:
-    rd.outColor = readAttributeValue(2, rd);
+    rd.outColor = readAttributeValue(frameData, 2, rd);
     break;
   case DebugMethod::GEOMETRY_ATTRIBUTE_3:
-    rd.outColor = readAttributeValue(3, rd);
+    rd.outColor = readAttributeValue(frameData, 3, rd);
     break;
   case DebugMethod::GEOMETRY_ATTRIBUTE_COLOR:
-    rd.outColor = readAttributeValue(4, rd);
+    rd.outColor = readAttributeValue(frameData, 4, rd);
     break;
   default:
     rd.outColor = vec3(1.f);
@@ -155,19 +155,89 @@ RT_FUNCTION void handleVolumeHit()
 
 RT_PROGRAM void __closesthit__()
 {
+  const auto method =
+      static_cast<DebugMethod>(frameData.renderer.params.debug.method);
+
+  // Cost and pick rays carry plain hits, as cost rays also march volumes
+  if (isTraversalCostMethod(method) || pickRequested(frameData)) {
+    if (ray::isIntersectingSurfaces())
+      ray::populateSurfaceHit(ray::rayData<SurfaceHit>());
+    else
+      ray::populateVolumeHit(ray::rayData<VolumeHit>());
+    return;
+  }
+
   if (ray::isIntersectingSurfaces())
     handleSurfaceHit();
   else
     handleVolumeHit();
 }
 
+RT_PROGRAM void __anyhit__()
+{
+  // Only invoked for cost rays, which enforce any-hit on every candidate hit
+  countAnyHit(ray::screenSample().cost);
+}
+
 RT_PROGRAM void __miss__()
 {
   // no-op
 }
 
+RT_FUNCTION void renderTraversalCost(
+    ScreenSample &ss, Ray ray, DebugMethod method)
+{
+  TraversalCost cost;
+  ss.cost = &cost;
+  const int64_t start = clock64();
+
+  SurfaceHit hit{};
+  intersectSurface(
+      ss, ray, RayType::DEBUG, &hit, OPTIX_RAY_FLAG_ENFORCE_ANYHIT);
+
+  const float tfar = hit.foundHit ? hit.t : ray.t.upper;
+  vec3 volumeColor(0.f);
+  float volumeOpacity = 0.f;
+  uint32_t volumeObjID = ~0u;
+  uint32_t volumeInstID = ~0u;
+  const float volumeDepth = rayMarchAllVolumes(ss,
+      ray,
+      RayType::DEBUG,
+      tfar,
+      volumeColor,
+      volumeOpacity,
+      volumeObjID,
+      volumeInstID);
+
+  countClocks(&cost, start, clock64());
+  ss.cost = nullptr;
+
+  const auto &fb = frameData.fb;
+  const auto metric = static_cast<TraversalCostMetric>(
+      int(method) - int(DebugMethod::COST_CLOCKS));
+  const float value = costValue(cost, metric);
+  recordCostMax(fb.costMax, value);
+  const vec3 color = heatColor(value, fb.costScale);
+
+  const bool volumeFirst = volumeOpacity > 0.f && volumeDepth < tfar;
+  accumResults(fb,
+      ss.pixel,
+      vec4(color, 1.f),
+      volumeFirst ? volumeDepth : tfar,
+      color,
+      hit.foundHit && !volumeFirst ? hit.Ng : -ray.dir,
+      hit.foundHit && !volumeFirst ? hit.primID : ~0u,
+      volumeFirst ? volumeObjID : (hit.foundHit ? hit.objID : ~0u),
+      volumeFirst ? volumeInstID : (hit.foundHit ? hit.instID : ~0u));
+}
+
 RT_PROGRAM void __raygen__()
 {
+  if (pickRequested(frameData)) {
+    tracePick(frameData, RayType::DEBUG);
+    return;
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // TODO: clean this up! need to split out Ray/RNG, don't need screen samples
   auto ss = createScreenSample(frameData);
@@ -176,7 +246,14 @@ RT_PROGRAM void __raygen__()
   auto ray = makePrimaryRay(ss);
   /////////////////////////////////////////////////////////////////////////////
 
-  auto color = vec3(getBackground(frameData.renderer, ss.screen));
+  const auto method =
+      static_cast<DebugMethod>(frameData.renderer.params.debug.method);
+  if (isTraversalCostMethod(method)) {
+    renderTraversalCost(ss, ray, method);
+    return;
+  }
+
+  auto color = vec3(getBackground(frameData, ss.screen, ray.dir));
   auto depth = ray.t.upper;
   auto normal = ray.dir;
   uint32_t primID = ~0u;
@@ -40,9 +40,9 @@ static const std::vector<HitgroupFunctionNames> g_dptHitNames = {
 
 DiffusePathTracer::DiffusePathTracer(DeviceGlobalState *s) : Renderer(s) {}
 
-void DiffusePathTracer::commit()
+void DiffusePathTracer::commitObject()
 {
-  Renderer::commit();
+  Renderer::commitObject();
   m_maxDepth = std::clamp(getParam<int>("maxDepth", 5), 1, 256);
 }
 
@@ -45,6 +45,7 @@ struct PathData
 {
   int depth{0};
   vec3 Lw{1.f};
+  vec3 L{0.f}; // emitted radiance gathered along the path
   Hit currentHit{};
 };
 
@@ -75,6 +76,11 @@ RT_PROGRAM void __miss__()
 
 RT_PROGRAM void __raygen__()
 {
+  if (pickRequested(frameData)) {
+    tracePick(frameData, RayType::DIFFUSE_RADIANCE);
+    return;
+  }
+
   auto &rendererParams = frameData.renderer;
   auto &dptParams = rendererParams.params.dpt;
 
@@ -94,7 +100,7 @@ RT_PROGRAM void __raygen__()
   if (debug())
     printf("========== BEGIN: FrameID %i ==========\n", frameData.fb.frameID);
 
-  const auto bg = getBackground(frameData.renderer, ss.screen);
+  const auto bg = getBackground(frameData, ss.screen, ray.dir);
   vec3 outColor(bg);
   vec3 outNormal = ray.dir;
   float outDepth = tmax;
@@ -105,8 +111,11 @@ RT_PROGRAM void __raygen__()
   while (true) {
     if (debug())
       printf("-------- BOUNCE: %i --------\n", pathData.depth);
+    const uint32_t visibility =
+        pathData.depth == 0 ? VISIBILITY_MASK_CAMERA : VISIBILITY_MASK_SECONDARY;
+
     hit.foundHit = false;
-    intersectSurface(ss, ray, RayType::DIFFUSE_RADIANCE, &hit, 0);
+    intersectSurface(ss, ray, RayType::DIFFUSE_RADIANCE, &hit, 0, visibility);
 
     float volumeOpacity = 0.f;
     vec3 volumeColor(0.f);
@@ -121,7 +130,8 @@ RT_PROGRAM void __raygen__()
         volumeOpacity,
         Tr,
         vObjID,
-        vInstID);
+        vInstID,
+        visibility);
 
     const bool volumeHit = Tr < 1.f && (!hit.foundHit || volumeDepth < hit.t);
 
@@ -133,18 +143,42 @@ RT_PROGRAM void __raygen__()
       break;
     }
 
-    vec3 albedo(1.f);
     vec3 pos(0.f);
+    vec3 scatterDir(0.f);
 
     if (!volumeHit) {
-      pos = hit.hitpoint + (hit.epsilon * hit.Ng);
       const auto &material = *hit.material;
-      albedo = getMaterialParameter(frameData, material.baseColor, hit);
+      const auto matValues = getMaterialValues(frameData, material, hit);
+
+      pathData.L += pathData.Lw * matValues.emissive;
+
+      // Shade the side facing the incoming ray
+      const vec3 wo = -ray.dir;
+      vec3 Ns = matValues.normal;
+      if (dot(Ns, wo) < 0.f)
+        Ns = -Ns;
+      const auto frame = makeShadingFrame(Ns);
+
+      const vec3 u(curand_uniform(&ss.rs),
+          curand_uniform(&ss.rs),
+          curand_uniform(&ss.rs));
+      vec3 wi(0.f);
+      float pdf = 0.f;
+      pathData.Lw *= bsdfSample(matValues, frame.toLocal(wo), u, wi, pdf);
+      scatterDir = frame.toWorld(wi);
+
+      // Don't continue through the geometric surface
+      const vec3 Ng = dot(hit.Ng, wo) < 0.f ? -hit.Ng : hit.Ng;
+      if (pdf == 0.f || dot(scatterDir, Ng) <= 0.f) {
+        pathData.Lw = vec3(0.f);
+        break;
+      }
+      pos = hit.hitpoint + (hit.epsilon * Ng);
     } else {
       pos = ray.org + volumeDepth * ray.dir;
-      albedo = volumeColor;
+      pathData.Lw *= volumeColor;
+      scatterDir = sampleUnitSphere(ss.rs, -ray.dir);
     }
-    pathData.Lw *= albedo;
 
     // RR absorption
     float P = glm::compMax(pathData.Lw);
@@ -156,15 +190,6 @@ RT_PROGRAM void __raygen__()
       pathData.Lw /= P;
     }
 
-    // pathData.Lw += Le; // TODO: emission
-
-    vec3 scatterDir(0.f);
-    if (!volumeHit) {
-      scatterDir = randomDir(ss.rs, hit.Ns);
-      pathData.Lw *= fmaxf(0.f, dot(scatterDir, hit.Ng));
-    } else
-      scatterDir = sampleUnitSphere(ss.rs, -ray.dir);
-
     ray.org = pos;
     ray.dir = scatterDir;
     ray.t.lower = 0.f;
@@ -181,11 +206,15 @@ RT_PROGRAM void __raygen__()
   }
 
   vec3 Ld(rendererParams.ambientIntensity); // ambient light!
+  // paths escaping the scene are lit by an environment background
+  if (pathData.depth > 0
+      && rendererParams.backgroundMode == BackgroundMode::ENVIRONMENT)
+    Ld += vec3(getBackground(frameData, ss.screen, ray.dir, false));
   // if (numLights > 0) {
   //   Ld = ...;
   // }
 
-  vec3 color = pathData.depth ? pathData.Lw * Ld : vec3(bg);
+  vec3 color = pathData.depth ? pathData.L + pathData.Lw * Ld : vec3(bg);
   if (crosshair())
     color = vec3(1) - color;
   if (debug())
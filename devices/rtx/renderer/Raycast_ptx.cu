@@ -52,6 +52,11 @@ RT_PROGRAM void __miss__()
 
 RT_PROGRAM void __raygen__()
 {
+  if (pickRequested(frameData)) {
+    tracePick(frameData, RayType::PRIMARY);
+    return;
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // TODO: clean this up! need to split out Ray/RNG, don't need screen samples
   auto ss = createScreenSample(frameData);
@@ -146,7 +151,7 @@ RT_PROGRAM void __raygen__()
 
       color *= opacity;
 
-      const auto bg = getBackground(frameData.renderer, ss.screen);
+      const auto bg = getBackground(frameData, ss.screen, ray.dir);
       accumulateValue(color, vec3(bg), opacity);
       accumulateValue(opacity, bg.w, opacity);
       accumulateValue(outputColor, color, outputOpacity);
@@ -38,6 +38,8 @@
 #include "SciVis.h"
 #include "Test.h"
 #include "UnknownRenderer.h"
+// gpu
+#include "gpu/aoSampling.h"
 // std
 #include <atomic>
 #include <stdlib.h>
@@ -76,6 +78,16 @@ static bool beginsWith(const std::string_view &inputString,
   return startingMatch.size() == startsWithString.size();
 }
 
+static AOSampling aoSamplingFromString(const std::string &name)
+{
+  if (name == "random")
+    return AOSampling::RANDOM;
+  else if (name == "stratified")
+    return AOSampling::STRATIFIED;
+  else
+    return AOSampling::LOW_DISCREPANCY;
+}
+
 static Renderer *make_renderer(std::string_view subtype, DeviceGlobalState *d)
 {
   auto splitString = [](const std::string &input,
@@ -134,20 +146,19 @@ Renderer::~Renderer()
   s_numRenderers--;
 }
 
-void Renderer::commit()
+void Renderer::commitObject()
 {
-  cleanup();
-  m_backgroundImage = getParamObject<Array2D>("background");
-  if (m_backgroundImage) {
-    auto cuArray = m_backgroundImage->acquireCUDAArrayUint8();
-    m_backgroundTexture = makeCudaTextureObject(cuArray, true, "linear");
-  }
+  updateBackground();
 
   m_bgColor = getParam<vec4>("background", vec4(vec3(0.f), 1.f));
   m_spp = getParam<int>("pixelSamples", 1);
   m_ambientColor = getParam<vec3>("ambientColor", vec3(1.f));
   m_ambientIntensity = getParam<float>("ambientRadiance", 0.f);
   m_occlusionDistance = getParam<float>("ambientOcclusionDistance", 1e20f);
+  m_occlusionDistanceScale =
+      std::max(getParam<float>("ambientOcclusionDistanceScale", 0.1f), 0.f);
+  m_aoSampling = static_cast<int>(aoSamplingFromString(
+      getParamString("ambientOcclusionSampling", "lowDiscrepancy")));
   m_checkerboard = getParam<bool>("checkerboarding", false);
   m_denoise = getParam<bool>("denoise", false);
   m_sampleLimit = getParam<int>("sampleLimit", 128);
@@ -163,10 +174,17 @@ Span<std::string> Renderer::missSbtNames() const
   return make_Span(&m_defaultMissName, 1);
 }
 
+bool Renderer::tracksTraversalCost() const
+{
+  return false;
+}
+
 void Renderer::populateFrameData(FrameGPUData &fd) const
 {
   if (m_backgroundImage) {
-    fd.renderer.backgroundMode = BackgroundMode::IMAGE;
+    fd.renderer.backgroundMode = m_backgroundEnvironment
+        ? BackgroundMode::ENVIRONMENT
+        : BackgroundMode::IMAGE;
     fd.renderer.background.texobj = m_backgroundTexture;
   } else {
     fd.renderer.backgroundMode = BackgroundMode::COLOR;
@@ -175,6 +193,8 @@ void Renderer::populateFrameData(FrameGPUData &fd) const
   fd.renderer.ambientColor = ambientColor();
   fd.renderer.ambientIntensity = ambientIntensity();
   fd.renderer.occlusionDistance = ambientOcclusionDistance();
+  fd.renderer.occlusionDistanceScale = m_occlusionDistanceScale;
+  fd.renderer.aoSampling = m_aoSampling;
 }
 
 OptixPipeline Renderer::pipeline() const
@@ -486,12 +506,37 @@ OptixPipelineCompileOptions makeVisRTXOptixPipelineCompileOptions()
   return pipelineCompileOptions;
 }
 
+void Renderer::updateBackground()
+{
+  auto *image = getParamObject<Array2D>("background");
+  const bool environment =
+      getParamString("backgroundMapping", "screen") == "equirectangular";
+
+  // The mip-mapped texture outlives commits which don't change the image
+  if (image == m_backgroundImage.ptr
+      && environment == m_backgroundEnvironment)
+    return;
+
+  cleanup();
+
+  m_backgroundImage = image;
+  m_backgroundEnvironment = environment;
+
+  if (m_backgroundImage) {
+    const uvec2 size(image->size().x, image->size().y);
+    auto cuArray = m_backgroundImage->acquireCUDAMipmappedArrayFloat();
+    m_backgroundTexture = makeCudaTextureObject(
+        cuArray, size, environment ? "repeat" : "clampToEdge");
+  }
+}
+
 void Renderer::cleanup()
 {
   if (m_backgroundImage) {
     if (m_backgroundTexture) {
       cudaDestroyTextureObject(m_backgroundTexture);
-      m_backgroundImage->releaseCUDAArrayUint8();
+      m_backgroundImage->releaseCUDAMipmappedArrayFloat();
+      m_backgroundTexture = {};
     }
     m_backgroundImage->removeCommitObserver(this);
   }
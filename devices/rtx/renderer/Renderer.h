@@ -57,7 +57,7 @@ struct Renderer : public Object
   Renderer(DeviceGlobalState *s);
   ~Renderer() override;
 
-  virtual void commit() override;
+  virtual void commitObject() override;
 
   virtual OptixModule optixModule() const = 0;
 
@@ -66,6 +66,9 @@ struct Renderer : public Object
 
   virtual void populateFrameData(FrameGPUData &fd) const;
 
+  // Whether frames need to track the largest per-pixel traversal cost
+  virtual bool tracksTraversalCost() const;
+
   OptixPipeline pipeline() const;
   const OptixShaderBindingTable *sbt();
 
@@ -87,12 +90,15 @@ struct Renderer : public Object
   vec3 m_ambientColor{1.f};
   float m_ambientIntensity{1.f};
   float m_occlusionDistance{1e20f};
+  float m_occlusionDistanceScale{0.1f};
+  int m_aoSampling{0};
   bool m_checkerboard{false};
   bool m_denoise{false};
   int m_sampleLimit{0};
 
   helium::IntrusivePtr<Array2D> m_backgroundImage;
   cudaTextureObject_t m_backgroundTexture{};
+  bool m_backgroundEnvironment{false};
 
   // OptiX //
 
@@ -108,6 +114,7 @@ struct Renderer : public Object
 
  private:
   void initOptixPipeline();
+  void updateBackground();
   void cleanup();
 
   HitgroupFunctionNames m_defaultHitgroupNames;
@@ -44,9 +44,9 @@ static const std::vector<std::string> g_scivisMissNames = {
 
 SciVis::SciVis(DeviceGlobalState *s) : Renderer(s) {}
 
-void SciVis::commit()
+void SciVis::commitObject()
 {
-  Renderer::commit();
+  Renderer::commitObject();
   m_lightFalloff = std::clamp(getParam<float>("lightFalloff", 1.f), 0.f, 1.f);
   m_aoSamples = std::clamp(getParam<int>("ambientSamples", 1), 0, 256);
 }
@@ -53,8 +53,12 @@ RT_FUNCTION float attenuation(ScreenSample &ss, Ray r)
 {
   RayAttenuation ra;
   ra.ray = &r;
-  intersectVolume(
-      ss, r, RayType::SHADOW, &ra, OPTIX_RAY_FLAG_DISABLE_CLOSESTHIT);
+  intersectVolume(ss,
+      r,
+      RayType::SHADOW,
+      &ra,
+      OPTIX_RAY_FLAG_DISABLE_CLOSESTHIT,
+      VISIBILITY_MASK_SHADOW);
   return ra.attenuation;
 }
 
@@ -91,7 +95,10 @@ RT_FUNCTION vec3 computeLightConrib(ScreenSample &ss, const SurfaceHit &hit)
 
 RT_PROGRAM void __closesthit__shadow()
 {
-  // no-op
+  if (ray::isIntersectingSurfaces()) {
+    auto &occluded = ray::rayData<uint32_t>();
+    occluded = true;
+  }
 }
 
 RT_PROGRAM void __anyhit__shadow()
@@ -129,6 +136,11 @@ RT_PROGRAM void __miss__()
 
 RT_PROGRAM void __raygen__()
 {
+  if (pickRequested(frameData)) {
+    tracePick(frameData, RayType::PRIMARY);
+    return;
+  }
+
   const auto &rendererParams = frameData.renderer;
   const auto &scivisParams = rendererParams.params.scivis;
 
@@ -197,16 +209,17 @@ RT_PROGRAM void __raygen__()
                                   ray,
                                   RayType::SHADOW,
                                   surfaceHit,
-                                  rendererParams.occlusionDistance,
+                                  aoDistance(frameData),
                                   scivisParams.aoSamples)
                                                          : 1.f)
           * rendererParams.ambientIntensity;
 
       accumulateValue(color,
           (matValues.baseColor
-              * (computeLightConrib(ss, surfaceHit)
-                  + (rendererParams.ambientColor * aoFactor
-                      * scivisParams.lightFalloff))),
+                  * (computeLightConrib(ss, surfaceHit)
+                      + (rendererParams.ambientColor * aoFactor
+                          * scivisParams.lightFalloff))
+              + matValues.emissive),
           opacity);
       accumulateValue(opacity, matValues.opacity, opacity);
 
@@ -236,7 +249,7 @@ RT_PROGRAM void __raygen__()
 
       color *= opacity;
 
-      const auto bg = getBackground(frameData.renderer, ss.screen);
+      const auto bg = getBackground(frameData, ss.screen, ray.dir);
       accumulateValue(color, vec3(bg), opacity);
       accumulateValue(opacity, bg.w, opacity);
       accumulateValue(outputColor, color, outputOpacity);
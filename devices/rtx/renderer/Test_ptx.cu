@@ -42,7 +42,8 @@ DECLARE_FRAME_DATA(frameData)
 
 RT_PROGRAM void __closesthit__()
 {
-  // no-op
+  // Only pick rays are traced
+  ray::populateHit();
 }
 
 RT_PROGRAM void __miss__()
@@ -52,6 +53,11 @@ RT_PROGRAM void __miss__()
 
 RT_PROGRAM void __raygen__()
 {
+  if (pickRequested(frameData)) {
+    tracePick(frameData, RayType::PRIMARY);
+    return;
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // TODO: clean this up! need to split out Ray/RNG, don't need screen samples
   auto ss = createScreenSample(frameData);
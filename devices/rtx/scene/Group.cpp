@@ -51,6 +51,30 @@ static std::vector<OptixBuildInput> createOBI(const std::vector<T *> &objs)
   return createOBI(make_Span(objs.data(), objs.size()));
 }
 
+static size_t numPrimitives(const std::vector<Surface *> &surfaces)
+{
+  size_t n = 0;
+  for (auto *s : surfaces) {
+    const auto bi = s->buildInput();
+    if (bi.type == OPTIX_BUILD_INPUT_TYPE_TRIANGLES) {
+      n += bi.triangleArray.numIndexTriplets > 0
+          ? bi.triangleArray.numIndexTriplets
+          : bi.triangleArray.numVertices / 3;
+    } else if (bi.type == OPTIX_BUILD_INPUT_TYPE_CURVES)
+      n += bi.curveArray.numPrimitives;
+    else
+      n += bi.customPrimitiveArray.numPrimitives;
+  }
+  return n;
+}
+
+static bool allMaterialsOpaque(const std::vector<Surface *> &surfaces)
+{
+  return std::all_of(surfaces.begin(), surfaces.end(), [](auto *s) {
+    return s->material()->isOpaque();
+  });
+}
+
 // Group definitions //////////////////////////////////////////////////////////
 
 static size_t s_numGroups = 0;
@@ -76,14 +100,14 @@ bool Group::getProperty(
 {
   if (name == "bounds" && type == ANARI_FLOAT32_BOX3) {
     if (flags & ANARI_WAIT) {
-      deviceState()->commitBufferFlush();
+      deviceState()->flushCommits();
       rebuildSurfaceBVHs();
       rebuildVolumeBVH();
     }
-    auto bounds = m_triangleBounds;
-    bounds.extend(m_curveBounds);
-    bounds.extend(m_userBounds);
-    bounds.extend(m_volumeBounds);
+    auto bounds = m_surfaceBLAS->triangleBounds;
+    bounds.extend(m_surfaceBLAS->curveBounds);
+    bounds.extend(m_surfaceBLAS->userBounds);
+    bounds.extend(m_volumeBLAS->bounds);
     std::memcpy(ptr, &bounds, sizeof(bounds));
     return true;
   }
@@ -91,7 +115,7 @@ bool Group::getProperty(
   return Object::getProperty(name, type, ptr, flags);
 }
 
-void Group::commit()
+void Group::commitObject()
 {
   cleanup();
 
@@ -111,49 +135,67 @@ void Group::commit()
     m_lightData->addCommitObserver(this);
 }
 
-OptixTraversableHandle Group::optixTraversableTriangle() const
+const OptixTraversableHandle &Group::optixTraversableTriangle() const
 {
-  return m_traversableTriangle;
+  return m_surfaceBLAS->traversableTriangle;
 }
 
-OptixTraversableHandle Group::optixTraversableCurve() const
+const OptixTraversableHandle &Group::optixTraversableCurve() const
 {
-  return m_traversableCurve;
+  return m_surfaceBLAS->traversableCurve;
 }
 
-OptixTraversableHandle Group::optixTraversableUser() const
+const OptixTraversableHandle &Group::optixTraversableUser() const
 {
-  return m_traversableUser;
+  return m_surfaceBLAS->traversableUser;
 }
 
-OptixTraversableHandle Group::optixTraversableVolume() const
+const OptixTraversableHandle &Group::optixTraversableVolume() const
 {
-  return m_traversableVolume;
+  return m_volumeBLAS->traversable;
+}
+
+std::shared_ptr<const Group::SurfaceBLAS> Group::surfaceBLAS() const
+{
+  return m_surfaceBLAS;
+}
+
+std::shared_ptr<const Group::VolumeBLAS> Group::volumeBLAS() const
+{
+  return m_volumeBLAS;
+}
+
+std::shared_ptr<const DeviceBuffer> Group::lightGPUData() const
+{
+  return m_lightObjectIndices;
 }
 
 Span<DeviceObjectIndex> Group::surfaceTriangleGPUIndices() const
 {
   return make_Span(
-      (const DeviceObjectIndex *)m_surfaceTriangleObjectIndices.ptr(),
+      (const DeviceObjectIndex *)m_surfaceBLAS->triangleObjectIndices.ptr(),
       m_surfacesTriangle.size());
 }
 
 Span<DeviceObjectIndex> Group::surfaceCurveGPUIndices() const
 {
-  return make_Span((const DeviceObjectIndex *)m_surfaceCurveObjectIndices.ptr(),
+  return make_Span(
+      (const DeviceObjectIndex *)m_surfaceBLAS->curveObjectIndices.ptr(),
       m_surfacesCurve.size());
 }
 
 Span<DeviceObjectIndex> Group::surfaceUserGPUIndices() const
 {
-  return make_Span((const DeviceObjectIndex *)m_surfaceUserObjectIndices.ptr(),
+  return make_Span(
+      (const DeviceObjectIndex *)m_surfaceBLAS->userObjectIndices.ptr(),
       m_surfacesUser.size());
 }
 
 Span<DeviceObjectIndex> Group::volumeGPUIndices() const
 {
   return make_Span(
-      (const DeviceObjectIndex *)m_volumeObjectIndices.ptr(), m_volumes.size());
+      (const DeviceObjectIndex *)m_volumeBLAS->objectIndices.ptr(),
+      m_volumes.size());
 }
 
 bool Group::containsTriangleGeometry() const
@@ -181,30 +223,80 @@ bool Group::containsLights() const
   return m_lights.size() > 0;
 }
 
+bool Group::trianglesOpaque() const
+{
+  return m_trianglesOpaque;
+}
+
+bool Group::curvesOpaque() const
+{
+  return m_curvesOpaque;
+}
+
+bool Group::userOpaque() const
+{
+  return m_userOpaque;
+}
+
 Span<DeviceObjectIndex> Group::lightGPUIndices() const
 {
-  return make_Span(
-      (const DeviceObjectIndex *)m_lightObjectIndices.ptr(), m_lights.size());
+  return make_Span(m_lightObjectIndices
+          ? (const DeviceObjectIndex *)m_lightObjectIndices->ptr()
+          : nullptr,
+      m_lights.size());
+}
+
+const std::vector<Surface *> &Group::surfacesTriangle() const
+{
+  return m_surfacesTriangle;
+}
+
+const std::vector<Surface *> &Group::surfacesCurve() const
+{
+  return m_surfacesCurve;
+}
+
+const std::vector<Surface *> &Group::surfacesUser() const
+{
+  return m_surfacesUser;
+}
+
+size_t Group::numSurfacePrimitives() const
+{
+  return m_numSurfacePrimitives;
 }
 
 void Group::rebuildSurfaceBVHs()
+{
+  std::vector<BVHBuildRequest> requests;
+  queueSurfaceBVHBuilds(requests);
+  buildOptixBVHs(requests, this);
+  finishSurfaceBVHBuilds();
+}
+
+void Group::rebuildVolumeBVH()
+{
+  std::vector<BVHBuildRequest> requests;
+  queueVolumeBVHBuild(requests);
+  buildOptixBVHs(requests, this);
+  finishVolumeBVHBuild();
+}
+
+void Group::queueSurfaceBVHBuilds(std::vector<BVHBuildRequest> &requests)
 {
   partitionValidGeometriesByType();
 
-  m_triangleBounds = box3();
-  m_curveBounds = box3();
-  m_userBounds = box3();
-  m_traversableTriangle = {};
-  m_traversableCurve = {};
-  m_traversableUser = {};
+  // The requests fill in new BLASs, leaving the previous ones to the TLASs
+  // which still reference them
+  m_surfaceBLAS = std::make_shared<SurfaceBLAS>();
+  auto &blas = *m_surfaceBLAS;
 
   if (!m_surfacesTriangle.empty()) {
     reportMessage(ANARI_SEVERITY_DEBUG, "visrtx::Group building triangle BVH");
-    buildOptixBVH(createOBI(m_surfacesTriangle),
-        m_bvhTriangle,
-        m_traversableTriangle,
-        m_triangleBounds,
-        this);
+    requests.push_back({createOBI(m_surfacesTriangle),
+        &blas.bvhTriangle,
+        &blas.traversableTriangle,
+        &blas.triangleBounds});
   } else {
     reportMessage(
         ANARI_SEVERITY_DEBUG, "visrtx::Group skipping triangle BVH build");
@@ -212,11 +304,10 @@ void Group::rebuildSurfaceBVHs()
 
   if (!m_surfacesCurve.empty()) {
     reportMessage(ANARI_SEVERITY_DEBUG, "visrtx::Group building curve BVH");
-    buildOptixBVH(createOBI(m_surfacesCurve),
-        m_bvhCurve,
-        m_traversableCurve,
-        m_curveBounds,
-        this);
+    requests.push_back({createOBI(m_surfacesCurve),
+        &blas.bvhCurve,
+        &blas.traversableCurve,
+        &blas.curveBounds});
   } else {
     reportMessage(
         ANARI_SEVERITY_DEBUG, "visrtx::Group skipping curve BVH build");
@@ -224,38 +315,48 @@ void Group::rebuildSurfaceBVHs()
 
   if (!m_surfacesUser.empty()) {
     reportMessage(ANARI_SEVERITY_DEBUG, "visrtx::Group building user BVH");
-    buildOptixBVH(createOBI(m_surfacesUser),
-        m_bvhUser,
-        m_traversableUser,
-        m_userBounds,
-        this);
+    requests.push_back({createOBI(m_surfacesUser),
+        &blas.bvhUser,
+        &blas.traversableUser,
+        &blas.userBounds});
   } else {
     reportMessage(
         ANARI_SEVERITY_DEBUG, "visrtx::Group skipping user BVH build");
   }
-
-  buildSurfaceGPUData();
-
-  m_objectUpdates.lastSurfaceBVHBuilt = helium::newTimeStamp();
 }
 
-void Group::rebuildVolumeBVH()
+void Group::queueVolumeBVHBuild(std::vector<BVHBuildRequest> &requests)
 {
   partitionValidVolumes();
+  m_volumeBLAS = std::make_shared<VolumeBLAS>();
   if (m_volumes.empty()) {
-    m_volumeBounds = box3();
-    m_traversableVolume = {};
     reportMessage(
         ANARI_SEVERITY_DEBUG, "visrtx::Group skipping volume BVH build");
     return;
   }
 
   reportMessage(ANARI_SEVERITY_DEBUG, "visrtx::Group building volume BVH");
-  buildOptixBVH(createOBI(m_volumes),
-      m_bvhVolume,
-      m_traversableVolume,
-      m_volumeBounds,
-      this);
+  auto &blas = *m_volumeBLAS;
+  requests.push_back(
+      {createOBI(m_volumes), &blas.bvh, &blas.traversable, &blas.bounds});
+}
+
+void Group::finishSurfaceBVHBuilds()
+{
+  buildSurfaceGPUData();
+
+  m_numSurfacePrimitives = numPrimitives(m_surfacesTriangle)
+      + numPrimitives(m_surfacesCurve) + numPrimitives(m_surfacesUser);
+
+  m_objectUpdates.lastSurfaceBVHBuilt = helium::newTimeStamp();
+  m_objectUpdates.lastOpacityUpdate = 0;
+  updateOpacity();
+}
+
+void Group::finishVolumeBVHBuild()
+{
+  if (m_volumes.empty())
+    return;
 
   buildVolumeGPUData();
 
@@ -269,6 +370,19 @@ void Group::rebuildLights()
   m_objectUpdates.lastLightRebuild = helium::newTimeStamp();
 }
 
+void Group::updateOpacity()
+{
+  const auto &state = *deviceState();
+  if (state.objectUpdates.lastOpacityChange < m_objectUpdates.lastOpacityUpdate)
+    return;
+
+  m_trianglesOpaque = allMaterialsOpaque(m_surfacesTriangle);
+  m_curvesOpaque = allMaterialsOpaque(m_surfacesCurve);
+  m_userOpaque = allMaterialsOpaque(m_surfacesUser);
+
+  m_objectUpdates.lastOpacityUpdate = helium::newTimeStamp();
+}
+
 void Group::markCommitted()
 {
   Object::markCommitted();
@@ -352,9 +466,8 @@ void Group::buildSurfaceGPUData()
         m_surfacesTriangle.end(),
         tmp.begin(),
         [](auto v) { return v->index(); });
-    m_surfaceTriangleObjectIndices.upload(tmp);
-  } else
-    m_surfaceTriangleObjectIndices.reset();
+    m_surfaceBLAS->triangleObjectIndices.upload(tmp);
+  }
 
   if (!m_surfacesCurve.empty()) {
     std::vector<DeviceObjectIndex> tmp(m_surfacesCurve.size());
@@ -362,9 +475,8 @@ void Group::buildSurfaceGPUData()
         m_surfacesCurve.end(),
         tmp.begin(),
         [](auto v) { return v->index(); });
-    m_surfaceCurveObjectIndices.upload(tmp);
-  } else
-    m_surfaceCurveObjectIndices.reset();
+    m_surfaceBLAS->curveObjectIndices.upload(tmp);
+  }
 
   if (!m_surfacesUser.empty()) {
     std::vector<DeviceObjectIndex> tmp(m_surfacesUser.size());
@@ -372,9 +484,8 @@ void Group::buildSurfaceGPUData()
         m_surfacesUser.begin(), m_surfacesUser.end(), tmp.begin(), [](auto v) {
           return v->index();
         });
-    m_surfaceUserObjectIndices.upload(tmp);
-  } else
-    m_surfaceUserObjectIndices.reset();
+    m_surfaceBLAS->userObjectIndices.upload(tmp);
+  }
 }
 
 void Group::buildVolumeGPUData()
@@ -383,18 +494,21 @@ void Group::buildVolumeGPUData()
   std::transform(m_volumes.begin(), m_volumes.end(), tmp.begin(), [](auto v) {
     return v->index();
   });
-  m_volumeObjectIndices.upload(tmp);
+  m_volumeBLAS->objectIndices.upload(tmp);
 }
 
 void Group::buildLightGPUData()
 {
+  // Uploaded to a new buffer, as the current TLAS may still reference the old
+  m_lightObjectIndices.reset();
   if (m_lights.empty())
     return;
   std::vector<DeviceObjectIndex> tmp(m_lights.size());
   std::transform(m_lights.begin(), m_lights.end(), tmp.begin(), [](auto l) {
     return l->index();
   });
-  m_lightObjectIndices.upload(tmp);
+  m_lightObjectIndices = std::make_shared<DeviceBuffer>();
+  m_lightObjectIndices->upload(tmp);
 }
 
 void Group::cleanup()
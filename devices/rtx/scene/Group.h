@@ -36,11 +36,39 @@
 #include "surface/Surface.h"
 #include "utility/HostDeviceArray.h"
 #include "volume/Volume.h"
+// std
+#include <memory>
 
 namespace visrtx {
 
 struct Group : public Object
 {
+  // BVHs and the GPU data instances reference, replaced as a whole by each
+  // rebuild so TLASs built over the previous ones stay valid until retired
+  struct SurfaceBLAS
+  {
+    OptixTraversableHandle traversableTriangle{};
+    OptixTraversableHandle traversableCurve{};
+    OptixTraversableHandle traversableUser{};
+    DeviceBuffer bvhTriangle;
+    DeviceBuffer bvhCurve;
+    DeviceBuffer bvhUser;
+    box3 triangleBounds;
+    box3 curveBounds;
+    box3 userBounds;
+    DeviceBuffer triangleObjectIndices;
+    DeviceBuffer curveObjectIndices;
+    DeviceBuffer userObjectIndices;
+  };
+
+  struct VolumeBLAS
+  {
+    OptixTraversableHandle traversable{};
+    DeviceBuffer bvh;
+    box3 bounds;
+    DeviceBuffer objectIndices;
+  };
+
   static size_t objectCount();
 
   Group(DeviceGlobalState *d);
@@ -51,12 +79,16 @@ struct Group : public Object
       void *ptr,
       uint32_t flags) override;
 
-  void commit() override;
+  void commitObject() override;
 
-  OptixTraversableHandle optixTraversableTriangle() const;
-  OptixTraversableHandle optixTraversableCurve() const;
-  OptixTraversableHandle optixTraversableUser() const;
-  OptixTraversableHandle optixTraversableVolume() const;
+  const OptixTraversableHandle &optixTraversableTriangle() const;
+  const OptixTraversableHandle &optixTraversableCurve() const;
+  const OptixTraversableHandle &optixTraversableUser() const;
+  const OptixTraversableHandle &optixTraversableVolume() const;
+
+  std::shared_ptr<const SurfaceBLAS> surfaceBLAS() const;
+  std::shared_ptr<const VolumeBLAS> volumeBLAS() const;
+  std::shared_ptr<const DeviceBuffer> lightGPUData() const;
 
   bool containsTriangleGeometry() const;
   bool containsCurveGeometry() const;
@@ -64,15 +96,32 @@ struct Group : public Object
   bool containsVolumes() const;
   bool containsLights() const;
 
+  // Whether every surface of a geometry kind has a fully opaque material
+  bool trianglesOpaque() const;
+  bool curvesOpaque() const;
+  bool userOpaque() const;
+
   Span<DeviceObjectIndex> surfaceTriangleGPUIndices() const;
   Span<DeviceObjectIndex> surfaceCurveGPUIndices() const;
   Span<DeviceObjectIndex> surfaceUserGPUIndices() const;
   Span<DeviceObjectIndex> volumeGPUIndices() const;
   Span<DeviceObjectIndex> lightGPUIndices() const;
 
+  const std::vector<Surface *> &surfacesTriangle() const;
+  const std::vector<Surface *> &surfacesCurve() const;
+  const std::vector<Surface *> &surfacesUser() const;
+  size_t numSurfacePrimitives() const;
+
   void rebuildSurfaceBVHs();
   void rebuildVolumeBVH();
   void rebuildLights();
+  void updateOpacity();
+
+  // Split rebuilds, so the BVHs of many groups can be built in one batch
+  void queueSurfaceBVHBuilds(std::vector<BVHBuildRequest> &requests);
+  void queueVolumeBVHBuild(std::vector<BVHBuildRequest> &requests);
+  void finishSurfaceBVHBuilds();
+  void finishVolumeBVHBuild();
 
   void markCommitted() override;
 
@@ -93,23 +142,19 @@ struct Group : public Object
   std::vector<Surface *> m_surfacesCurve;
   std::vector<Surface *> m_surfacesUser;
 
-  DeviceBuffer m_surfaceTriangleObjectIndices;
-  DeviceBuffer m_surfaceCurveObjectIndices;
-  DeviceBuffer m_surfaceUserObjectIndices;
+  size_t m_numSurfacePrimitives{0};
 
   // Volume //
 
   helium::IntrusivePtr<ObjectArray> m_volumeData;
   std::vector<Volume *> m_volumes;
 
-  DeviceBuffer m_volumeObjectIndices;
-
   // Light //
 
   helium::IntrusivePtr<ObjectArray> m_lightData;
   std::vector<Light *> m_lights;
 
-  DeviceBuffer m_lightObjectIndices;
+  std::shared_ptr<DeviceBuffer> m_lightObjectIndices;
 
   // BVH //
 
@@ -118,24 +163,15 @@ struct Group : public Object
     helium::TimeStamp lastSurfaceBVHBuilt{0};
     helium::TimeStamp lastVolumeBVHBuilt{0};
     helium::TimeStamp lastLightRebuild{0};
+    helium::TimeStamp lastOpacityUpdate{0};
   } m_objectUpdates;
 
-  box3 m_triangleBounds;
-  box3 m_curveBounds;
-  box3 m_userBounds;
-  box3 m_volumeBounds;
-
-  OptixTraversableHandle m_traversableTriangle{};
-  DeviceBuffer m_bvhTriangle;
-
-  OptixTraversableHandle m_traversableCurve{};
-  DeviceBuffer m_bvhCurve;
-
-  OptixTraversableHandle m_traversableUser{};
-  DeviceBuffer m_bvhUser;
+  bool m_trianglesOpaque{true};
+  bool m_curvesOpaque{true};
+  bool m_userOpaque{true};
 
-  OptixTraversableHandle m_traversableVolume{};
-  DeviceBuffer m_bvhVolume;
+  std::shared_ptr<SurfaceBLAS> m_surfaceBLAS{std::make_shared<SurfaceBLAS>()};
+  std::shared_ptr<VolumeBLAS> m_volumeBLAS{std::make_shared<VolumeBLAS>()};
 };
 
 } // namespace visrtx
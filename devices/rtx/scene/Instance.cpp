@@ -30,7 +30,9 @@
  */
 
 #include "Instance.h"
+#include "utility/populateAttributePtr.h"
 // std
+#include <algorithm>
 #include <atomic>
 
 namespace visrtx {
@@ -49,31 +51,93 @@ Instance::Instance(DeviceGlobalState *d) : Object(ANARI_INSTANCE, d)
 
 Instance::~Instance()
 {
+  cleanup();
   s_numInstances--;
 }
 
-void Instance::commit()
+void Instance::commitObject()
 {
+  const auto last = commitState();
+  const auto lastID = m_id;
+  const auto lastXfm = m_xfm;
+  const auto lastVisibilityMask = m_visibilityMask;
+
+  cleanup();
+
   m_id = getParam<uint32_t>("id", ~0u);
   m_xfm = getParam<mat4x3>("transform", getParam<mat4>("transform", mat4(1)));
+  m_visibilityMask =
+      getParam<uint32_t>("visibilityMask", VISIBILITY_MASK_ALL)
+      & VISIBILITY_MASK_ALL;
   m_group = getParamObject<Group>("group");
   if (!m_group)
     reportMessage(ANARI_SEVERITY_WARNING, "missing 'group' on ANARIInstance");
+
+  m_xfmArray = getParamObject<Array1D>("transform");
+  m_idArray = getParamObject<Array1D>("id");
+  m_attributes[0] = getParamObject<Array1D>("attribute0");
+  m_attributes[1] = getParamObject<Array1D>("attribute1");
+  m_attributes[2] = getParamObject<Array1D>("attribute2");
+  m_attributes[3] = getParamObject<Array1D>("attribute3");
+  m_attributes[4] = getParamObject<Array1D>("color");
+
+  if (!arrayParametersValid()) {
+    m_xfmArray = {};
+    m_idArray = {};
+    for (auto &a : m_attributes)
+      a = {};
+  }
+
+  uploadAttributes();
+
+  if (m_xfmArray)
+    m_xfmArray->addCommitObserver(this);
+  if (m_idArray)
+    m_idArray->addCommitObserver(this);
+  for (auto &a : m_attributes) {
+    if (a)
+      a->addCommitObserver(this);
+  }
+
+  // Changes which keep the number of OptiX instance records the same only need
+  // a TLAS refit in the world, which also rewrites their attribute pointers
+  const auto change = classifyInstanceChange(last,
+      commitState(),
+      m_xfm != lastXfm || m_id != lastID
+          || m_visibilityMask != lastVisibilityMask);
+  m_tlasChanged = change == InstanceChange::TLAS;
+  m_transformChanged = change == InstanceChange::TRANSFORM;
+}
+
+size_t Instance::numTransforms() const
+{
+  return m_xfmArray ? m_xfmArray->size() : 1;
 }
 
-uint32_t Instance::userID() const
+uint32_t Instance::userID(size_t i) const
 {
-  return m_id;
+  return m_idArray ? m_idArray->beginAs<uint32_t>()[i] : m_id;
 }
 
-mat4x3 Instance::xfm() const
+mat4x3 Instance::xfm(size_t i) const
 {
-  return m_xfm;
+  return m_xfmArray ? mat4x3(m_xfmArray->beginAs<mat4>()[i]) : m_xfm;
 }
 
 bool Instance::xfmIsIdentity() const
 {
-  return xfm() == mat4x3(1);
+  return !m_xfmArray && xfm() == mat4x3(1);
+}
+
+const AttributePtr *Instance::attributesGPU() const
+{
+  return m_attributesGPU ? (const AttributePtr *)m_attributesGPU->ptrs.ptr()
+                         : nullptr;
+}
+
+std::shared_ptr<const void> Instance::attributesGPUOwner() const
+{
+  return m_attributesGPU;
 }
 
 const Group *Instance::group() const
@@ -86,10 +150,42 @@ Group *Instance::group()
   return m_group.ptr;
 }
 
+uint32_t Instance::visibilityMask() const
+{
+  return m_visibilityMask;
+}
+
+helium::TimeStamp Instance::lastTransformChange() const
+{
+  return m_lastTransformChange;
+}
+
 void Instance::markCommitted()
 {
   Object::markCommitted();
-  deviceState()->objectUpdates.lastTLASChange = helium::newTimeStamp();
+  auto &updates = deviceState()->objectUpdates;
+  if (m_tlasChanged)
+    updates.lastTLASChange = helium::newTimeStamp();
+  else if (m_transformChanged) {
+    m_lastTransformChange = helium::newTimeStamp();
+    updates.lastTransformChange = m_lastTransformChange;
+    for (auto &t : m_transformTrackers)
+      t.first->markDirty(t.second);
+  }
+}
+
+void Instance::addTransformTracker(
+    TransformUpdateTracker *tracker, size_t instanceIndex)
+{
+  m_transformTrackers.emplace_back(tracker, instanceIndex);
+}
+
+void Instance::removeTransformTracker(TransformUpdateTracker *tracker)
+{
+  m_transformTrackers.erase(std::remove_if(m_transformTrackers.begin(),
+                                m_transformTrackers.end(),
+                                [&](auto &t) { return t.first == tracker; }),
+      m_transformTrackers.end());
 }
 
 bool Instance::isValid() const
@@ -97,6 +193,83 @@ bool Instance::isValid() const
   return m_group;
 }
 
+bool Instance::arrayParametersValid()
+{
+  if (!m_xfmArray)
+    return true;
+
+  if (m_xfmArray->elementType() != ANARI_FLOAT32_MAT4) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "'transform' array on ANARIInstance must be of type FLOAT32_MAT4,"
+        " ignoring instance arrays");
+    return false;
+  }
+
+  const size_t n = m_xfmArray->size();
+
+  if (m_idArray
+      && (m_idArray->elementType() != ANARI_UINT32 || m_idArray->size() < n)) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "'id' array on ANARIInstance must be UINT32 with an element for each"
+        " transform, ignoring it");
+    m_idArray = {};
+  }
+
+  for (auto &a : m_attributes) {
+    if (a && (!isColor(a->elementType()) || a->size() < n)) {
+      reportMessage(ANARI_SEVERITY_WARNING,
+          "attribute array on ANARIInstance must be a color type with an"
+          " element for each transform, ignoring it");
+      a = {};
+    }
+  }
+
+  return true;
+}
+
+InstanceCommitState Instance::commitState() const
+{
+  InstanceCommitState state;
+  state.group = m_group.ptr;
+  state.numTransforms = numTransforms();
+  state.arrays[0] = m_xfmArray.ptr;
+  state.arrays[1] = m_idArray.ptr;
+  for (int i = 0; i < 5; i++)
+    state.arrays[i + 2] = m_attributes[i].ptr;
+  return state;
+}
+
+void Instance::uploadAttributes()
+{
+  const bool hasAttributes = std::any_of(std::begin(m_attributes),
+      std::end(m_attributes),
+      [](const auto &a) { return bool(a); });
+
+  m_attributesGPU.reset();
+  if (!hasAttributes)
+    return;
+
+  m_attributesGPU = std::make_shared<AttributesGPU>();
+  AttributePtr attr[5];
+  for (int i = 0; i < 5; i++) {
+    populateAttributePtr(m_attributes[i], attr[i]);
+    m_attributesGPU->arrays[i] = m_attributes[i];
+  }
+  m_attributesGPU->ptrs.upload(attr, 5);
+}
+
+void Instance::cleanup()
+{
+  if (m_xfmArray)
+    m_xfmArray->removeCommitObserver(this);
+  if (m_idArray)
+    m_idArray->removeCommitObserver(this);
+  for (auto &a : m_attributes) {
+    if (a)
+      a->removeCommitObserver(this);
+  }
+}
+
 } // namespace visrtx
 
 VISRTX_ANARI_TYPEFOR_DEFINITION(visrtx::Instance *);
@@ -32,6 +32,11 @@
 #pragma once
 
 #include "Group.h"
+#include "utility/TransformUpdateTracker.h"
+// std
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace visrtx {
 
@@ -42,24 +47,64 @@ struct Instance : public Object
   Instance(DeviceGlobalState *d);
   ~Instance() override;
 
-  void commit() override;
+  void commitObject() override;
 
-  uint32_t userID() const;
+  // Number of placements, greater than one when 'transform' is an array
+  size_t numTransforms() const;
 
-  mat4x3 xfm() const;
+  uint32_t userID(size_t i = 0) const;
+
+  mat4x3 xfm(size_t i = 0) const;
   bool xfmIsIdentity() const;
 
+  const AttributePtr *attributesGPU() const;
+  // Owner of attributesGPU() and the arrays it points to, for TLASs to hold
+  std::shared_ptr<const void> attributesGPUOwner() const;
+
   const Group *group() const;
   Group *group();
 
+  uint32_t visibilityMask() const;
+
+  helium::TimeStamp lastTransformChange() const;
+
+  // Worlds register their trackers to be told when this instance, at
+  // 'instanceIndex' in their list of instances, only changed its transform
+  void addTransformTracker(
+      TransformUpdateTracker *tracker, size_t instanceIndex);
+  void removeTransformTracker(TransformUpdateTracker *tracker);
+
   void markCommitted() override;
 
   bool isValid() const override;
 
  private:
+  bool arrayParametersValid();
+  InstanceCommitState commitState() const;
+  void uploadAttributes();
+  void cleanup();
+
   mat4x3 m_xfm;
   helium::IntrusivePtr<Group> m_group;
   uint32_t m_id{~0u};
+
+  helium::IntrusivePtr<Array1D> m_xfmArray;
+  helium::IntrusivePtr<Array1D> m_idArray;
+  helium::IntrusivePtr<Array1D> m_attributes[5]; // attribute0-3 + color
+
+  // Replaced as a whole on upload, as TLASs may still reference the previous
+  struct AttributesGPU
+  {
+    DeviceBuffer ptrs;
+    helium::IntrusivePtr<Array1D> arrays[5];
+  };
+  std::shared_ptr<AttributesGPU> m_attributesGPU;
+  uint32_t m_visibilityMask{VISIBILITY_MASK_ALL};
+
+  bool m_tlasChanged{true};
+  bool m_transformChanged{false};
+  helium::TimeStamp m_lastTransformChange{0};
+  std::vector<std::pair<TransformUpdateTracker *, size_t>> m_transformTrackers;
 };
 
 } // namespace visrtx
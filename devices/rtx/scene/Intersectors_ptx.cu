@@ -30,7 +30,9 @@
  */
 
 #include "gpu/gpu_math.h"
+#include "gpu/isosurface.h"
 #include "gpu/shading_api.h"
+#include "gpu/slice.h"
 // glm
 #include <glm/gtx/norm.hpp>
 
@@ -225,6 +227,77 @@ RT_FUNCTION void intersectVolume()
   }
 }
 
+RT_FUNCTION void intersectIsosurface(const GeometryGPUData &geometryData)
+{
+  const auto &iso = geometryData.isosurface;
+
+  // Skip macrocells whose value range holds none of the isovalues
+  const uint32_t mask = iso.cellMasks[ray::primID()];
+  if (mask == 0)
+    return;
+
+  const auto &ss = ray::screenSample();
+  const auto &field = getSpatialFieldData(*ss.frameData, iso.field);
+
+  const vec3 org = ray::localOrigin();
+  const vec3 dir = ray::localDirection();
+  const box3 cell =
+      macrocellBounds(field.grid.dims, field.grid.worldBounds, ray::primID());
+  const box1 t = clipRayToBox(org, dir, cell, box1(ray::tmin(), ray::tmax()));
+
+  auto sampleAlongRay = [&](float rayT) {
+    return sampleSpatialField(field, org + dir * rayT);
+  };
+
+  float tHit = 0.f;
+  uint32_t isoID = 0;
+  if (!findIsoCrossing(sampleAlongRay,
+          iso.isovalues,
+          mask,
+          t,
+          iso.stepSize / glm::length(dir),
+          tHit,
+          isoID))
+    return;
+
+  auto sample = [&](const vec3 &p) { return sampleSpatialField(field, p); };
+  vec3 normal =
+      centralDifferenceGradient(sample, org + dir * tHit, iso.stepSize);
+  if (dot(normal, dir) > 0.f)
+    normal = -normal;
+
+  // 'u' carries the isovalue index, used to look up per-isovalue attributes
+  reportIntersection(tHit, normal, float(isoID));
+}
+
+RT_FUNCTION void intersectSlice(const GeometryGPUData &geometryData)
+{
+  const auto &slice = geometryData.slice;
+  const vec4 plane = slice.planes[ray::primID()];
+
+  const vec3 org = ray::localOrigin();
+  const vec3 dir = ray::localDirection();
+
+  float t = 0.f;
+  if (!intersectSlicePlane(
+          org, dir, plane, box1(ray::tmin(), ray::tmax()), t))
+    return;
+
+  const auto &ss = ray::screenSample();
+  const auto &volume = getVolumeData(*ss.frameData, slice.volume);
+
+  const vec3 p = org + dir * t;
+  if (!contains(p, volume.bounds))
+    return;
+
+  const auto &field =
+      getSpatialFieldData(*ss.frameData, volume.data.scivis.field);
+
+  // 'u' carries the field value, classified when the slice gets shaded
+  reportIntersection(
+      t, slicePlaneNormal(plane, dir), sampleSpatialField(field, p));
+}
+
 // Generic geometry dispatch //////////////////////////////////////////////////
 
 RT_FUNCTION void intersectGeometry()
@@ -244,6 +317,12 @@ RT_FUNCTION void intersectGeometry()
   case GeometryType::CONE:
     intersectCone(geometryData);
     break;
+  case GeometryType::ISOSURFACE:
+    intersectIsosurface(geometryData);
+    break;
+  case GeometryType::SLICE:
+    intersectSlice(geometryData);
+    break;
   }
 }
 
@@ -251,6 +330,7 @@ RT_FUNCTION void intersectGeometry()
 
 RT_PROGRAM void __intersection__()
 {
+  countIntersection(ray::screenSample().cost);
   if (ray::isIntersectingSurfaces())
     intersectGeometry();
   else
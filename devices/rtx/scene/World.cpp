@@ -30,8 +30,16 @@
  */
 
 #include "World.h"
+#include "utility/IndexRange.h"
 // ptx
 #include "Intersectors_ptx.h"
+// VisRTX
+#include "anari/ext/visrtx/visrtx.h"
+// std
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <unordered_set>
 
 namespace visrtx {
 
@@ -40,8 +48,27 @@ ptx_ptr intersection_ptx()
   return Intersectors_ptx;
 }
 
+// Ray queries read and write VisRTXRay/VisRTXRayHit buffers directly
+static_assert(sizeof(RayQueryRay) == sizeof(VisRTXRay));
+static_assert(offsetof(RayQueryRay, dir) == offsetof(VisRTXRay, direction));
+static_assert(offsetof(RayQueryRay, tmax) == offsetof(VisRTXRay, tmax));
+static_assert(sizeof(RayQueryHit) == sizeof(VisRTXRayHit));
+static_assert(offsetof(RayQueryHit, Ng) == offsetof(VisRTXRayHit, normal));
+static_assert(offsetof(RayQueryHit, hit) == offsetof(VisRTXRayHit, hit));
+
 // Helper functions ///////////////////////////////////////////////////////////
 
+static bool isDevicePointer(const void *ptr)
+{
+  cudaPointerAttributes attributes{};
+  if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+    cudaGetLastError(); // unregistered host memory on older CUDA versions
+    return false;
+  }
+  return attributes.type == cudaMemoryTypeDevice
+      || attributes.type == cudaMemoryTypeManaged;
+}
+
 static std::vector<OptixBuildInput> createOBI(
     HostDeviceArray<OptixInstance> &optixInstances)
 {
@@ -61,8 +88,49 @@ static std::vector<OptixBuildInput> createOBI(
   return {buildInput};
 }
 
+static OptixInstance makeOptixInstance(const mat4x3 &xfm,
+    uint32_t instID,
+    OptixTraversableHandle handle,
+    uint32_t sbtOffset,
+    uint32_t visibilityMask,
+    bool opaque = false)
+{
+  OptixInstance inst{};
+
+  mat3x4 xfmT = glm::transpose(xfm);
+  std::memcpy(inst.transform, &xfmT, sizeof(xfmT));
+
+  inst.traversableHandle = handle;
+  inst.flags =
+      opaque ? OPTIX_INSTANCE_FLAG_DISABLE_ANYHIT : OPTIX_INSTANCE_FLAG_NONE;
+  inst.instanceId = instID;
+  inst.sbtOffset = sbtOffset;
+  inst.visibilityMask = visibilityMask;
+
+  return inst;
+}
+
+// Smaller TLAS rebuilds aren't worth rendering stale frames for
+static constexpr size_t ASYNC_TLAS_MIN_INSTANCES = 1024;
+
+static const std::vector<Surface *> &surfacesWithOffset(
+    const Group *group, uint32_t sbtOffset)
+{
+  if (sbtOffset == SBT_TRIANGLE_OFFSET)
+    return group->surfacesTriangle();
+  else if (sbtOffset == SBT_CURVE_OFFSET)
+    return group->surfacesCurve();
+  else
+    return group->surfacesUser();
+}
+
 // World definitions //////////////////////////////////////////////////////////
 
+bool World::BLASMergeKey::operator<(const BLASMergeKey &o) const
+{
+  return std::memcmp(this, &o, sizeof(o)) < 0;
+}
+
 static size_t s_numWorlds = 0;
 
 size_t World::objectCount()
@@ -81,10 +149,16 @@ World::World(DeviceGlobalState *d) : Object(ANARI_WORLD, d)
   // never any public ref to these objects
   m_zeroGroup->refDec(helium::RefType::PUBLIC);
   m_zeroInstance->refDec(helium::RefType::PUBLIC);
+
+  m_tlas = std::make_unique<TLASData>();
 }
 
 World::~World()
 {
+  waitForAsyncTLAS();
+  if (m_asyncStream)
+    cudaStreamDestroy(m_asyncStream);
+  untrackInstanceTransforms();
   cleanup();
   s_numWorlds--;
 }
@@ -93,20 +167,21 @@ bool World::getProperty(
     const std::string_view &name, ANARIDataType type, void *ptr, uint32_t flags)
 {
   if (name == "bounds" && type == ANARI_FLOAT32_BOX3) {
-    if (flags & ANARI_WAIT) {
-      deviceState()->commitBufferFlush();
-      rebuildBVHs();
-    }
-    auto bounds = m_surfaceBounds;
-    bounds.extend(m_volumeBounds);
+    if (flags & ANARI_WAIT)
+      updateForQuery();
+    auto bounds = m_tlas->surfaceBounds;
+    bounds.extend(m_tlas->volumeBounds);
     std::memcpy(ptr, &bounds, sizeof(bounds));
     return true;
+  } else if (name == "rayQuery" && type == ANARI_BOOL) {
+    helium::writeToVoidP(ptr, traceRays());
+    return true;
   }
 
   return Object::getProperty(name, type, ptr, flags);
 }
 
-void World::commit()
+void World::commitObject()
 {
   cleanup();
 
@@ -145,6 +220,11 @@ void World::commit()
   m_zeroInstance->commit();
 
   m_instanceData = getParamObject<ObjectArray>("instance");
+  m_combinedTLAS = getParam<bool>("combinedTLAS", false);
+  m_mergeSmallGroups = getParam<bool>("mergeSmallGroups", false);
+  m_asyncBVHBuild = getParam<bool>("asyncBVHBuild", false);
+  m_mergeSettings.primitiveThreshold =
+      getParam<uint32_t>("mergeSmallGroupsThreshold", 1024);
 
   m_instances.reset();
 
@@ -172,209 +252,623 @@ void World::commit()
 
 OptixTraversableHandle World::optixTraversableHandleSurfaces() const
 {
-  return m_traversableSurfaces;
+  return m_tlas->traversableSurfaces;
 }
 
 OptixTraversableHandle World::optixTraversableHandleVolumes() const
 {
-  return m_traversableVolumes;
+  return m_tlas->traversableVolumes;
 }
 
 Span<InstanceSurfaceGPUData> World::instanceSurfaceGPUData() const
 {
-  return m_instanceSurfaceGPUData.deviceSpan();
+  return m_tlas->instanceSurfaceGPUData.deviceSpan();
 }
 
 Span<InstanceVolumeGPUData> World::instanceVolumeGPUData() const
 {
-  return m_instanceVolumeGPUData.deviceSpan();
+  return m_tlas->instanceVolumeGPUData.deviceSpan();
 }
 
 Span<InstanceLightGPUData> World::instanceLightGPUData() const
 {
-  return m_instanceLightGPUData.deviceSpan();
+  return m_tlas->instanceLightGPUData.deviceSpan();
+}
+
+void World::populateFrameData(FrameGPUData &fd) const
+{
+  auto &state = *deviceState();
+
+  fd.world.surfaceInstances = instanceSurfaceGPUData().data();
+  fd.world.numSurfaceInstances = instanceSurfaceGPUData().size();
+  fd.world.surfacesTraversable = optixTraversableHandleSurfaces();
+
+  fd.world.volumeInstances = instanceVolumeGPUData().data();
+  fd.world.numVolumeInstances = instanceVolumeGPUData().size();
+  fd.world.volumesTraversable = optixTraversableHandleVolumes();
+
+  fd.world.lightInstances = instanceLightGPUData().data();
+  fd.world.numLightInstances = instanceLightGPUData().size();
+
+  fd.world.bounds = m_tlas->surfaceBounds;
+  fd.world.bounds.extend(m_tlas->volumeBounds);
+
+  fd.registry.samplers = state.registry.samplers.devicePtr();
+  fd.registry.geometries = state.registry.geometries.devicePtr();
+  fd.registry.materials = state.registry.materials.devicePtr();
+  fd.registry.surfaces = state.registry.surfaces.devicePtr();
+  fd.registry.lights = state.registry.lights.devicePtr();
+  fd.registry.fields = state.registry.fields.devicePtr();
+  fd.registry.volumes = state.registry.volumes.devicePtr();
 }
 
 void World::rebuildBVHs()
 {
   const auto &state = *deviceState();
 
-  if (state.objectUpdates.lastBLASChange >= m_objectUpdates.lastBLASCheck) {
-    m_objectUpdates.lastTLASBuild = 0; // BLAS changed, so need to build TLAS
-    rebuildBLASs();
-  }
+  swapAsyncTLAS();
 
-  if (state.objectUpdates.lastTLASChange < m_objectUpdates.lastTLASBuild)
+  const bool blasChanged =
+      state.objectUpdates.lastBLASChange >= m_objectUpdates.lastBLASCheck;
+  const bool tlasChanged = blasChanged
+      || state.objectUpdates.lastTLASChange >= m_objectUpdates.lastTLASBuild;
+  const bool transformsChanged =
+      state.objectUpdates.lastTransformChange >= m_objectUpdates.lastTLASUpdate;
+
+  if (!tlasChanged && !transformsChanged)
+    return;
+
+  m_tlasVersions.markChanged();
+
+  // Instance bookkeeping and the BLASs being built belong to the TLAS being
+  // built until it is swapped in, so further changes wait for the next build
+  if (m_tlasVersions.building())
     return;
 
-  m_surfaceBounds = box3();
-  m_volumeBounds = box3();
-  m_traversableSurfaces = {};
-  m_traversableVolumes = {};
+  if (!tlasChanged && updateOptixInstanceTransforms()) {
+    m_tlasVersions.endBuild(m_tlasVersions.beginBuild());
+    m_tlasVersions.swap();
+    m_objectUpdates.lastTLASUpdate = helium::newTimeStamp();
+    return;
+  }
+
+  // Groups replace their BLASs when rebuilding, so the current TLAS keeps
+  // rendering with the previous ones
+  std::vector<BVHBuildRequest> requests;
+  if (blasChanged) {
+    m_mergedBLASCache.clear();
+    queueBLASRebuilds(requests);
+  }
+
+  std::for_each(m_instances.begin(), m_instances.end(), [](auto *inst) {
+    inst->group()->updateOpacity();
+  });
+
+  auto tlas = std::make_unique<TLASData>();
+
+  buildMergedBLASs(*tlas, requests);
+
+  const bool async = m_asyncBVHBuild && m_tlasVersions.currentVersion() != 0
+      && m_instances.size() >= ASYNC_TLAS_MIN_INSTANCES;
+
+  if (!async)
+    buildOptixBVHs(requests, this);
 
-  populateOptixInstances();
   reportMessage(ANARI_SEVERITY_DEBUG,
-      "visrtx::World building surface BVH over %zu instances",
-      m_optixSurfaceInstances.size());
-  buildOptixBVH(createOBI(m_optixSurfaceInstances),
-      m_bvhSurfaces,
-      m_traversableSurfaces,
-      m_surfaceBounds,
-      this);
-  reportMessage(
-      ANARI_SEVERITY_DEBUG, "visrtx::World building surface gpu data");
-  buildInstanceSurfaceGPUData();
+      "visrtx::World populating instance data over %zu instances",
+      m_instances.size());
+  populateOptixInstances(*tlas);
+  buildInstanceLightGPUData(*tlas);
+  prepareTLAS(*tlas);
+
+  trackInstanceTransforms();
+  m_objectUpdates.lastTLASBuild = helium::newTimeStamp();
+  m_objectUpdates.lastTLASUpdate = m_objectUpdates.lastTLASBuild;
+
+  const auto version = m_tlasVersions.beginBuild();
+
+  if (!async) {
+    reportMessage(ANARI_SEVERITY_DEBUG,
+        "visrtx::World building TLAS over %zu instances",
+        m_instances.size());
+    buildTLAS(*tlas, state.stream);
+    m_tlas = std::move(tlas);
+    m_tlasVersions.endBuild(version);
+    m_tlasVersions.swap();
+    return;
+  }
 
   reportMessage(ANARI_SEVERITY_DEBUG,
-      "visrtx::World building volume BVH over %zu instances",
-      m_optixVolumeInstances.size());
-  buildOptixBVH(createOBI(m_optixVolumeInstances),
-      m_bvhVolumes,
-      m_traversableVolumes,
-      m_volumeBounds,
-      this);
-  reportMessage(ANARI_SEVERITY_DEBUG, "visrtx::World building volume gpu data");
-  buildInstanceVolumeGPUData();
+      "visrtx::World building TLAS over %zu instances and %zu BLASs"
+      " in the background",
+      m_instances.size(),
+      requests.size());
+
+  if (!m_asyncStream)
+    cudaStreamCreateWithFlags(&m_asyncStream, cudaStreamNonBlocking);
+
+  // Build inputs point into geometries and volumes, which may change while
+  // building in the background, so only compaction is left to that thread
+  tlas->blasBuilds = std::move(requests);
+  issueOptixBVHBuilds(
+      tlas->blasBuilds, tlas->issuedBLASBuilds, this, m_asyncStream);
+
+  // Frames keep using the current TLAS, so the new one holds on to its
+  // instances until it is swapped in and retired
+  tlas->instances.reserve(m_instances.size());
+  for (auto *inst : m_instances)
+    tlas->instances.emplace_back(inst);
+
+  int cudaDevice = 0;
+  cudaGetDevice(&cudaDevice);
+
+  m_nextTLAS = std::move(tlas);
+  m_asyncTLASVersion = version;
+  m_asyncTLASBuild = std::async(
+      std::launch::async, [this, cudaDevice, t = m_nextTLAS.get()]() {
+        cudaSetDevice(cudaDevice);
+        buildTLAS(*t, m_asyncStream);
+      });
+}
 
-  buildInstanceLightGPUData();
+bool World::bvhIsStale() const
+{
+  return m_tlasVersions.stale();
+}
 
-  m_objectUpdates.lastTLASBuild = helium::newTimeStamp();
+uint64_t World::bvhVersion() const
+{
+  return m_tlasVersions.currentVersion();
 }
 
-void World::populateOptixInstances()
+void World::buildMergedBLASs(
+    TLASData &tlas, std::vector<BVHBuildRequest> &requests)
 {
-  m_numTriangleInstances = 0;
-  m_numCurveInstances = 0;
-  m_numUserInstances = 0;
-  m_numVolumeInstances = 0;
-  m_numLightInstances = 0;
+  m_instanceMerged.assign(m_instances.size(), 0);
 
-  std::for_each(m_instances.begin(), m_instances.end(), [&](auto *inst) {
+  if (!m_mergeSmallGroups) {
+    m_mergedBLASCache.clear();
+    return;
+  }
+
+  // Only instances whose transform stayed put since the last TLAS update are
+  // merged, so animated instances can still be refit individually
+  const auto lastUpdate = m_objectUpdates.lastTLASUpdate;
+
+  std::map<BLASMergeKey, uint32_t> classes;
+  std::vector<BLASMergeKey> classKeys;
+  std::vector<BLASMergeCandidate> candidates;
+
+  for (size_t i = 0; i < m_instances.size(); i++) {
+    auto *inst = m_instances[i];
     auto *group = inst->group();
-    if (group->containsTriangleGeometry())
-      m_numTriangleInstances++;
-    if (group->containsCurveGeometry())
-      m_numCurveInstances++;
-    if (group->containsUserGeometry())
-      m_numUserInstances++;
-    if (group->containsVolumes())
-      m_numVolumeInstances++;
-    if (group->containsLights())
-      m_numLightInstances++;
-  });
 
-  m_optixSurfaceInstances.resize(
-      m_numTriangleInstances + m_numCurveInstances + m_numUserInstances);
-  m_optixVolumeInstances.resize(m_numVolumeInstances);
+    const bool isStatic =
+        lastUpdate == 0 || inst->lastTransformChange() < lastUpdate;
+    const int numKinds = int(group->containsTriangleGeometry())
+        + int(group->containsCurveGeometry())
+        + int(group->containsUserGeometry());
 
-  auto prepInstance =
-      [](auto &i, int instID, auto handle, int sbtOffset) -> OptixInstance {
-    OptixInstance inst{};
+    if (!isStatic || numKinds != 1 || group->containsVolumes()
+        || inst->numTransforms() != 1 || inst->attributesGPU() != nullptr)
+      continue;
 
-    mat3x4 xfm = glm::transpose(i->xfm());
-    std::memcpy(inst.transform, &xfm, sizeof(xfm));
+    BLASMergeKey key{};
+    key.xfm = inst->xfm(0);
+    key.visibilityMask = inst->visibilityMask();
+    if (group->containsTriangleGeometry()) {
+      key.sbtOffset = SBT_TRIANGLE_OFFSET;
+      key.opaque = group->trianglesOpaque();
+    } else if (group->containsCurveGeometry()) {
+      key.sbtOffset = SBT_CURVE_OFFSET;
+      key.opaque = group->curvesOpaque();
+    } else {
+      key.sbtOffset = SBT_CUSTOM_OFFSET;
+      key.opaque = group->userOpaque();
+    }
 
-    auto *group = i->group();
-    inst.traversableHandle = handle;
-    inst.flags = OPTIX_INSTANCE_FLAG_NONE;
-    inst.instanceId = instID;
-    inst.sbtOffset = sbtOffset;
-    inst.visibilityMask = 1;
+    auto c = classes.try_emplace(key, uint32_t(classKeys.size()));
+    if (c.second)
+      classKeys.push_back(key);
 
-    return inst;
-  };
+    candidates.push_back({uint32_t(i),
+        c.first->second,
+        group->numSurfacePrimitives(),
+        uint32_t(surfacesWithOffset(group, key.sbtOffset).size())});
+  }
 
-  int instID = 0;
-  int instVolID = 0;
-  std::for_each(m_instances.begin(), m_instances.end(), [&](auto *inst) {
+  decltype(m_mergedBLASCache) cache;
+  const size_t numRequests = requests.size();
+  for (auto &batch : planBLASMerges(std::move(candidates), m_mergeSettings)) {
+    const auto &key = classKeys[batch.mergeClass];
+
+    std::vector<Surface *> members;
+    std::vector<DeviceObjectIndex> surfaces;
+    std::vector<uint32_t> ids;
+    members.reserve(batch.numSurfaces());
+    surfaces.reserve(batch.numSurfaces());
+    ids.reserve(batch.numSurfaces());
+
+    for (auto i : batch.instances) {
+      auto *inst = m_instances[i];
+      for (auto *s : surfacesWithOffset(inst->group(), key.sbtOffset)) {
+        members.push_back(s);
+        surfaces.push_back(s->index());
+        ids.push_back(inst->userID());
+      }
+      m_instanceMerged[i] = 1;
+    }
+
+    MergedBLASSignature signature(key, std::move(surfaces), std::move(ids));
+    auto cached = m_mergedBLASCache.find(signature);
+    if (cached != m_mergedBLASCache.end()) {
+      tlas.mergedBLASs.push_back(cached->second);
+      cache.insert(m_mergedBLASCache.extract(cached));
+      continue;
+    }
+
+    auto mb = std::make_shared<MergedBLAS>();
+    mb->key = key;
+
+    // Each surface stays its own build input, so optixGetSbtGASIndex() indexes
+    // the merged surface and id lists
+    std::vector<OptixBuildInput> buildInputs;
+    buildInputs.reserve(members.size());
+    for (auto *s : members)
+      buildInputs.push_back(s->buildInput());
+
+    requests.push_back(
+        {std::move(buildInputs), &mb->bvh, &mb->traversable, &mb->bounds});
+    mb->surfaces.upload(std::get<1>(signature));
+    mb->ids.upload(std::get<2>(signature));
+
+    tlas.mergedBLASs.push_back(mb);
+    cache.emplace(std::move(signature), std::move(mb));
+  }
+
+  // Entries not used by this TLAS are dropped
+  m_mergedBLASCache = std::move(cache);
+
+  reportMessage(ANARI_SEVERITY_DEBUG,
+      "visrtx::World merged %zu small groups into %zu BLASs (%zu rebuilt)",
+      size_t(std::count(
+          m_instanceMerged.begin(), m_instanceMerged.end(), uint8_t(1))),
+      tlas.mergedBLASs.size(),
+      requests.size() - numRequests);
+}
+
+void World::populateOptixInstances(TLASData &tlas)
+{
+  const size_t numInstances = m_instances.size();
+
+  // Count the OptiX instance records each instance needs, then turn the
+  // counts into offsets so every instance can be written independently
+  const auto totals = layoutInstanceRecords(
+      numInstances,
+      [&](size_t i) {
+        auto *inst = m_instances[i];
+        auto *group = inst->group();
+        InstanceRecordCounts c;
+        c.numTransforms = uint32_t(inst->numTransforms());
+        c.numSurfaceKinds = uint32_t(group->containsTriangleGeometry())
+            + uint32_t(group->containsCurveGeometry())
+            + uint32_t(group->containsUserGeometry());
+        c.hasVolumes = group->containsVolumes();
+        c.merged = m_instanceMerged[i] != 0;
+        return c;
+      },
+      m_surfaceInstanceOffsets,
+      m_volumeInstanceOffsets);
+
+  m_mergedRecordBase = totals.numSurfaceRecords;
+  m_numSurfaceInstances = m_mergedRecordBase + tlas.mergedBLASs.size();
+  m_numVolumeInstances = totals.numVolumeRecords;
+
+  // A combined TLAS stores volume records after all the surface records,
+  // relying on visibility masks to keep surface and volume rays apart
+  tlas.combined = m_combinedTLAS;
+  m_volumeRecordBase = tlas.combined ? m_numSurfaceInstances : 0;
+  if (tlas.combined) {
+    tlas.optixSurfaceInstances.resize(
+        m_numSurfaceInstances + m_numVolumeInstances);
+    tlas.optixVolumeInstances.clear();
+  } else {
+    tlas.optixSurfaceInstances.resize(m_numSurfaceInstances);
+    tlas.optixVolumeInstances.resize(m_numVolumeInstances);
+  }
+
+  tlas.instanceSurfaceGPUData.resize(m_numSurfaceInstances);
+  tlas.instanceVolumeGPUData.resize(m_numVolumeInstances);
+  tlas.surfaceRecordBLASs.resize(m_numSurfaceInstances);
+  tlas.volumeRecordBLASs.resize(m_numVolumeInstances);
+  tlas.instanceAttributes.resize(numInstances);
+
+  parallelFor(
+      numInstances, [&](size_t i) { writeInstanceRecords(tlas, i); });
+
+  std::unordered_set<const Group *> groups;
+  for (auto *inst : m_instances) {
     auto *group = inst->group();
-    auto *osi = m_optixSurfaceInstances.dataHost();
-    auto *ovi = m_optixVolumeInstances.dataHost();
-    if (group->containsTriangleGeometry()) {
-      osi[instID] = prepInstance(
-          inst, instID, group->optixTraversableTriangle(), SBT_TRIANGLE_OFFSET);
+    if (groups.insert(group).second) {
+      tlas.groupData.push_back(group->surfaceBLAS());
+      tlas.groupData.push_back(group->volumeBLAS());
+    }
+  }
+
+  auto *osi = tlas.optixSurfaceInstances.dataHost();
+  auto *sd = tlas.instanceSurfaceGPUData.dataHost();
+  for (size_t m = 0; m < tlas.mergedBLASs.size(); m++) {
+    const auto &mb = *tlas.mergedBLASs[m];
+    const auto instID = uint32_t(m_mergedRecordBase + m);
+    osi[instID] = makeOptixInstance(mb.key.xfm,
+        instID,
+        mb.traversable,
+        mb.key.sbtOffset,
+        mb.key.visibilityMask,
+        mb.key.opaque);
+    tlas.surfaceRecordBLASs[instID] = &mb.traversable;
+    sd[instID] = {(const DeviceObjectIndex *)mb.surfaces.ptr(),
+        ~0u,
+        0,
+        nullptr,
+        (const uint32_t *)mb.ids.ptr()};
+  }
+}
+
+void World::prepareTLAS(TLASData &tlas)
+{
+  prepareOptixBVH(createOBI(tlas.optixSurfaceInstances),
+      tlas.surfaceBuild,
+      tlas.bvhSurfaces,
+      this);
+  if (!tlas.combined) {
+    prepareOptixBVH(createOBI(tlas.optixVolumeInstances),
+        tlas.volumeBuild,
+        tlas.bvhVolumes,
+        this);
+  }
+}
+
+void World::buildTLAS(TLASData &tlas, CUstream stream)
+{
+  // Records were written before their BLASs were built
+  if (!tlas.blasBuilds.empty()) {
+    compactOptixBVHs(tlas.issuedBLASBuilds, this, stream);
+
+    auto *osi = tlas.optixSurfaceInstances.dataHost();
+    for (size_t i = 0; i < tlas.surfaceRecordBLASs.size(); i++)
+      osi[i].traversableHandle = *tlas.surfaceRecordBLASs[i];
+
+    auto *ovi = optixVolumeInstanceRecords(tlas).dataHost()
+        + (tlas.combined ? tlas.surfaceRecordBLASs.size() : 0);
+    for (size_t i = 0; i < tlas.volumeRecordBLASs.size(); i++)
+      ovi[i].traversableHandle = *tlas.volumeRecordBLASs[i];
+  }
+
+  tlas.optixSurfaceInstances.uploadAsync(stream);
+  tlas.optixVolumeInstances.uploadAsync(stream);
+  tlas.instanceSurfaceGPUData.uploadAsync(stream);
+  tlas.instanceVolumeGPUData.uploadAsync(stream);
+  tlas.instanceLightGPUData.uploadAsync(stream);
+
+  buildPreparedOptixBVH(tlas.surfaceBuild,
+      tlas.bvhSurfaces,
+      tlas.traversableSurfaces,
+      tlas.surfaceBounds,
+      this,
+      stream);
+
+  if (tlas.combined) {
+    tlas.bvhVolumes.reset();
+    tlas.traversableVolumes = tlas.traversableSurfaces;
+  } else {
+    buildPreparedOptixBVH(tlas.volumeBuild,
+        tlas.bvhVolumes,
+        tlas.traversableVolumes,
+        tlas.volumeBounds,
+        this,
+        stream);
+  }
+}
+
+void World::writeInstanceRecords(TLASData &tlas, size_t i)
+{
+  // Surfaces of merged instances are written with their shared BLAS, and
+  // merged instances never contain volumes
+  if (m_instanceMerged[i])
+    return;
+
+  auto *inst = m_instances[i];
+  auto *group = inst->group();
+
+  auto *osi = tlas.optixSurfaceInstances.dataHost();
+  auto *ovi = optixVolumeInstanceRecords(tlas).dataHost() + m_volumeRecordBase;
+  auto *sd = tlas.instanceSurfaceGPUData.dataHost();
+  auto *vd = tlas.instanceVolumeGPUData.dataHost();
+
+  const uint32_t surfaceMask = inst->visibilityMask();
+  const uint32_t volumeMask = surfaceMask << VISIBILITY_MASK_VOLUME_SHIFT;
+  const auto *attr = inst->attributesGPU();
+  tlas.instanceAttributes[i] = inst->attributesGPUOwner();
+
+  uint32_t instID = m_surfaceInstanceOffsets[i];
+  uint32_t instVolID = m_volumeInstanceOffsets[i];
+
+  // Records of each element of an instance transform array are contiguous
+  for (uint32_t t = 0; t < inst->numTransforms(); t++) {
+    const mat4x3 xfm = inst->xfm(t);
+    const uint32_t id = inst->userID(t);
+
+    auto addSurfaces = [&](const OptixTraversableHandle &handle,
+                           uint32_t sbtOffset,
+                           Span<DeviceObjectIndex> surfaces,
+                           bool opaque) {
+      osi[instID] = makeOptixInstance(
+          xfm, instID, handle, sbtOffset, surfaceMask, opaque);
+      tlas.surfaceRecordBLASs[instID] = &handle;
+      sd[instID] = {surfaces.data(), id, t, attr};
       instID++;
+    };
+
+    if (group->containsTriangleGeometry()) {
+      addSurfaces(group->optixTraversableTriangle(),
+          SBT_TRIANGLE_OFFSET,
+          group->surfaceTriangleGPUIndices(),
+          group->trianglesOpaque());
     }
     if (group->containsCurveGeometry()) {
-      osi[instID] = prepInstance(
-          inst, instID, group->optixTraversableCurve(), SBT_CURVE_OFFSET);
-      instID++;
+      addSurfaces(group->optixTraversableCurve(),
+          SBT_CURVE_OFFSET,
+          group->surfaceCurveGPUIndices(),
+          group->curvesOpaque());
     }
     if (group->containsUserGeometry()) {
-      osi[instID] = prepInstance(
-          inst, instID, group->optixTraversableUser(), SBT_CUSTOM_OFFSET);
-      instID++;
+      addSurfaces(group->optixTraversableUser(),
+          SBT_CUSTOM_OFFSET,
+          group->surfaceUserGPUIndices(),
+          group->userOpaque());
     }
     if (group->containsVolumes()) {
-      ovi[instVolID] = prepInstance(
-          inst, instVolID, group->optixTraversableVolume(), SBT_CUSTOM_OFFSET);
+      ovi[instVolID] = makeOptixInstance(xfm,
+          instVolID,
+          group->optixTraversableVolume(),
+          SBT_CUSTOM_OFFSET,
+          volumeMask);
+      tlas.volumeRecordBLASs[instVolID] = &group->optixTraversableVolume();
+      vd[instVolID] = {group->volumeGPUIndices().data(), id};
       instVolID++;
     }
-  });
-
-  m_optixSurfaceInstances.upload();
-  m_optixVolumeInstances.upload();
+  }
 }
 
-void World::rebuildBLASs()
+bool World::updateOptixInstanceTransforms()
 {
-  reportMessage(ANARI_SEVERITY_DEBUG, "visrtx::World rebuilding BLASs");
+  auto &tlas = *m_tlas;
 
-  std::for_each(m_instances.begin(), m_instances.end(), [&](auto *inst) {
-    auto *group = inst->group();
-    group->rebuildSurfaceBVHs();
-    group->rebuildVolumeBVH();
-    group->rebuildLights();
-  });
+  if (m_transformUpdates.numInstances() != m_instances.size()
+      || (!tlas.bvhSurfaces && !tlas.bvhVolumes))
+    return false;
 
-  m_objectUpdates.lastBLASCheck = helium::newTimeStamp();
+  const auto &dirty = m_transformUpdates.dirtyInstances();
+  const bool movedMergedInstance =
+      std::any_of(dirty.begin(), dirty.end(), [&](size_t i) {
+        return m_instanceMerged[i] != 0;
+      });
+
+  if (m_transformUpdates.empty())
+    return true;
+  else if (m_transformUpdates.needsRebuild() || movedMergedInstance)
+    return false;
+
+  reportMessage(ANARI_SEVERITY_DEBUG,
+      "visrtx::World updating %zu instance transforms",
+      m_transformUpdates.numDirty());
+
+  for (auto i : m_transformUpdates.dirtyInstances())
+    writeInstanceRecords(tlas, i);
+
+  // Coalesce nearby instances to avoid many tiny copies
+  constexpr size_t maxUploadGap = 64;
+  auto &volumeRecords = optixVolumeInstanceRecords(tlas);
+  for (auto &r : m_transformUpdates.dirtyRanges(maxUploadGap)) {
+    const auto sBegin = m_surfaceInstanceOffsets[r.begin];
+    const auto sEnd = m_surfaceInstanceOffsets[r.end];
+    const auto vBegin = m_volumeInstanceOffsets[r.begin];
+    const auto vEnd = m_volumeInstanceOffsets[r.end];
+    tlas.optixSurfaceInstances.upload(sBegin, sEnd);
+    tlas.instanceSurfaceGPUData.upload(sBegin, sEnd);
+    volumeRecords.upload(
+        m_volumeRecordBase + vBegin, m_volumeRecordBase + vEnd);
+    tlas.instanceVolumeGPUData.upload(vBegin, vEnd);
+  }
+
+  updateOptixBVH(createOBI(tlas.optixSurfaceInstances),
+      tlas.bvhSurfaces,
+      m_tlasUpdateScratch,
+      tlas.traversableSurfaces,
+      tlas.surfaceBounds,
+      this);
+  updateOptixBVH(createOBI(tlas.optixVolumeInstances),
+      tlas.bvhVolumes,
+      m_tlasUpdateScratch,
+      tlas.traversableVolumes,
+      tlas.volumeBounds,
+      this);
+  if (tlas.combined)
+    tlas.traversableVolumes = tlas.traversableSurfaces;
+
+  m_transformUpdates.markUpdated();
+  return true;
 }
 
-void World::buildInstanceSurfaceGPUData()
+void World::trackInstanceTransforms()
 {
-  m_instanceSurfaceGPUData.resize(
-      m_numTriangleInstances + m_numCurveInstances + m_numUserInstances);
+  untrackInstanceTransforms();
 
-  int instID = 0;
-  std::for_each(m_instances.begin(), m_instances.end(), [&](auto *inst) {
-    auto *group = inst->group();
-    auto *sd = m_instanceSurfaceGPUData.dataHost();
-    auto id = inst->userID();
-    if (group->containsTriangleGeometry())
-      sd[instID++] = {group->surfaceTriangleGPUIndices().data(), id};
-    if (group->containsCurveGeometry())
-      sd[instID++] = {group->surfaceCurveGPUIndices().data(), id};
-    if (group->containsUserGeometry())
-      sd[instID++] = {group->surfaceUserGPUIndices().data(), id};
-  });
+  m_transformUpdates.reset(m_instances.size());
+  m_trackedInstances.reserve(m_instances.size());
+  for (size_t i = 0; i < m_instances.size(); i++) {
+    m_instances[i]->addTransformTracker(&m_transformUpdates, i);
+    m_trackedInstances.emplace_back(m_instances[i]);
+  }
+}
 
-  m_instanceSurfaceGPUData.upload();
+void World::untrackInstanceTransforms()
+{
+  // Instances listed more than once are removed on their first entry
+  for (auto &inst : m_trackedInstances)
+    inst->removeTransformTracker(&m_transformUpdates);
+  m_trackedInstances.clear();
 }
 
-void World::buildInstanceVolumeGPUData()
+HostDeviceArray<OptixInstance> &World::optixVolumeInstanceRecords(
+    TLASData &tlas)
 {
-  m_instanceVolumeGPUData.resize(m_numVolumeInstances);
+  return tlas.combined ? tlas.optixSurfaceInstances
+                        : tlas.optixVolumeInstances;
+}
 
-  int instID = 0;
-  std::for_each(m_instances.begin(), m_instances.end(), [&](auto *inst) {
-    auto *group = inst->group();
-    auto *vd = m_instanceVolumeGPUData.dataHost();
-    auto id = inst->userID();
-    if (group->containsVolumes())
-      vd[instID++] = {group->volumeGPUIndices().data(), id};
-  });
+void World::queueBLASRebuilds(std::vector<BVHBuildRequest> &requests)
+{
+  reportMessage(ANARI_SEVERITY_DEBUG, "visrtx::World rebuilding BLASs");
+
+  // Groups shared by many instances only need to be built once
+  std::vector<Group *> groups;
+  std::unordered_set<Group *> seen;
+  for (auto *inst : m_instances) {
+    if (seen.insert(inst->group()).second)
+      groups.push_back(inst->group());
+  }
+
+  for (auto *group : groups) {
+    group->queueSurfaceBVHBuilds(requests);
+    group->queueVolumeBVHBuild(requests);
+  }
+
+  // Group GPU data doesn't depend on the BLASs themselves
+  for (auto *group : groups) {
+    group->finishSurfaceBVHBuilds();
+    group->finishVolumeBVHBuild();
+    group->rebuildLights();
+  }
 
-  m_instanceVolumeGPUData.upload();
+  m_objectUpdates.lastBLASCheck = helium::newTimeStamp();
 }
 
-void World::buildInstanceLightGPUData()
+void World::buildInstanceLightGPUData(TLASData &tlas)
 {
-  m_instanceLightGPUData.resize(m_numLightInstances);
+  // Lights stay serial: rebuilding a group's lights mutates the group, which
+  // may be shared by many instances
+  const size_t numLightInstances =
+      std::count_if(m_instances.begin(), m_instances.end(), [](auto *inst) {
+        return inst->group()->containsLights();
+      });
+  tlas.instanceLightGPUData.resize(numLightInstances);
 
   int instID = 0;
   std::for_each(m_instances.begin(), m_instances.end(), [&](auto *inst) {
     auto *group = inst->group();
-    auto *li = m_instanceLightGPUData.dataHost();
+    auto *li = tlas.instanceLightGPUData.dataHost();
     if (group->containsLights()) {
       group->rebuildLights();
       const auto lgi = group->lightGPUIndices();
@@ -383,10 +877,134 @@ void World::buildInstanceLightGPUData()
             ANARI_SEVERITY_WARNING, "light transformations not implemented");
       }
       li[instID++] = {lgi.data(), lgi.size()};
+      tlas.groupData.push_back(group->lightGPUData());
     }
   });
+}
+
+bool World::swapAsyncTLAS()
+{
+  if (!m_asyncTLASBuild.valid()
+      || m_asyncTLASBuild.wait_for(std::chrono::seconds(0))
+          != std::future_status::ready)
+    return false;
+
+  m_asyncTLASBuild.get();
+  m_tlasVersions.endBuild(m_asyncTLASVersion);
+  if (!m_tlasVersions.swap())
+    return false;
+
+  // Frames are done with the old TLAS once the next one starts rendering
+  m_tlas = std::move(m_nextTLAS);
+  return true;
+}
+
+void World::waitForAsyncTLAS()
+{
+  if (!m_asyncTLASBuild.valid())
+    return;
+
+  m_asyncTLASBuild.get();
+  m_nextTLAS.reset();
+  m_tlasVersions.cancelBuild();
+}
+
+void World::updateForQuery()
+{
+  auto &state = *deviceState();
+  state.flushCommits();
+  state.uploadBuffer.flush();
+  rebuildBVHs();
+  if (m_asyncTLASBuild.valid()) {
+    m_asyncTLASBuild.wait();
+    swapAsyncTLAS();
+  }
+}
+
+bool World::traceRays()
+{
+  auto *rays = getParam<void *>("rayQuery.rays", nullptr);
+  auto *hits = getParam<void *>("rayQuery.hits", nullptr);
+  const auto numRays = getParam<uint64_t>("rayQuery.count", 0);
+
+  if (!rays || !hits) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "missing required parameters 'rayQuery.rays' and 'rayQuery.hits'"
+        " for world ray query");
+    return false;
+  }
+
+  if (numRays == 0)
+    return true;
+
+  auto &state = *deviceState();
+
+  updateForQuery();
+
+  if (!m_rayQuery) {
+    m_rayQuery = new RayQuery(&state);
+    m_rayQuery->refDec(helium::RefType::PUBLIC); // never any public ref
+  }
+
+  FrameGPUData fd{};
+  populateFrameData(fd);
+  fd.rayQuery.terminateOnFirstHit = getParam<bool>("rayQuery.anyHit", false);
+
+  // Buffers in host memory are staged through the device in smaller batches
+  const bool raysOnDevice = isDevicePointer(rays);
+  const bool hitsOnDevice = isDevicePointer(hits);
+  const size_t maxLaunchSize = size_t(1) << 30;
+  const size_t maxStagedRays = size_t(1) << 22;
+  const size_t batchSize =
+      raysOnDevice && hitsOnDevice ? maxLaunchSize : maxStagedRays;
+
+  reportMessage(ANARI_SEVERITY_DEBUG,
+      "tracing %zu query rays (rays on %s, hits on %s)",
+      size_t(numRays),
+      raysOnDevice ? "device" : "host",
+      hitsOnDevice ? "device" : "host");
+
+  const auto *sbt = m_rayQuery->sbt(); // creates the pipeline if needed
+
+  for (const auto &batch : splitRange(numRays, batchSize)) {
+    const size_t count = batch.end - batch.begin;
+
+    auto *batchRays = (const RayQueryRay *)rays + batch.begin;
+    auto *batchHits = (RayQueryHit *)hits + batch.begin;
+
+    if (raysOnDevice)
+      fd.rayQuery.rays = batchRays;
+    else {
+      m_rayQueryRays.upload(batchRays, count);
+      fd.rayQuery.rays = (const RayQueryRay *)m_rayQueryRays.ptr();
+    }
+
+    if (hitsOnDevice)
+      fd.rayQuery.hits = batchHits;
+    else {
+      m_rayQueryHits.reserve(count * sizeof(RayQueryHit));
+      fd.rayQuery.hits = (RayQueryHit *)m_rayQueryHits.ptr();
+    }
+
+    fd.rayQuery.count = uint32_t(count);
+    m_rayQueryFrameData.upload(&fd);
+
+    OPTIX_CHECK_OBJECT(optixLaunch(m_rayQuery->pipeline(),
+                           state.stream,
+                           (CUdeviceptr)m_rayQueryFrameData.ptr(),
+                           sizeof(FrameGPUData),
+                           sbt,
+                           count,
+                           1,
+                           1),
+        this);
+    CUDA_STREAM_SYNC_CHECK_OBJECT(state.stream, this);
+
+    if (!hitsOnDevice)
+      m_rayQueryHits.download(batchHits, count);
+  }
 
-  m_instanceLightGPUData.upload();
+  return true;
 }
 
 void World::cleanup()
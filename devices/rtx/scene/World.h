@@ -32,7 +32,19 @@
 #pragma once
 
 #include "Instance.h"
+#include "renderer/RayQuery.h"
+#include "utility/BLASMergePlanner.h"
+#include "utility/BVHVersionTracker.h"
 #include "utility/HostDeviceArray.h"
+#include "utility/InstanceRecordLayout.h"
+#include "utility/Parallel.h"
+#include "utility/TransformUpdateTracker.h"
+// std
+#include <future>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
 
 namespace visrtx {
 
@@ -50,7 +62,7 @@ struct World : public Object
       void *ptr,
       uint32_t flags) override;
 
-  void commit() override;
+  void commitObject() override;
 
   OptixTraversableHandle optixTraversableHandleSurfaces() const;
   OptixTraversableHandle optixTraversableHandleVolumes() const;
@@ -59,14 +71,34 @@ struct World : public Object
   Span<InstanceVolumeGPUData> instanceVolumeGPUData() const;
   Span<InstanceLightGPUData> instanceLightGPUData() const;
 
+  // Fill in the world and object registry of frame data for launches
+  void populateFrameData(FrameGPUData &fd) const;
+
   void rebuildBVHs();
 
+  // Whether the BVHs in use are older than the current scene
+  bool bvhIsStale() const;
+  uint64_t bvhVersion() const;
+
  private:
-  void populateOptixInstances();
-  void rebuildBLASs();
-  void buildInstanceSurfaceGPUData();
-  void buildInstanceVolumeGPUData();
-  void buildInstanceLightGPUData();
+  struct TLASData;
+
+  void queueBLASRebuilds(std::vector<BVHBuildRequest> &requests);
+  void buildMergedBLASs(
+      TLASData &tlas, std::vector<BVHBuildRequest> &requests);
+  void populateOptixInstances(TLASData &tlas);
+  void writeInstanceRecords(TLASData &tlas, size_t instanceIndex);
+  void prepareTLAS(TLASData &tlas);
+  void buildTLAS(TLASData &tlas, CUstream stream);
+  bool updateOptixInstanceTransforms();
+  void trackInstanceTransforms();
+  void untrackInstanceTransforms();
+  HostDeviceArray<OptixInstance> &optixVolumeInstanceRecords(TLASData &tlas);
+  void buildInstanceLightGPUData(TLASData &tlas);
+  bool swapAsyncTLAS();
+  void waitForAsyncTLAS();
+  void updateForQuery();
+  bool traceRays();
   void cleanup();
 
   helium::IntrusivePtr<ObjectArray> m_zeroSurfaceData;
@@ -77,43 +109,135 @@ struct World : public Object
   Span<Instance *> m_instances;
 
   bool m_addZeroInstance{false};
+  bool m_combinedTLAS{false};
+  bool m_mergeSmallGroups{false};
+  bool m_asyncBVHBuild{false};
   helium::IntrusivePtr<Group> m_zeroGroup;
   helium::IntrusivePtr<Instance> m_zeroInstance;
 
-  size_t m_numTriangleInstances{0};
-  size_t m_numCurveInstances{0};
-  size_t m_numUserInstances{0};
+  size_t m_numSurfaceInstances{0};
   size_t m_numVolumeInstances{0};
-  size_t m_numLightInstances{0};
-
-  box3 m_surfaceBounds;
-  box3 m_volumeBounds;
 
   struct ObjectUpdates
   {
     helium::TimeStamp lastTLASBuild{0};
+    helium::TimeStamp lastTLASUpdate{0};
     helium::TimeStamp lastBLASCheck{0};
   } m_objectUpdates;
 
-  // Surfaces //
+  // Per-instance offsets into the OptixInstance arrays (size is N + 1)
+  std::vector<uint32_t> m_surfaceInstanceOffsets;
+  std::vector<uint32_t> m_volumeInstanceOffsets;
+  size_t m_volumeRecordBase{0};
+
+  // Instances mark themselves dirty in 'm_transformUpdates', which holds on to
+  // them until the next full TLAS build registers the current ones
+  TransformUpdateTracker m_transformUpdates;
+  std::vector<helium::IntrusivePtr<Instance>> m_trackedInstances;
+  DeviceBuffer m_tlasUpdateScratch;
+
+  // Merged BLASs //
+
+  // Instances only share a BLAS if their OptixInstance records would match
+  struct BLASMergeKey
+  {
+    mat4x3 xfm;
+    uint32_t sbtOffset;
+    uint32_t visibilityMask;
+    uint32_t opaque;
+
+    bool operator<(const BLASMergeKey &o) const;
+  };
+
+  struct MergedBLAS
+  {
+    BLASMergeKey key{};
+    OptixTraversableHandle traversable{};
+    DeviceBuffer bvh;
+    box3 bounds;
+    DeviceBuffer surfaces; // DeviceObjectIndex of each merged surface
+    DeviceBuffer ids; // user id of the instance owning each merged surface
+  };
+
+  // Merged BLASs are reused by later TLAS builds while the same surfaces are
+  // merged under the same record, until any BLAS changes
+  using MergedBLASSignature = std::tuple<BLASMergeKey,
+      std::vector<DeviceObjectIndex>, // merged surfaces
+      std::vector<uint32_t>>; // user ids of the owning instances
+
+  BLASMergeSettings m_mergeSettings;
+  std::vector<uint8_t> m_instanceMerged;
+  std::map<MergedBLASSignature, std::shared_ptr<MergedBLAS>> m_mergedBLASCache;
+  size_t m_mergedRecordBase{0};
+
+  // TLAS //
+
+  // Everything frames read from the world's TLAS, so a new one can be built
+  // while frames keep rendering with the current one
+  struct TLASData
+  {
+    // Surfaces //
+
+    OptixTraversableHandle traversableSurfaces{};
+    DeviceBuffer bvhSurfaces;
+    HostDeviceArray<OptixInstance> optixSurfaceInstances;
+    HostDeviceArray<InstanceSurfaceGPUData> instanceSurfaceGPUData;
+    std::vector<std::shared_ptr<MergedBLAS>> mergedBLASs;
+    box3 surfaceBounds;
+
+    // Volumes //
+
+    OptixTraversableHandle traversableVolumes{};
+    DeviceBuffer bvhVolumes;
+    HostDeviceArray<OptixInstance> optixVolumeInstances;
+    HostDeviceArray<InstanceVolumeGPUData> instanceVolumeGPUData;
+    box3 volumeBounds;
+
+    // Lights //
+
+    HostDeviceArray<InstanceLightGPUData> instanceLightGPUData;
+
+    bool combined{false}; // volume records follow surface records
+
+    // Builds //
+
+    // Everything a build allocates is set up on the main thread, so building
+    // in the background only issues work on a stream
+    PreparedBVHBuild surfaceBuild;
+    PreparedBVHBuild volumeBuild;
+
+    // BLASs issued along with the TLAS, whose handles are patched into the
+    // records referencing them once compacted
+    std::vector<BVHBuildRequest> blasBuilds;
+    IssuedBVHBuilds issuedBLASBuilds;
+    std::vector<const OptixTraversableHandle *> surfaceRecordBLASs;
+    std::vector<const OptixTraversableHandle *> volumeRecordBLASs;
 
-  OptixTraversableHandle m_traversableSurfaces{};
-  DeviceBuffer m_bvhSurfaces;
-  HostDeviceArray<OptixInstance> m_optixSurfaceInstances;
+    // Keeps referenced instances alive
+    std::vector<helium::IntrusivePtr<Instance>> instances;
 
-  HostDeviceArray<InstanceSurfaceGPUData> m_instanceSurfaceGPUData;
+    // Keeps GPU data the records point to alive, as groups and instances
+    // replace theirs when they change while this TLAS is still in use
+    std::vector<std::shared_ptr<const void>> groupData;
+    std::vector<std::shared_ptr<const void>> instanceAttributes;
+  };
 
-  // Volumes //
+  std::unique_ptr<TLASData> m_tlas;
+  std::unique_ptr<TLASData> m_nextTLAS;
 
-  OptixTraversableHandle m_traversableVolumes{};
-  DeviceBuffer m_bvhVolumes;
-  HostDeviceArray<OptixInstance> m_optixVolumeInstances;
+  // Background builds //
 
-  HostDeviceArray<InstanceVolumeGPUData> m_instanceVolumeGPUData;
+  BVHVersionTracker m_tlasVersions;
+  std::future<void> m_asyncTLASBuild;
+  uint64_t m_asyncTLASVersion{0};
+  CUstream m_asyncStream{};
 
-  // Lights //
+  // Ray queries //
 
-  HostDeviceArray<InstanceLightGPUData> m_instanceLightGPUData;
+  helium::IntrusivePtr<RayQuery> m_rayQuery;
+  DeviceBuffer m_rayQueryFrameData;
+  DeviceBuffer m_rayQueryRays; // staging of rays in host memory
+  DeviceBuffer m_rayQueryHits; // staging of hits in host memory
 };
 
 } // namespace visrtx
@@ -35,9 +35,9 @@ namespace visrtx {
 
 Directional::Directional(DeviceGlobalState *d) : Light(d) {}
 
-void Directional::commit()
+void Directional::commitObject()
 {
-  Light::commit();
+  Light::commitObject();
   m_direction =
       glm::normalize(getParam<vec3>("direction", vec3(0.f, 0.f, -1.f)));
   m_irradiance = std::clamp(getParam<float>("irradiance", 1.f),
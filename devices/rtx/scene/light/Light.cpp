@@ -43,7 +43,7 @@ Light::Light(DeviceGlobalState *s)
   setRegistry(s->registry.lights);
 }
 
-void Light::commit()
+void Light::commitObject()
 {
   m_color = getParam<vec3>("color", vec3(1.f));
 }
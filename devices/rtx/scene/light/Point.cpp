@@ -35,9 +35,9 @@ namespace visrtx {
 
 Point::Point(DeviceGlobalState *d) : Light(d) {}
 
-void Point::commit()
+void Point::commitObject()
 {
-  Light::commit();
+  Light::commitObject();
   m_position = getParam<vec3>("position", vec3(0.f, 0.f, 0.f));
   m_intensity =
       std::clamp(getParam<float>("intensity", getParam<float>("power", 1.f)),
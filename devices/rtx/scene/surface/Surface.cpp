@@ -39,7 +39,7 @@ Surface::Surface(DeviceGlobalState *d)
   setRegistry(d->registry.surfaces);
 }
 
-void Surface::commit()
+void Surface::commitObject()
 {
   m_id = getParam<uint32_t>("id", ~0u);
   m_geometry = getParamObject<Geometry>("geometry");
@@ -40,7 +40,7 @@ struct Surface : public RegisteredObject<SurfaceGPUData>
 {
   Surface(DeviceGlobalState *d);
 
-  void commit() override;
+  void commitObject() override;
 
   const Geometry *geometry() const;
   const Material *material() const;
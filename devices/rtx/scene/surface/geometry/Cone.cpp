@@ -40,9 +40,9 @@ Cone::~Cone()
   cleanup();
 }
 
-void Cone::commit()
+void Cone::commitObject()
 {
-  Geometry::commit();
+  Geometry::commitObject();
 
   cleanup();
 
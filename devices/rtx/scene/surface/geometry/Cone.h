@@ -41,7 +41,7 @@ struct Cone : public Geometry
   Cone(DeviceGlobalState *d);
   ~Cone() override;
 
-  void commit() override;
+  void commitObject() override;
 
   void populateBuildInput(OptixBuildInput &) const override;
 
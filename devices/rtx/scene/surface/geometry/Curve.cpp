@@ -42,9 +42,9 @@ Curve::~Curve()
   cleanup();
 }
 
-void Curve::commit()
+void Curve::commitObject()
 {
-  Geometry::commit();
+  Geometry::commitObject();
 
   cleanup();
 
@@ -42,7 +42,7 @@ struct Curve : public Geometry
   Curve(DeviceGlobalState *d);
   ~Curve() override;
 
-  void commit() override;
+  void commitObject() override;
 
   void populateBuildInput(OptixBuildInput &) const override;
 
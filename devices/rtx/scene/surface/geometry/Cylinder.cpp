@@ -40,9 +40,9 @@ Cylinder::~Cylinder()
   cleanup();
 }
 
-void Cylinder::commit()
+void Cylinder::commitObject()
 {
-  Geometry::commit();
+  Geometry::commitObject();
 
   cleanup();
 
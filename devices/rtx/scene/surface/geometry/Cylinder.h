@@ -42,7 +42,7 @@ struct Cylinder : public Geometry
   Cylinder(DeviceGlobalState *d);
   ~Cylinder() override;
 
-  void commit() override;
+  void commitObject() override;
 
   void populateBuildInput(OptixBuildInput &) const override;
 
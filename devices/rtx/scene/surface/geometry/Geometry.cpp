@@ -34,7 +34,9 @@
 #include "Cone.h"
 #include "Curve.h"
 #include "Cylinder.h"
+#include "Isosurface.h"
 #include "Quad.h"
+#include "Slice.h"
 #include "Sphere.h"
 #include "Triangle.h"
 #include "UnknownGeometry.h"
@@ -64,11 +66,15 @@ Geometry *Geometry::createInstance(
     return new Cone(d);
   else if (subtype == "curve")
     return new Curve(d);
+  else if (subtype == "isosurface")
+    return new Isosurface(d);
+  else if (subtype == "slice")
+    return new Slice(d);
   else
     return new UnknownGeometry(subtype, d);
 }
 
-void Geometry::commit()
+void Geometry::commitObject()
 {
   m_attribute0 = getParamObject<Array1D>("primitive.attribute0");
   m_attribute1 = getParamObject<Array1D>("primitive.attribute1");
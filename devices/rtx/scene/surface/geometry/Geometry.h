@@ -43,7 +43,7 @@ struct Geometry : public RegisteredObject<GeometryGPUData>
   static Geometry *createInstance(
       std::string_view subtype, DeviceGlobalState *d);
 
-  void commit() override;
+  void commitObject() override;
 
   virtual void populateBuildInput(OptixBuildInput &) const = 0;
   virtual int optixGeometryType() const = 0;
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Isosurface.h"
+#include "gpu/isosurface.h"
+// thrust
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+// std
+#include <vector>
+
+namespace visrtx {
+
+Isosurface::Isosurface(DeviceGlobalState *d) : Geometry(d) {}
+
+Isosurface::~Isosurface()
+{
+  cleanup();
+}
+
+void Isosurface::commitObject()
+{
+  Geometry::commitObject();
+
+  cleanup();
+  m_isovalues.clear();
+
+  m_field = getParamObject<SpatialField>("field");
+  m_isovalueArray = getParamObject<Array1D>("isovalue");
+
+  if (!m_field) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "missing required parameter 'field' on isosurface geometry");
+    return;
+  }
+
+  std::vector<float> isovalues;
+  if (m_isovalueArray) {
+    const auto *begin = m_isovalueArray->beginAs<float>();
+    isovalues.assign(begin, begin + m_isovalueArray->size());
+  } else {
+    float isovalue = 0.f;
+    if (getParam("isovalue", ANARI_FLOAT32, &isovalue))
+      isovalues.push_back(isovalue);
+  }
+
+  if (isovalues.empty()) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "missing required parameter 'isovalue' on isosurface geometry");
+    return;
+  }
+
+  if (isovalues.size() > MAX_ISOVALUES) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "isosurface geometry only supports up to %u isovalues, ignoring %zu",
+        MAX_ISOVALUES,
+        isovalues.size() - MAX_ISOVALUES);
+    isovalues.resize(MAX_ISOVALUES);
+  }
+
+  m_field->addCommitObserver(this);
+  if (m_isovalueArray)
+    m_isovalueArray->addCommitObserver(this);
+
+  if (!m_field->isValid())
+    return;
+
+  m_isovalues = isovalues;
+
+  updateCells();
+  updateCellMasks();
+
+  upload();
+}
+
+void Isosurface::populateBuildInput(OptixBuildInput &buildInput) const
+{
+  buildInput.type = OPTIX_BUILD_INPUT_TYPE_CUSTOM_PRIMITIVES;
+
+  buildInput.customPrimitiveArray.aabbBuffers = &m_aabbsBufferPtr;
+  buildInput.customPrimitiveArray.numPrimitives = m_aabbs.size();
+
+  static uint32_t buildInputFlags[1] = {OPTIX_GEOMETRY_FLAG_NONE};
+
+  buildInput.customPrimitiveArray.flags = buildInputFlags;
+  buildInput.customPrimitiveArray.numSbtRecords = 1;
+}
+
+int Isosurface::optixGeometryType() const
+{
+  return OPTIX_BUILD_INPUT_TYPE_CUSTOM_PRIMITIVES;
+}
+
+bool Isosurface::isValid() const
+{
+  return m_field && m_field->isValid() && !m_isovalues.empty();
+}
+
+void Isosurface::markCommitted()
+{
+  // New isovalues only change the cell masks read by the intersector
+  const bool valid = isValid();
+  if (m_cellsChanged || valid != m_wasValid)
+    Geometry::markCommitted();
+  else
+    Object::markCommitted();
+  m_cellsChanged = false;
+  m_wasValid = valid;
+}
+
+GeometryGPUData Isosurface::gpuData() const
+{
+  auto retval = Geometry::gpuData();
+  retval.type = GeometryType::ISOSURFACE;
+
+  auto &iso = retval.isosurface;
+
+  iso.field = m_field->index();
+  iso.isovalues = thrust::raw_pointer_cast(m_isovalues.data());
+  iso.numIsovalues = uint32_t(m_isovalues.size());
+  iso.cellMasks = thrust::raw_pointer_cast(m_cellMasks.data());
+  iso.stepSize = m_field->stepSize();
+
+  return retval;
+}
+
+void Isosurface::updateCells()
+{
+  const auto &grid = m_field->m_uniformGrid;
+  const ivec3 dims = grid.m_dims;
+  const box3 worldBounds = grid.m_worldBounds;
+
+  if (!m_aabbs.empty() && dims == m_cellDims
+      && worldBounds.lower == m_cellBounds.lower
+      && worldBounds.upper == m_cellBounds.upper)
+    return;
+
+  m_cellDims = dims;
+  m_cellBounds = worldBounds;
+  m_cellsChanged = true;
+
+  const size_t numCells = dims.x * size_t(dims.y) * dims.z;
+  m_aabbs.resize(numCells);
+
+  reportMessage(ANARI_SEVERITY_DEBUG,
+      "building %zu macrocells for isosurface geometry",
+      numCells);
+
+  thrust::transform(thrust::cuda::par.on(deviceState()->stream),
+      thrust::make_counting_iterator<uint32_t>(0),
+      thrust::make_counting_iterator<uint32_t>(numCells),
+      m_aabbs.begin(),
+      [=] __device__(uint32_t i) {
+        return macrocellBounds(dims, worldBounds, i);
+      });
+
+  m_aabbsBufferPtr = (CUdeviceptr)thrust::raw_pointer_cast(m_aabbs.data());
+}
+
+void Isosurface::updateCellMasks()
+{
+  const auto &grid = m_field->m_uniformGrid;
+  const box1 *valueRanges = grid.m_valueRanges;
+  const float *isovalues = thrust::raw_pointer_cast(m_isovalues.data());
+  const uint32_t numIsovalues = uint32_t(m_isovalues.size());
+
+  m_cellMasks.resize(m_aabbs.size());
+
+  thrust::transform(thrust::cuda::par.on(deviceState()->stream),
+      thrust::make_counting_iterator<uint32_t>(0),
+      thrust::make_counting_iterator<uint32_t>(m_aabbs.size()),
+      m_cellMasks.begin(),
+      [=] __device__(uint32_t i) {
+        return isovalueMask(valueRanges[i], isovalues, numIsovalues);
+      });
+}
+
+void Isosurface::cleanup()
+{
+  if (m_field)
+    m_field->removeCommitObserver(this);
+  if (m_isovalueArray)
+    m_isovalueArray->removeCommitObserver(this);
+}
+
+} // namespace visrtx
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "Geometry.h"
+#include "array/Array1D.h"
+#include "scene/volume/spatial_field/SpatialField.h"
+// thrust
+#include <thrust/device_vector.h>
+
+namespace visrtx {
+
+// Isosurfaces of a spatial field, intersected directly from the field with
+// one custom primitive per macrocell of the field's UniformGrid
+struct Isosurface : public Geometry
+{
+  Isosurface(DeviceGlobalState *d);
+  ~Isosurface() override;
+
+  void commitObject() override;
+
+  void populateBuildInput(OptixBuildInput &) const override;
+
+  int optixGeometryType() const override;
+
+  bool isValid() const override;
+
+  void markCommitted() override;
+
+ private:
+  GeometryGPUData gpuData() const override;
+  void updateCells();
+  void updateCellMasks();
+  void cleanup();
+
+  helium::IntrusivePtr<SpatialField> m_field;
+  helium::IntrusivePtr<Array1D> m_isovalueArray;
+
+  thrust::device_vector<float> m_isovalues;
+  thrust::device_vector<uint32_t> m_cellMasks;
+
+  thrust::device_vector<box3> m_aabbs;
+  CUdeviceptr m_aabbsBufferPtr{};
+
+  // The cells only depend on the field's grid, so isovalue changes don't
+  // need a new BVH
+  ivec3 m_cellDims{0};
+  box3 m_cellBounds;
+  bool m_cellsChanged{true};
+  bool m_wasValid{false};
+};
+
+} // namespace visrtx
@@ -40,9 +40,9 @@ Quad::~Quad()
   cleanup();
 }
 
-void Quad::commit()
+void Quad::commitObject()
 {
-  Geometry::commit();
+  Geometry::commitObject();
 
   cleanup();
 
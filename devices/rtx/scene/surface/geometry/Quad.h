@@ -41,7 +41,7 @@ struct Quad : public Geometry
   Quad(DeviceGlobalState *d);
   ~Quad() override;
 
-  void commit() override;
+  void commitObject() override;
 
   void populateBuildInput(OptixBuildInput &) const override;
 
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Slice.h"
+#include "gpu/slice.h"
+// std
+#include <algorithm>
+#include <vector>
+
+namespace visrtx {
+
+Slice::Slice(DeviceGlobalState *d) : Geometry(d) {}
+
+Slice::~Slice()
+{
+  cleanup();
+}
+
+void Slice::commitObject()
+{
+  Geometry::commitObject();
+
+  cleanup();
+  m_planes.clear();
+
+  m_volume = getParamObject<Volume>("volume");
+  m_planeArray = getParamObject<Array1D>("plane");
+
+  if (!m_volume) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "missing required parameter 'volume' on slice geometry");
+    return;
+  }
+
+  std::vector<vec4> planes;
+  if (m_planeArray) {
+    const auto *begin = m_planeArray->beginAs<vec4>();
+    planes.assign(begin, begin + m_planeArray->size());
+  } else {
+    vec4 plane(0.f);
+    if (getParam("plane", ANARI_FLOAT32_VEC4, &plane))
+      planes.push_back(plane);
+  }
+
+  if (planes.empty()) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "missing required parameter 'plane' on slice geometry");
+    return;
+  }
+
+  m_volume->addCommitObserver(this);
+  if (m_planeArray)
+    m_planeArray->addCommitObserver(this);
+
+  if (!m_volume->isValid())
+    return;
+
+  reportMessage(ANARI_SEVERITY_DEBUG,
+      "committing slice geometry with %zu planes",
+      planes.size());
+
+  const box3 bounds = m_volume->bounds();
+
+  std::vector<box3> aabbs(planes.size());
+  m_planes.resize(planes.size());
+  for (size_t i = 0; i < planes.size(); i++) {
+    m_planes.begin()[i] = normalizeSlicePlane(planes[i]);
+    // Planes missing the volume get an empty box, which OptiX never hits
+    aabbs[i] = slicePlaneBounds(m_planes.begin()[i], bounds);
+  }
+
+  auto sameBox = [](const box3 &a, const box3 &b) {
+    return a.lower == b.lower && a.upper == b.upper;
+  };
+  m_aabbsChanged |= aabbs.size() != m_aabbs.size()
+      || !std::equal(aabbs.begin(), aabbs.end(), m_aabbs.begin(), sameBox);
+
+  if (m_aabbsChanged) {
+    m_aabbs.resize(aabbs.size());
+    std::copy(aabbs.begin(), aabbs.end(), m_aabbs.begin());
+    m_aabbs.upload();
+    m_aabbsBufferPtr = (CUdeviceptr)m_aabbs.dataDevice();
+  }
+
+  m_planes.upload();
+
+  upload();
+}
+
+void Slice::populateBuildInput(OptixBuildInput &buildInput) const
+{
+  buildInput.type = OPTIX_BUILD_INPUT_TYPE_CUSTOM_PRIMITIVES;
+
+  buildInput.customPrimitiveArray.aabbBuffers = &m_aabbsBufferPtr;
+  buildInput.customPrimitiveArray.numPrimitives = m_aabbs.size();
+
+  static uint32_t buildInputFlags[1] = {OPTIX_GEOMETRY_FLAG_NONE};
+
+  buildInput.customPrimitiveArray.flags = buildInputFlags;
+  buildInput.customPrimitiveArray.numSbtRecords = 1;
+}
+
+int Slice::optixGeometryType() const
+{
+  return OPTIX_BUILD_INPUT_TYPE_CUSTOM_PRIMITIVES;
+}
+
+bool Slice::isValid() const
+{
+  return m_volume && m_volume->isValid() && !m_planes.empty();
+}
+
+void Slice::markCommitted()
+{
+  // Unmoved planes only change the transfer function read when shading
+  const bool valid = isValid();
+  if (m_aabbsChanged || valid != m_wasValid)
+    Geometry::markCommitted();
+  else
+    Object::markCommitted();
+  m_aabbsChanged = false;
+  m_wasValid = valid;
+}
+
+GeometryGPUData Slice::gpuData() const
+{
+  auto retval = Geometry::gpuData();
+  retval.type = GeometryType::SLICE;
+
+  auto &slice = retval.slice;
+
+  slice.planes = m_planes.dataDevice();
+  slice.volume = m_volume->index();
+
+  return retval;
+}
+
+void Slice::cleanup()
+{
+  if (m_volume)
+    m_volume->removeCommitObserver(this);
+  if (m_planeArray)
+    m_planeArray->removeCommitObserver(this);
+}
+
+} // namespace visrtx
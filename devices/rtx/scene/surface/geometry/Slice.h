@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "Geometry.h"
+#include "array/Array1D.h"
+#include "scene/volume/Volume.h"
+
+namespace visrtx {
+
+// Planes through a volume, colored by classifying the volume's field where
+// they are hit instead of extracting any geometry from it
+struct Slice : public Geometry
+{
+  Slice(DeviceGlobalState *d);
+  ~Slice() override;
+
+  void commitObject() override;
+
+  void populateBuildInput(OptixBuildInput &) const override;
+
+  int optixGeometryType() const override;
+
+  bool isValid() const override;
+
+  void markCommitted() override;
+
+ private:
+  GeometryGPUData gpuData() const override;
+  void cleanup();
+
+  helium::IntrusivePtr<Volume> m_volume;
+  helium::IntrusivePtr<Array1D> m_planeArray;
+
+  HostDeviceArray<vec4> m_planes;
+
+  HostDeviceArray<box3> m_aabbs;
+  CUdeviceptr m_aabbsBufferPtr{};
+
+  // Only moved planes need a new BVH, transfer function edits don't
+  bool m_aabbsChanged{true};
+  bool m_wasValid{false};
+};
+
+} // namespace visrtx
@@ -43,9 +43,9 @@ Sphere::~Sphere()
   cleanup();
 }
 
-void Sphere::commit()
+void Sphere::commitObject()
 {
-  Geometry::commit();
+  Geometry::commitObject();
 
   cleanup();
 
@@ -44,7 +44,7 @@ struct Sphere : public Geometry
   Sphere(DeviceGlobalState *d);
   ~Sphere() override;
 
-  void commit() override;
+  void commitObject() override;
 
   void populateBuildInput(OptixBuildInput &) const override;
 
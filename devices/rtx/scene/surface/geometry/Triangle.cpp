@@ -40,9 +40,9 @@ Triangle::~Triangle()
   cleanup();
 }
 
-void Triangle::commit()
+void Triangle::commitObject()
 {
-  Geometry::commit();
+  Geometry::commitObject();
 
   cleanup();
 
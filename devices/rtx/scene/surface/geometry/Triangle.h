@@ -41,7 +41,7 @@ struct Triangle : public Geometry
   Triangle(DeviceGlobalState *d);
   ~Triangle() override;
 
-  void commit() override;
+  void commitObject() override;
 
   void populateBuildInput(OptixBuildInput &) const override;
 
@@ -54,6 +54,25 @@ Material *Material::createInstance(
     return new UnknownMaterial(subtype, d);
 }
 
+bool Material::isOpaque() const
+{
+  return m_opaque;
+}
+
+void Material::markCommitted()
+{
+  Object::markCommitted();
+
+  // Instance flags in the world TLAS depend on the opacity class
+  const bool opaque = isFullyOpaque(gpuData());
+  if (opaque != m_opaque) {
+    m_opaque = opaque;
+    auto &updates = deviceState()->objectUpdates;
+    updates.lastOpacityChange = helium::newTimeStamp();
+    updates.lastTLASChange = updates.lastOpacityChange;
+  }
+}
+
 } // namespace visrtx
 
 VISRTX_ANARI_TYPEFOR_DEFINITION(visrtx::Material *);
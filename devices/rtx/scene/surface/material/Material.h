@@ -31,6 +31,7 @@
 
 #pragma once
 
+#include "MaterialOpacity.h"
 #include "RegisteredObject.h"
 #include "sampler/Sampler.h"
 
@@ -43,6 +44,13 @@ struct Material : public RegisteredObject<MaterialGPUData>
 
   static Material *createInstance(
       std::string_view subtype, DeviceGlobalState *d);
+
+  bool isOpaque() const;
+
+  void markCommitted() override;
+
+ private:
+  bool m_opaque{true};
 };
 
 // Inlined helper functions ///////////////////////////////////////////////////
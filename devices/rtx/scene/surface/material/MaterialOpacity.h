@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "gpu/gpu_objects.h"
+
+namespace visrtx {
+
+// Opacity at or above which any-hit programs accept a surface hit
+constexpr float OPAQUE_HIT_THRESHOLD = 0.99f;
+
+// Returns true if no any-hit program can ever discard a hit on a surface with
+// this material, which requires the opacity to be known without evaluating
+// samplers or attributes
+bool isFullyOpaque(const MaterialGPUData &md);
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline bool isFullyOpaque(const MaterialGPUData &md)
+{
+  // 'dpt' tests the raw opacity parameter regardless of the alpha mode
+  const auto &opacity = md.opacity;
+  if (opacity.type != MaterialParameterType::VALUE
+      || opacity.value < OPAQUE_HIT_THRESHOLD)
+    return false;
+
+  if (md.mode == AlphaMode::OPAQUE)
+    return true;
+
+  const auto &baseColor = md.baseColor;
+  if (baseColor.type != MaterialParameterType::VALUE)
+    return false;
+
+  const float alpha = opacity.value * baseColor.value.w;
+  return md.mode == AlphaMode::MASK ? alpha >= md.cutoff
+                                    : alpha >= OPAQUE_HIT_THRESHOLD;
+}
+
+} // namespace visrtx
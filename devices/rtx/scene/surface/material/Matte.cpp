@@ -35,7 +35,7 @@ namespace visrtx {
 
 Matte::Matte(DeviceGlobalState *d) : Material(d) {}
 
-void Matte::commit()
+void Matte::commitObject()
 {
   m_opacity = getParam<float>("opacity", 1.f);
   m_opacitySampler = getParamObject<Sampler>("opacity");
@@ -40,7 +40,7 @@ struct Matte : public Material
 {
   Matte(DeviceGlobalState *d);
 
-  void commit() override;
+  void commitObject() override;
 
  private:
   MaterialGPUData gpuData() const override;
@@ -35,7 +35,7 @@ namespace visrtx {
 
 PBR::PBR(DeviceGlobalState *d) : Material(d) {}
 
-void PBR::commit()
+void PBR::commitObject()
 {
   m_opacity = getParam<float>("opacity", 1.f);
   m_opacitySampler = getParamObject<Sampler>("opacity");
@@ -47,6 +47,22 @@ void PBR::commit()
   m_colorSampler = getParamObject<Sampler>("baseColor");
   m_colorAttribute = getParamString("baseColor", "");
 
+  m_metallic = getParam<float>("metallic", 1.f);
+  m_metallicSampler = getParamObject<Sampler>("metallic");
+  m_metallicAttribute = getParamString("metallic", "");
+
+  m_roughness = getParam<float>("roughness", 1.f);
+  m_roughnessSampler = getParamObject<Sampler>("roughness");
+  m_roughnessAttribute = getParamString("roughness", "");
+
+  m_emissive = getParam<vec3>("emissive", vec3(0.f));
+  m_emissiveSampler = getParamObject<Sampler>("emissive");
+  m_emissiveAttribute = getParamString("emissive", "");
+
+  m_normalSampler = getParamObject<Sampler>("normal");
+
+  m_ior = getParam<float>("ior", 1.5f);
+
   m_cutoff = getParam<float>("alphaCutoff", 0.5f);
   m_mode = alphaModeFromString(getParamString("alphaMode", "opaque"));
 
@@ -61,7 +77,20 @@ MaterialGPUData PBR::gpuData() const
       retval.baseColor, m_color, m_colorSampler, m_colorAttribute);
   populateMaterialParameter(
       retval.opacity, m_opacity, m_opacitySampler, m_opacityAttribute);
+  populateMaterialParameter(
+      retval.metallic, m_metallic, m_metallicSampler, m_metallicAttribute);
+  populateMaterialParameter(retval.roughness,
+      m_roughness,
+      m_roughnessSampler,
+      m_roughnessAttribute);
+  populateMaterialParameter(
+      retval.emissive, m_emissive, m_emissiveSampler, m_emissiveAttribute);
+
+  if (m_normalSampler && m_normalSampler->isValid())
+    retval.normalSampler = m_normalSampler->index();
 
+  retval.specular = 1.f;
+  retval.ior = m_ior;
   retval.cutoff = m_cutoff;
   retval.mode = m_mode;
 
@@ -40,7 +40,7 @@ struct PBR : public Material
 {
   PBR(DeviceGlobalState *d);
 
-  void commit() override;
+  void commitObject() override;
 
  private:
   MaterialGPUData gpuData() const override;
@@ -55,6 +55,22 @@ struct PBR : public Material
   float m_opacity{1.f};
   helium::IntrusivePtr<Sampler> m_opacitySampler;
   std::string m_opacityAttribute;
+
+  float m_metallic{1.f};
+  helium::IntrusivePtr<Sampler> m_metallicSampler;
+  std::string m_metallicAttribute;
+
+  float m_roughness{1.f};
+  helium::IntrusivePtr<Sampler> m_roughnessSampler;
+  std::string m_roughnessAttribute;
+
+  vec3 m_emissive{0.f};
+  helium::IntrusivePtr<Sampler> m_emissiveSampler;
+  std::string m_emissiveAttribute;
+
+  helium::IntrusivePtr<Sampler> m_normalSampler;
+
+  float m_ior{1.5f};
 };
 
 } // namespace visrtx
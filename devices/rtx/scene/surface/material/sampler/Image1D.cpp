@@ -40,9 +40,9 @@ Image1D::~Image1D()
   cleanup();
 }
 
-void Image1D::commit()
+void Image1D::commitObject()
 {
-  Sampler::commit();
+  Sampler::commitObject();
 
   cleanup();
 
@@ -42,7 +42,7 @@ struct Image1D : public Sampler
   Image1D(DeviceGlobalState *d);
   ~Image1D();
 
-  void commit() override;
+  void commitObject() override;
 
   int numChannels() const override;
 
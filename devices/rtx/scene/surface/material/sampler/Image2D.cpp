@@ -40,9 +40,9 @@ Image2D::~Image2D()
   cleanup();
 }
 
-void Image2D::commit()
+void Image2D::commitObject()
 {
-  Sampler::commit();
+  Sampler::commitObject();
 
   cleanup();
 
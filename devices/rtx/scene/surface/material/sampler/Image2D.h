@@ -42,7 +42,7 @@ struct Image2D : public Sampler
   Image2D(DeviceGlobalState *d);
   ~Image2D();
 
-  void commit() override;
+  void commitObject() override;
 
   int numChannels() const override;
 
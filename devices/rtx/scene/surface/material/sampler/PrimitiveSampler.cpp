@@ -36,9 +36,9 @@ namespace visrtx {
 
 PrimitiveSampler::PrimitiveSampler(DeviceGlobalState *d) : Sampler(d) {}
 
-void PrimitiveSampler::commit()
+void PrimitiveSampler::commitObject()
 {
-  Sampler::commit();
+  Sampler::commitObject();
 
   m_ap.numChannels = 0;
   m_ap.data = nullptr;
@@ -41,7 +41,7 @@ struct PrimitiveSampler : public Sampler
   PrimitiveSampler(DeviceGlobalState *d);
   ~PrimitiveSampler() = default;
 
-  void commit() override;
+  void commitObject() override;
 
   int numChannels() const override;
 
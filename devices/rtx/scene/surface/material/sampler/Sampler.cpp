@@ -59,7 +59,7 @@ Sampler *Sampler::createInstance(std::string_view subtype, DeviceGlobalState *d)
     return new UnknownSampler(subtype, d);
 }
 
-void Sampler::commit()
+void Sampler::commitObject()
 {
   m_inAttribute = getParamString("inAttribute", "attribute0");
   m_inTransform = getParam<mat4>("inTransform", mat4(1.f));
@@ -36,9 +36,9 @@ namespace visrtx {
 
 TransformSampler::TransformSampler(DeviceGlobalState *d) : Sampler(d) {}
 
-void TransformSampler::commit()
+void TransformSampler::commitObject()
 {
-  Sampler::commit();
+  Sampler::commitObject();
   m_inTransform = mat4(1.f);
   upload();
 }
@@ -41,9 +41,9 @@ TransferFunction1D::~TransferFunction1D()
   cleanup();
 }
 
-void TransferFunction1D::commit()
+void TransferFunction1D::commitObject()
 {
-  Volume::commit();
+  Volume::commitObject();
 
   cleanup();
 
@@ -117,6 +117,7 @@ void TransferFunction1D::commit()
   copyParams.kind = cudaMemcpyHostToDevice;
 
   cudaMemcpy3D(&copyParams);
+  countUploadBytes(m_tfDim * sizeof(vec4));
 
   cudaResourceDesc resDesc;
   std::memset(&resDesc, 0, sizeof(resDesc));
@@ -42,7 +42,7 @@ struct TransferFunction1D : public Volume
   TransferFunction1D(DeviceGlobalState *d);
   ~TransferFunction1D();
 
-  void commit() override;
+  void commitObject() override;
 
   bool isValid() const override;
 
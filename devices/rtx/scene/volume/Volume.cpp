@@ -42,7 +42,7 @@ Volume::Volume(DeviceGlobalState *d)
   setRegistry(d->registry.volumes);
 }
 
-void Volume::commit()
+void Volume::commitObject()
 {
   m_id = getParam<uint32_t>("id", ~0u);
 }
@@ -74,6 +74,11 @@ void Volume::markCommitted()
   deviceState()->objectUpdates.lastBLASChange = helium::newTimeStamp();
 }
 
+box3 Volume::bounds() const
+{
+  return isValid() ? gpuData().bounds : box3();
+}
+
 Volume *Volume::createInstance(std::string_view subtype, DeviceGlobalState *d)
 {
   if (subtype == "transferFunction1D" || subtype == "scivis")
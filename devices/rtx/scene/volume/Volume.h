@@ -40,12 +40,14 @@ struct Volume : public RegisteredObject<VolumeGPUData>
   Volume(DeviceGlobalState *d);
   ~Volume() = default;
 
-  void commit() override;
+  void commitObject() override;
 
   OptixBuildInput buildInput() const;
 
   void markCommitted() override;
 
+  box3 bounds() const; // empty if invalid
+
   static Volume *createInstance(std::string_view subtype, DeviceGlobalState *d);
 
  protected:
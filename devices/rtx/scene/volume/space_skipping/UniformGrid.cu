@@ -69,10 +69,12 @@ __global__ void computeMaxOpacitiesGPU(float *maxOpacities,
   valueRange.upper -= xfRange.lower;
   valueRange.upper /= xfRange.upper - xfRange.lower;
 
-  int lo = glm::clamp(
-      int(valueRange.lower * (numColors - 1)), 0, int(numColors - 1));
-  int hi = glm::clamp(
-      int(valueRange.upper * (numColors - 1)) + 1, 0, int(numColors - 1));
+  // Clamp before converting, as unbounded ranges don't fit in an int
+  const float maxColor = float(numColors - 1);
+  int lo = int(glm::clamp(valueRange.lower * maxColor, 0.f, maxColor));
+  int hi = glm::min(
+      int(glm::clamp(valueRange.upper * maxColor, 0.f, maxColor)) + 1,
+      int(numColors - 1));
 
   float maxOpacity = 0.f;
   for (int i = lo; i <= hi; ++i) {
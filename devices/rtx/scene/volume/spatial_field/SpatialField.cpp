@@ -31,11 +31,38 @@
 
 #include "SpatialField.h"
 // specific types
+#include "StreamedRegularField.h"
 #include "StructuredRegularField.h"
 #include "UnknownSpatialField.h"
+// std
+#include <algorithm>
+#include <limits>
 
 namespace visrtx {
 
+// Helper functions ///////////////////////////////////////////////////////////
+
+template <typename FROM_T, typename TO_T = float>
+static void convertElementsNormalized(
+    const void *_begin, size_t size, TO_T *output)
+{
+  auto toFloatNormalized = [](auto c) {
+    return TO_T(c / float(std::numeric_limits<FROM_T>::max()));
+  };
+  auto *begin = (const FROM_T *)_begin;
+  std::transform(begin, begin + size, output, toFloatNormalized);
+}
+
+template <typename FROM_T, typename TO_T = float>
+static void convertElements(const void *_begin, size_t size, TO_T *output)
+{
+  auto toFloat = [](auto c) { return TO_T(c); };
+  auto *begin = (const FROM_T *)_begin;
+  std::transform(begin, begin + size, output, toFloat);
+}
+
+// SpatialField definitions ///////////////////////////////////////////////////
+
 SpatialField::SpatialField(DeviceGlobalState *s)
     : RegisteredObject<SpatialFieldGPUData>(ANARI_SPATIAL_FIELD, s)
 {
@@ -48,15 +75,73 @@ void SpatialField::markCommitted()
   deviceState()->objectUpdates.lastBLASChange = helium::newTimeStamp();
 }
 
+bool SpatialField::updateStreamedData()
+{
+  return false;
+}
+
 SpatialField *SpatialField::createInstance(
     std::string_view subtype, DeviceGlobalState *d)
 {
   if (subtype == "structuredRegular")
     return new StructuredRegularField(d);
+  else if (subtype == "streamedRegular")
+    return new StreamedRegularField(d);
   else
     return new UnknownSpatialField(subtype, d);
 }
 
+bool validFieldDataType(ANARIDataType format)
+{
+  switch (format) {
+  case ANARI_UINT8:
+  case ANARI_INT16:
+  case ANARI_UINT16:
+  case ANARI_UFIXED8:
+  case ANARI_FIXED16:
+  case ANARI_UFIXED16:
+  case ANARI_FLOAT32:
+  case ANARI_FLOAT64:
+    return true;
+  default:
+    break;
+  }
+  return false;
+}
+
+void convertFieldData(
+    ANARIDataType format, const void *input, size_t size, float *output)
+{
+  switch (format) {
+  case ANARI_UINT8:
+    convertElements<uint8_t>(input, size, output);
+    break;
+  case ANARI_INT16:
+    convertElements<int16_t>(input, size, output);
+    break;
+  case ANARI_UINT16:
+    convertElements<uint16_t>(input, size, output);
+    break;
+  case ANARI_UFIXED8:
+    convertElementsNormalized<uint8_t>(input, size, output);
+    break;
+  case ANARI_FIXED16:
+    convertElementsNormalized<int16_t>(input, size, output);
+    break;
+  case ANARI_UFIXED16:
+    convertElementsNormalized<uint16_t>(input, size, output);
+    break;
+  case ANARI_FLOAT32:
+    convertElements<float>(input, size, output);
+    break;
+  case ANARI_FLOAT64:
+    convertElements<double>(input, size, output);
+    break;
+  default:
+    break;
+  }
+}
+
 } // namespace visrtx
 
 VISRTX_ANARI_TYPEFOR_DEFINITION(visrtx::SpatialField *);
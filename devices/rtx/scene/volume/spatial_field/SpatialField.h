@@ -45,6 +45,10 @@ struct SpatialField : public RegisteredObject<SpatialFieldGPUData>
 
   virtual float stepSize() const = 0;
 
+  // Bring data streamed in between frames up to date with what the last frame
+  // sampled, returning whether the field changed
+  virtual bool updateStreamedData();
+
   void markCommitted() override;
 
   static SpatialField *createInstance(
@@ -53,6 +57,13 @@ struct SpatialField : public RegisteredObject<SpatialFieldGPUData>
   UniformGrid m_uniformGrid;
 };
 
+// Whether spatial fields can hold values of 'format'
+bool validFieldDataType(ANARIDataType format);
+
+// Convert 'size' values of a valid field data type to floats
+void convertFieldData(
+    ANARIDataType format, const void *input, size_t size, float *output);
+
 } // namespace visrtx
 
 VISRTX_ANARI_TYPEFOR_SPECIALIZATION(
@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "StreamedRegularField.h"
+// std
+#include <algorithm>
+#include <cstring>
+
+namespace visrtx {
+
+StreamedRegularField::StreamedRegularField(DeviceGlobalState *d)
+    : SpatialField(d)
+{
+  m_loader.field = this;
+  d->streamedFields.push_back(this);
+}
+
+StreamedRegularField::~StreamedRegularField()
+{
+  cleanup();
+  auto &fields = deviceState()->streamedFields;
+  fields.erase(std::remove(fields.begin(), fields.end(), this), fields.end());
+}
+
+void StreamedRegularField::commitObject()
+{
+  cleanup();
+
+  m_params.dims = getParam<uvec3>("dimensions", uvec3(0u));
+  m_params.origin = getParam<vec3>("origin", vec3(0.f));
+  m_params.spacing = getParam<vec3>("spacing", vec3(1.f));
+  m_params.filter = getParamString("filter", "linear");
+  m_params.callback =
+      (VisRTXBrickCallback)getParam<void *>("brickCallback", nullptr);
+  m_params.callbackUserData =
+      getParam<void *>("brickCallbackUserData", nullptr);
+  m_params.filename = getParamString("filename", "");
+  m_params.format = getParam<ANARIDataType>("format", ANARI_FLOAT32);
+  m_params.fileOffset = getParam<uint64_t>("fileOffset", 0);
+  m_params.brickSize = std::max(getParam<uint32_t>("brickSize", 32), 1u);
+  m_params.cacheSize = getParam<uint32_t>("cacheSize", 512);
+  m_params.loadsPerFrame = getParam<uint32_t>("loadsPerFrame", 64);
+
+  if (glm::any(glm::equal(m_params.dims, uvec3(0u)))) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "missing required parameter 'dimensions' on streamedRegular spatial "
+        "field");
+    return;
+  }
+
+  if (!m_params.callback) {
+    if (m_params.filename.empty()) {
+      reportMessage(ANARI_SEVERITY_WARNING,
+          "streamedRegular spatial field needs either 'brickCallback' or "
+          "'filename' to be set");
+      return;
+    }
+
+    if (!validFieldDataType(m_params.format)) {
+      reportMessage(ANARI_SEVERITY_WARNING,
+          "invalid 'format' on streamedRegular spatial field (%s)",
+          anari::toString(m_params.format));
+      return;
+    }
+
+    m_file.open(m_params.filename, std::ios::binary);
+    if (!m_file) {
+      reportMessage(ANARI_SEVERITY_WARNING,
+          "unable to open '%s' for streamedRegular spatial field",
+          m_params.filename.c_str());
+      return;
+    }
+  }
+
+  const BrickLayout layout(m_params.dims, m_params.brickSize);
+  m_cache = std::make_unique<BrickCache<BrickLoader>>(
+      m_loader, layout, m_params.cacheSize, m_params.loadsPerFrame);
+
+  // Atlas of all cache slots, each holding a brick and its overlap //
+
+  m_atlasSlots = brickAtlasSlots(m_cache->numSlots());
+  const uvec3 atlasDims = m_atlasSlots * (m_params.brickSize + 1);
+
+  auto desc = cudaCreateChannelDesc(
+      sizeof(float) * 8, 0, 0, 0, cudaChannelFormatKindFloat);
+  if (cudaMalloc3DArray(&m_atlas,
+          &desc,
+          make_cudaExtent(atlasDims.x, atlasDims.y, atlasDims.z))
+      != cudaSuccess) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "unable to allocate a brick cache of %u slots for streamedRegular "
+        "spatial field",
+        m_cache->numSlots());
+    m_atlas = {};
+    cleanup();
+    return;
+  }
+
+  cudaResourceDesc resDesc;
+  std::memset(&resDesc, 0, sizeof(resDesc));
+  resDesc.resType = cudaResourceTypeArray;
+  resDesc.res.array.array = m_atlas;
+
+  cudaTextureDesc texDesc;
+  std::memset(&texDesc, 0, sizeof(texDesc));
+  texDesc.addressMode[0] = cudaAddressModeClamp;
+  texDesc.addressMode[1] = cudaAddressModeClamp;
+  texDesc.addressMode[2] = cudaAddressModeClamp;
+  texDesc.filterMode = m_params.filter == "nearest" ? cudaFilterModePoint
+                                                    : cudaFilterModeLinear;
+  texDesc.readMode = cudaReadModeElementType;
+  texDesc.normalizedCoords = 0;
+
+  cudaCreateTextureObject(&m_textureObject, &resDesc, &texDesc, nullptr);
+
+  // Coarsest level, which samples fall back to until finer bricks are loaded //
+
+  const size_t brickVoxels = size_t(m_params.brickSize) + 1;
+  m_brickValues.resize(brickVoxels * brickVoxels * brickVoxels);
+
+  m_usedBricks.assign(layout.numBricks(), 0);
+  m_usedBricksBuffer.upload(m_usedBricks);
+
+  m_cache->update();
+  m_pageTable.upload(m_cache->pageTable());
+
+  initGrid();
+
+  upload();
+}
+
+box3 StreamedRegularField::bounds() const
+{
+  if (!isValid())
+    return {box3(vec3(0.f), vec3(1.f))};
+  return box3(m_params.origin,
+      m_params.origin + (vec3(m_params.dims) - 1.f) * m_params.spacing);
+}
+
+float StreamedRegularField::stepSize() const
+{
+  return glm::compMin(m_params.spacing / 2.f);
+}
+
+bool StreamedRegularField::isValid() const
+{
+  return m_cache != nullptr;
+}
+
+bool StreamedRegularField::updateStreamedData()
+{
+  if (!isValid())
+    return false;
+
+  m_usedBricksBuffer.download(m_usedBricks.data(), m_usedBricks.size());
+
+  // Only bricks of the finest level are marked by sampling
+  const auto &layout = m_cache->layout();
+  const uint32_t numFinest = numBricks(layout.levelBricks(0));
+
+  bool sampled = false;
+  for (uint32_t b = 0; b < numFinest; b++) {
+    if (m_usedBricks[b]) {
+      m_cache->markUsed(b);
+      sampled = true;
+    }
+  }
+
+  // Bricks only age while frames sample the field
+  if (!sampled)
+    return false;
+
+  std::fill(m_usedBricks.begin(), m_usedBricks.end(), 0);
+  m_usedBricksBuffer.upload(m_usedBricks);
+
+  const size_t loaded = m_cache->update();
+  if (loaded == 0)
+    return false;
+
+  m_pageTable.upload(m_cache->pageTable());
+
+  reportMessage(ANARI_SEVERITY_DEBUG,
+      "streamed in %zu bricks (%u of %u cache slots used)",
+      loaded,
+      m_cache->numResident(),
+      m_cache->numSlots());
+
+  return true;
+}
+
+SpatialFieldGPUData StreamedRegularField::gpuData() const
+{
+  StreamedRegularData srf;
+  srf.texObj = m_textureObject;
+  srf.pageTable = (const uint32_t *)m_pageTable.ptr();
+  srf.usedBricks = (uint8_t *)m_usedBricksBuffer.ptr();
+  srf.dims = m_params.dims;
+  srf.atlasSlots = m_atlasSlots;
+  srf.brickSize = m_params.brickSize;
+  srf.numLevels = m_cache->layout().numLevels();
+  srf.origin = m_params.origin;
+  srf.spacing = m_params.spacing;
+  srf.invSpacing = vec3(1.f) / m_params.spacing;
+
+  SpatialFieldGPUData sf;
+  sf.type = SpatialFieldType::STREAMED_REGULAR;
+  sf.data.streamedRegular = srf;
+  sf.grid = m_uniformGrid.gpuData();
+  return sf;
+}
+
+void StreamedRegularField::cleanup()
+{
+  if (m_atlas) {
+    cudaDestroyTextureObject(m_textureObject);
+    cudaFreeArray(m_atlas);
+  }
+  m_textureObject = {};
+  m_atlas = {};
+  m_cache.reset();
+  if (m_file.is_open())
+    m_file.close();
+  m_file.clear();
+  m_pageTable.reset();
+  m_usedBricksBuffer.reset();
+  m_uniformGrid.cleanup();
+}
+
+void StreamedRegularField::initGrid()
+{
+  const auto dims = m_params.dims;
+  ivec3 gridDims(iDivUp(dims.x, 16), iDivUp(dims.y, 16), iDivUp(dims.z, 16));
+  m_uniformGrid.init(gridDims, bounds());
+
+  // Bricks can't be scanned for their values before they are loaded, so all
+  // macrocells share the value range of the field. Without one from the
+  // application, no macrocell can be skipped.
+  const box1 valueRange = getParam<box1>("valueRange", box1(-1e30f, 1e30f));
+  std::vector<box1> valueRanges(
+      size_t(gridDims.x) * gridDims.y * gridDims.z, valueRange);
+  cudaMemcpy(m_uniformGrid.m_valueRanges,
+      valueRanges.data(),
+      valueRanges.size() * sizeof(box1),
+      cudaMemcpyHostToDevice);
+  countUploadBytes(valueRanges.size() * sizeof(box1));
+}
+
+void StreamedRegularField::readBrick(
+    uint32_t level, uvec3 origin, uvec3 dims, float *values)
+{
+  if (m_params.callback) {
+    m_params.callback(m_params.callbackUserData,
+        level,
+        glm::value_ptr(origin),
+        glm::value_ptr(dims),
+        values);
+    return;
+  }
+
+  // Whole rows of voxels are read from the file and decimated to the level
+  const size_t stride = size_t(1) << level;
+  const size_t elementSize = anari::sizeOf(m_params.format);
+  const size_t rowLength = (dims.x - 1) * stride + 1;
+  m_fileRow.resize(rowLength * elementSize);
+  m_fileRowValues.resize(rowLength);
+
+  const auto &volumeDims = m_params.dims;
+  for (uint32_t z = 0; z < dims.z; z++) {
+    for (uint32_t y = 0; y < dims.y; y++) {
+      const size_t vx = origin.x * stride;
+      const size_t vy = (origin.y + y) * stride;
+      const size_t vz = (origin.z + z) * stride;
+      const size_t voxel = (vz * volumeDims.y + vy) * volumeDims.x + vx;
+
+      m_file.seekg(m_params.fileOffset + voxel * elementSize);
+      m_file.read((char *)m_fileRow.data(), m_fileRow.size());
+      convertFieldData(m_params.format,
+          m_fileRow.data(),
+          rowLength,
+          m_fileRowValues.data());
+
+      float *row = values + (size_t(z) * dims.y + y) * dims.x;
+      for (uint32_t x = 0; x < dims.x; x++)
+        row[x] = m_fileRowValues[x * stride];
+    }
+  }
+
+  if (!m_file) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "'%s' is too small for the 'dimensions' of streamedRegular spatial "
+        "field",
+        m_params.filename.c_str());
+    m_file.clear();
+  }
+}
+
+// BrickLoader definitions ////////////////////////////////////////////////////
+
+void StreamedRegularField::BrickLoader::load(uint32_t brick, uint32_t slot)
+{
+  const auto &layout = field->m_cache->layout();
+  const uint32_t level = layout.levelOf(brick);
+  const uvec3 dims = layout.brickDims(brick);
+
+  float *values = field->m_brickValues.data();
+  field->readBrick(level, layout.brickOrigin(brick), dims, values);
+
+  const uvec3 atlasOrigin =
+      brickAtlasOrigin(slot, field->m_atlasSlots, layout.brickSize());
+
+  cudaMemcpy3DParms copyParams;
+  std::memset(&copyParams, 0, sizeof(copyParams));
+  copyParams.srcPtr =
+      make_cudaPitchedPtr(values, dims.x * sizeof(float), dims.x, dims.y);
+  copyParams.dstArray = field->m_atlas;
+  copyParams.dstPos = make_cudaPos(atlasOrigin.x, atlasOrigin.y, atlasOrigin.z);
+  copyParams.extent = make_cudaExtent(dims.x, dims.y, dims.z);
+  copyParams.kind = cudaMemcpyHostToDevice;
+  cudaMemcpy3D(&copyParams);
+  countUploadBytes(size_t(dims.x) * dims.y * dims.z * sizeof(float));
+}
+
+} // namespace visrtx
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "scene/volume/spatial_field/SpatialField.h"
+#include "utility/BrickCache.h"
+#include "utility/DeviceBuffer.h"
+// VisRTX
+#include "anari/ext/visrtx/visrtx.h"
+// std
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace visrtx {
+
+// Structured regular field whose voxels are loaded in bricks on demand, from
+// an application callback or a raw file, into a fixed size cache on the GPU
+struct StreamedRegularField : public SpatialField
+{
+  StreamedRegularField(DeviceGlobalState *d);
+  ~StreamedRegularField();
+
+  void commitObject() override;
+
+  box3 bounds() const override;
+  float stepSize() const override;
+
+  bool isValid() const override;
+
+  bool updateStreamedData() override;
+
+ private:
+  SpatialFieldGPUData gpuData() const override;
+  void cleanup();
+
+  void initGrid();
+
+  // Reads bricks for the cache and copies them into its slot in the atlas
+  struct BrickLoader
+  {
+    StreamedRegularField *field{nullptr};
+    void load(uint32_t brick, uint32_t slot);
+  };
+
+  void readBrick(uint32_t level, uvec3 origin, uvec3 dims, float *values);
+
+  struct Parameters
+  {
+    uvec3 dims;
+    vec3 origin;
+    vec3 spacing;
+    std::string filter;
+    VisRTXBrickCallback callback{nullptr};
+    const void *callbackUserData{nullptr};
+    std::string filename;
+    ANARIDataType format{ANARI_FLOAT32};
+    uint64_t fileOffset{0};
+    uint32_t brickSize{32};
+    uint32_t cacheSize{512};
+    uint32_t loadsPerFrame{64};
+  } m_params;
+
+  BrickLoader m_loader;
+  std::unique_ptr<BrickCache<BrickLoader>> m_cache;
+  uvec3 m_atlasSlots{0u};
+
+  std::ifstream m_file;
+  std::vector<uint8_t> m_fileRow;
+  std::vector<float> m_fileRowValues;
+  std::vector<float> m_brickValues;
+  std::vector<uint8_t> m_usedBricks;
+
+  cudaArray_t m_atlas{};
+  cudaTextureObject_t m_textureObject{};
+  DeviceBuffer m_pageTable;
+  DeviceBuffer m_usedBricksBuffer;
+};
+
+} // namespace visrtx
@@ -32,105 +32,108 @@
 #include "StructuredRegularField.h"
 // std
 #include <algorithm>
-#include <limits>
+#include <cstring>
 #include <vector>
 
 namespace visrtx {
 
 // Helper functions ///////////////////////////////////////////////////////////
 
-template <typename FROM_T, typename TO_T = float>
-static void convertElementsNormalized(
-    const void *_begin, size_t size, TO_T *output)
+static std::vector<float> makeFloatStagingBuffer(Array3D &array)
 {
-  auto toFloatNormalized = [](auto c) {
-    return TO_T(c / float(std::numeric_limits<FROM_T>::max()));
-  };
-  auto *begin = (const FROM_T *)_begin;
-  std::transform(begin, begin + size, output, toFloatNormalized);
+  std::vector<float> stagingBuffer(array.totalSize());
+  convertFieldData(array.elementType(),
+      array.data(),
+      stagingBuffer.size(),
+      stagingBuffer.data());
+  return stagingBuffer;
 }
 
-template <typename FROM_T, typename TO_T = float>
-static void convertElements(const void *_begin, size_t size, TO_T *output)
+// Upload a field's values as floats, allocating 'array' if needed. Copies on
+// 'stream' finish before returning, as the staging buffer is freed after.
+static void uploadFieldData(
+    Array3D &data, cudaArray_t &array, CUstream stream = {})
 {
-  auto toFloat = [](auto c) { return TO_T(c); };
-  auto *begin = (const FROM_T *)_begin;
-  std::transform(begin, begin + size, output, toFloat);
-}
+  const auto dims = data.size();
 
-static std::vector<float> makeFloatStagingBuffer(Array3D &array)
-{
-  const void *input = array.data();
-  size_t size = array.totalSize();
-
-  std::vector<float> stagingBuffer(size);
-
-  ANARIDataType format = array.elementType();
-
-  switch (format) {
-  case ANARI_UINT8:
-    convertElements<uint8_t>(input, size, stagingBuffer.data());
-    break;
-  case ANARI_INT16:
-    convertElements<int16_t>(input, size, stagingBuffer.data());
-    break;
-  case ANARI_UINT16:
-    convertElements<uint16_t>(input, size, stagingBuffer.data());
-    break;
-  case ANARI_UFIXED8:
-    convertElementsNormalized<uint8_t>(input, size, stagingBuffer.data());
-    break;
-  case ANARI_FIXED16:
-    convertElementsNormalized<int16_t>(input, size, stagingBuffer.data());
-    break;
-  case ANARI_UFIXED16:
-    convertElementsNormalized<uint16_t>(input, size, stagingBuffer.data());
-    break;
-  case ANARI_FLOAT32:
-    convertElements<float>(input, size, stagingBuffer.data());
-    break;
-  case ANARI_FLOAT64:
-    convertElements<double>(input, size, stagingBuffer.data());
-    break;
-  default:
-    break;
+  if (!array) {
+    auto desc = cudaCreateChannelDesc(
+        sizeof(float) * 8, 0, 0, 0, cudaChannelFormatKindFloat);
+    cudaMalloc3DArray(&array, &desc, make_cudaExtent(dims.x, dims.y, dims.z));
   }
 
-  return stagingBuffer;
+  std::vector<float> stagingBuffer;
+  if (data.elementType() != ANARI_FLOAT32)
+    stagingBuffer = makeFloatStagingBuffer(data);
+
+  cudaMemcpy3DParms copyParams;
+  std::memset(&copyParams, 0, sizeof(copyParams));
+  copyParams.srcPtr = make_cudaPitchedPtr(stagingBuffer.empty()
+          ? const_cast<void *>(data.data())
+          : stagingBuffer.data(),
+      dims.x * sizeof(float),
+      dims.x,
+      dims.y);
+  copyParams.dstArray = array;
+  copyParams.extent = make_cudaExtent(dims.x, dims.y, dims.z);
+  copyParams.kind = cudaMemcpyHostToDevice;
+
+  if (stream) {
+    cudaMemcpy3DAsync(&copyParams, stream);
+    cudaStreamSynchronize(stream);
+  } else
+    cudaMemcpy3D(&copyParams);
+  countUploadBytes(size_t(dims.x) * dims.y * dims.z * sizeof(float));
 }
 
-static bool validFieldDataType(ANARIDataType format)
+static cudaTextureObject_t makeFieldTexture(
+    cudaArray_t array, const std::string &filter)
 {
-  switch (format) {
-  case ANARI_UINT8:
-  case ANARI_INT16:
-  case ANARI_UINT16:
-  case ANARI_UFIXED8:
-  case ANARI_FIXED16:
-  case ANARI_UFIXED16:
-  case ANARI_FLOAT32:
-  case ANARI_FLOAT64:
-    return true;
-  default:
-    break;
-  }
-  return false;
+  cudaResourceDesc resDesc;
+  std::memset(&resDesc, 0, sizeof(resDesc));
+  resDesc.resType = cudaResourceTypeArray;
+  resDesc.res.array.array = array;
+
+  cudaTextureDesc texDesc;
+  std::memset(&texDesc, 0, sizeof(texDesc));
+  texDesc.addressMode[0] = cudaAddressModeClamp;
+  texDesc.addressMode[1] = cudaAddressModeClamp;
+  texDesc.addressMode[2] = cudaAddressModeClamp;
+  texDesc.filterMode =
+      filter == "nearest" ? cudaFilterModePoint : cudaFilterModeLinear;
+  texDesc.readMode = cudaReadModeElementType;
+  texDesc.normalizedCoords = 1;
+
+  cudaTextureObject_t textureObject{};
+  cudaCreateTextureObject(&textureObject, &resDesc, &texDesc, nullptr);
+  return textureObject;
 }
 
 // StructuredRegularField definitions /////////////////////////////////////////
 
 StructuredRegularField::StructuredRegularField(DeviceGlobalState *d)
     : SpatialField(d)
-{}
+{
+  m_timestepUploader.field = this;
+}
 
 StructuredRegularField::~StructuredRegularField()
 {
   cleanup();
+  cleanupTimesteps();
+  if (m_prefetchStream)
+    cudaStreamDestroy(m_prefetchStream);
 }
 
-void StructuredRegularField::commit()
+void StructuredRegularField::commitObject()
 {
+  if (auto *timesteps = getParamObject<ObjectArray>("timesteps")) {
+    commitTimesteps(timesteps);
+    return;
+  }
+
   cleanup();
+  cleanupTimesteps();
 
   m_params.origin = getParam<vec3>("origin", vec3(0.f));
   m_params.spacing = getParam<vec3>("spacing", vec3(1.f));
@@ -154,47 +157,9 @@ void StructuredRegularField::commit()
   }
 
   m_params.data->addCommitObserver(this);
-  const auto dims = m_params.data->size();
 
-  std::vector<float> stagingBuffer;
-  if (format != ANARI_FLOAT32)
-    stagingBuffer = makeFloatStagingBuffer(*m_params.data);
-
-  auto desc = cudaCreateChannelDesc(
-      sizeof(float) * 8, 0, 0, 0, cudaChannelFormatKindFloat);
-  cudaMalloc3DArray(
-      &m_cudaArray, &desc, make_cudaExtent(dims.x, dims.y, dims.z));
-
-  cudaMemcpy3DParms copyParams;
-  std::memset(&copyParams, 0, sizeof(copyParams));
-  copyParams.srcPtr = make_cudaPitchedPtr(stagingBuffer.empty()
-          ? const_cast<void *>(m_params.data->data())
-          : stagingBuffer.data(),
-      dims.x * sizeof(float),
-      dims.x,
-      dims.y);
-  copyParams.dstArray = m_cudaArray;
-  copyParams.extent = make_cudaExtent(dims.x, dims.y, dims.z);
-  copyParams.kind = cudaMemcpyHostToDevice;
-
-  cudaMemcpy3D(&copyParams);
-
-  cudaResourceDesc resDesc;
-  std::memset(&resDesc, 0, sizeof(resDesc));
-  resDesc.resType = cudaResourceTypeArray;
-  resDesc.res.array.array = m_cudaArray;
-
-  cudaTextureDesc texDesc;
-  std::memset(&texDesc, 0, sizeof(texDesc));
-  texDesc.addressMode[0] = cudaAddressModeClamp;
-  texDesc.addressMode[1] = cudaAddressModeClamp;
-  texDesc.addressMode[2] = cudaAddressModeClamp;
-  texDesc.filterMode =
-      m_params.filter == "nearest" ? cudaFilterModePoint : cudaFilterModeLinear;
-  texDesc.readMode = cudaReadModeElementType;
-  texDesc.normalizedCoords = 1;
-
-  cudaCreateTextureObject(&m_textureObject, &resDesc, &texDesc, nullptr);
+  uploadFieldData(*m_params.data, m_cudaArray);
+  m_textureObject = makeFieldTexture(m_cudaArray, m_params.filter);
 
   buildGrid();
 
@@ -237,15 +202,189 @@ SpatialFieldGPUData StructuredRegularField::gpuData() const
 
 void StructuredRegularField::cleanup()
 {
-  if (m_textureObject)
+  // Time series textures belong to their slots
+  if (m_cudaArray) {
     cudaDestroyTextureObject(m_textureObject);
-  if (m_cudaArray)
     cudaFreeArray(m_cudaArray);
+  }
   m_textureObject = {};
   m_cudaArray = {};
-  if (m_params.data)
+  if (m_params.data && !m_params.timesteps)
     m_params.data->removeCommitObserver(this);
+  m_params.data = nullptr;
   m_uniformGrid.cleanup();
 }
 
+void StructuredRegularField::commitTimesteps(ObjectArray *timesteps)
+{
+  cleanup();
+
+  const auto filter = getParamString("filter", "linear");
+  const bool reuseSlots = m_prefetcher && timesteps == m_params.timesteps.ptr
+      && filter == m_params.filter && !timestepsChanged();
+
+  m_params.origin = getParam<vec3>("origin", vec3(0.f));
+  m_params.spacing = getParam<vec3>("spacing", vec3(1.f));
+  m_params.filter = filter;
+
+  if (!reuseSlots && !setupTimesteps(timesteps))
+    return;
+
+  const size_t numSteps = m_prefetcher->numSteps();
+  const size_t step =
+      std::min<size_t>(getParam<uint32_t>("timestep", 0), numSteps - 1);
+
+  // Switching to a prefetched step only swaps the texture
+  const size_t slot = m_prefetcher->select(step);
+  m_params.data = timestepData(step);
+  m_textureObject = m_timestepSlots[slot].textureObject;
+
+  buildGrid();
+
+  upload();
+}
+
+bool StructuredRegularField::setupTimesteps(ObjectArray *timesteps)
+{
+  cleanupTimesteps();
+
+  if (timesteps->elementType() != ANARI_ARRAY3D
+      || timesteps->totalSize() == 0) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "'timesteps' on structuredRegular spatial field must be a non-empty "
+        "array of ARRAY3D");
+    return false;
+  }
+
+  m_params.timesteps = timesteps;
+  const size_t numSteps = timesteps->totalSize();
+
+  for (size_t i = 0; i < numSteps; i++) {
+    auto *data = timestepData(i);
+    if (!data || !validFieldDataType(data->elementType())
+        || data->size() != timestepData(0)->size()) {
+      reportMessage(ANARI_SEVERITY_WARNING,
+          "timestep %zu of structuredRegular spatial field is missing, of an "
+          "invalid type or differs in size from the first one",
+          i);
+      m_params.timesteps = nullptr;
+      return false;
+    }
+  }
+
+  timesteps->addCommitObserver(this);
+  for (size_t i = 0; i < numSteps; i++)
+    timestepData(i)->addCommitObserver(this);
+
+  if (!m_prefetchStream)
+    cudaStreamCreateWithFlags(&m_prefetchStream, cudaStreamNonBlocking);
+  cudaGetDevice(&m_cudaDevice);
+
+  m_prefetcher = std::make_unique<TimestepPrefetcher<TimestepUploader>>(
+      m_timestepUploader,
+      numSteps,
+      getParam<uint32_t>("timestepSlots", 2),
+      getParam<uint32_t>("timestepLookahead", 1));
+
+  m_timestepSlots = std::vector<TimestepSlot>(m_prefetcher->numSlots());
+  for (auto &slot : m_timestepSlots) {
+    cudaEventCreateWithFlags(&slot.released, cudaEventDisableTiming);
+    cudaEventCreateWithFlags(&slot.uploaded, cudaEventDisableTiming);
+  }
+
+  m_timestepsUploaded = helium::newTimeStamp();
+
+  return true;
+}
+
+bool StructuredRegularField::timestepsChanged() const
+{
+  if (m_params.timesteps->lastUpdated() > m_timestepsUploaded)
+    return true;
+  for (size_t i = 0; i < m_prefetcher->numSteps(); i++) {
+    if (timestepData(i)->lastUpdated() > m_timestepsUploaded)
+      return true;
+  }
+  return false;
+}
+
+Array3D *StructuredRegularField::timestepData(size_t step) const
+{
+  auto **handles = m_params.timesteps->handlesBegin(false);
+  return dynamic_cast<Array3D *>((helium::BaseObject *)handles[step]);
+}
+
+void StructuredRegularField::cleanupTimesteps()
+{
+  for (auto &slot : m_timestepSlots) {
+    if (slot.pendingUpload.valid())
+      slot.pendingUpload.get();
+    if (slot.array) {
+      cudaDestroyTextureObject(slot.textureObject);
+      cudaFreeArray(slot.array);
+    }
+    cudaEventDestroy(slot.released);
+    cudaEventDestroy(slot.uploaded);
+  }
+  m_timestepSlots.clear();
+
+  if (m_params.timesteps) {
+    for (size_t i = 0; m_prefetcher && i < m_prefetcher->numSteps(); i++)
+      timestepData(i)->removeCommitObserver(this);
+    m_params.timesteps->removeCommitObserver(this);
+  }
+
+  m_prefetcher.reset();
+  m_params.timesteps = nullptr;
+}
+
+// TimestepUploader definitions ///////////////////////////////////////////////
+
+void StructuredRegularField::TimestepUploader::upload(
+    size_t step, size_t slotID, bool prefetch)
+{
+  auto &slot = field->m_timestepSlots[slotID];
+  if (slot.pendingUpload.valid())
+    slot.pendingUpload.get();
+
+  auto *data = field->timestepData(step);
+  const bool newArray = !slot.array;
+
+  if (!prefetch) {
+    uploadFieldData(*data, slot.array);
+  } else {
+    // Frames still rendering the slot's previous step are queued on the
+    // device stream, so the copy waits for them
+    auto &state = *field->deviceState();
+    cudaEventRecord(slot.released, state.stream);
+
+    if (newArray) {
+      auto desc = cudaCreateChannelDesc(
+          sizeof(float) * 8, 0, 0, 0, cudaChannelFormatKindFloat);
+      const auto dims = data->size();
+      cudaMalloc3DArray(
+          &slot.array, &desc, make_cudaExtent(dims.x, dims.y, dims.z));
+    }
+
+    slot.pendingUpload = std::async(std::launch::async,
+        [f = field, data, &slot, cudaDevice = field->m_cudaDevice]() {
+          cudaSetDevice(cudaDevice);
+          cudaStreamWaitEvent(f->m_prefetchStream, slot.released, 0);
+          uploadFieldData(*data, slot.array, f->m_prefetchStream);
+          cudaEventRecord(slot.uploaded, f->m_prefetchStream);
+        });
+  }
+
+  if (newArray)
+    slot.textureObject = makeFieldTexture(slot.array, field->m_params.filter);
+}
+
+void StructuredRegularField::TimestepUploader::wait(size_t slotID)
+{
+  auto &slot = field->m_timestepSlots[slotID];
+  if (slot.pendingUpload.valid())
+    slot.pendingUpload.get();
+  cudaStreamWaitEvent(field->deviceState()->stream, slot.uploaded, 0);
+}
+
 } // namespace visrtx
@@ -56,8 +56,8 @@ __global__ void buildGridGPU(
   box3 voxelBounds(grid.worldBounds.lower + vec3(voxelID) * voxelExtend,
       grid.worldBounds.lower + vec3(voxelID) * voxelExtend + voxelExtend);
 
-  // compute the max value of all the cells that can
-  // overlap this voxel; splat out the _max_ over the
+  // compute the value range of all the cells that can
+  // overlap this voxel; splat it out over the
   // overlapping MCs. (that's essentially a box filter)
   vec3 tcs[8] = {(vec3(voxelID) + vec3(-.5f, -.5f, -.5f)) / vec3(dims),
       (vec3(voxelID) + vec3(+.5f, -.5f, -.5f)) / vec3(dims),
@@ -68,10 +68,12 @@ __global__ void buildGridGPU(
       (vec3(voxelID) + vec3(+.5f, +.5f, +.5f)) / vec3(dims),
       (vec3(voxelID) + vec3(-.5f, +.5f, +.5f)) / vec3(dims)};
 
-  float voxelValue = -1e30f;
+  float voxelMin = 1e30f;
+  float voxelMax = -1e30f;
   for (int i = 0; i < 8; ++i) {
     float retval = tex3D<float>(data, tcs[i].x, tcs[i].y, tcs[i].z);
-    voxelValue = fmaxf(voxelValue, retval);
+    voxelMin = fminf(voxelMin, retval);
+    voxelMax = fmaxf(voxelMax, retval);
   }
 
   // find out which MCs we overlap and splat the value out
@@ -87,9 +89,9 @@ __global__ void buildGridGPU(
         const ivec3 mcID(mcx, mcy, mcz);
 #ifdef __CUDA_ARCH__
         atomicMinf(
-            &grid.valueRanges[linearIndex(mcID, grid.dims)].lower, voxelValue);
+            &grid.valueRanges[linearIndex(mcID, grid.dims)].lower, voxelMin);
         atomicMaxf(
-            &grid.valueRanges[linearIndex(mcID, grid.dims)].upper, voxelValue);
+            &grid.valueRanges[linearIndex(mcID, grid.dims)].upper, voxelMax);
 #endif
       }
     }
@@ -32,7 +32,12 @@
 #pragma once
 
 #include "array/Array3D.h"
+#include "array/ObjectArray.h"
 #include "scene/volume/spatial_field/SpatialField.h"
+#include "utility/TimestepPrefetcher.h"
+// std
+#include <future>
+#include <memory>
 
 namespace visrtx {
 
@@ -41,7 +46,7 @@ struct StructuredRegularField : public SpatialField
   StructuredRegularField(DeviceGlobalState *d);
   ~StructuredRegularField();
 
-  void commit() override;
+  void commitObject() override;
 
   box3 bounds() const override;
   float stepSize() const override;
@@ -54,16 +59,49 @@ struct StructuredRegularField : public SpatialField
 
   void buildGrid();
 
+  // Time series (VISRTX_TIME_SERIES) //
+
+  // Uploads steps of the 'timesteps' parameter for the prefetcher
+  struct TimestepUploader
+  {
+    StructuredRegularField *field{nullptr};
+    void upload(size_t step, size_t slot, bool prefetch);
+    void wait(size_t slot);
+  };
+
+  struct TimestepSlot
+  {
+    cudaArray_t array{};
+    cudaTextureObject_t textureObject{};
+    cudaEvent_t released{}; // frames using the slot's previous step are done
+    cudaEvent_t uploaded{};
+    std::future<void> pendingUpload;
+  };
+
+  void commitTimesteps(ObjectArray *timesteps);
+  bool setupTimesteps(ObjectArray *timesteps);
+  bool timestepsChanged() const;
+  Array3D *timestepData(size_t step) const;
+  void cleanupTimesteps();
+
   struct Parameters
   {
     vec3 origin;
     vec3 spacing;
     std::string filter;
-    helium::IntrusivePtr<Array3D> data;
+    helium::IntrusivePtr<Array3D> data; // the current step of a time series
+    helium::IntrusivePtr<ObjectArray> timesteps;
   } m_params;
 
   cudaArray_t m_cudaArray{};
   cudaTextureObject_t m_textureObject{};
+
+  TimestepUploader m_timestepUploader;
+  std::vector<TimestepSlot> m_timestepSlots;
+  std::unique_ptr<TimestepPrefetcher<TimestepUploader>> m_prefetcher;
+  helium::TimeStamp m_timestepsUploaded{0};
+  CUstream m_prefetchStream{};
+  int m_cudaDevice{0};
 };
 
 } // namespace visrtx
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace visrtx {
+
+// An instance whose group is small enough to share a BLAS with others
+struct BLASMergeCandidate
+{
+  uint32_t instance{0}; // index of the instance in the world
+  uint32_t mergeClass{0}; // only candidates of the same class can merge
+  size_t numPrimitives{0};
+  uint32_t numSurfaces{0};
+};
+
+struct BLASMergeSettings
+{
+  size_t primitiveThreshold{1024}; // largest group which gets merged
+  size_t maxPrimitivesPerBLAS{size_t(1) << 22};
+  size_t maxSurfacesPerBLAS{size_t(1) << 16};
+  size_t minInstancesPerBLAS{2};
+};
+
+// Instances sharing one BLAS. Surfaces of each member are concatenated in
+// order, so member 'm' owns the geometry indices (optixGetSbtGASIndex()) in
+// [surfaceOffsets[m], surfaceOffsets[m + 1]) of the merged BLAS.
+struct BLASMergeBatch
+{
+  uint32_t mergeClass{0};
+  std::vector<uint32_t> instances;
+  std::vector<uint32_t> surfaceOffsets{0};
+  size_t numPrimitives{0};
+
+  size_t numSurfaces() const;
+  size_t memberOf(uint32_t surfaceIndex) const;
+  std::vector<uint32_t> surfaceToInstance() const;
+};
+
+// Groups candidates into batches, keeping the order of instances within each
+// merge class. Candidates over the primitive threshold or which would end up
+// alone in a batch are left out, so they keep their own BLAS.
+std::vector<BLASMergeBatch> planBLASMerges(
+    std::vector<BLASMergeCandidate> candidates,
+    const BLASMergeSettings &settings = {});
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline size_t BLASMergeBatch::numSurfaces() const
+{
+  return surfaceOffsets.back();
+}
+
+inline size_t BLASMergeBatch::memberOf(uint32_t surfaceIndex) const
+{
+  auto it = std::upper_bound(
+      surfaceOffsets.begin(), surfaceOffsets.end(), surfaceIndex);
+  return std::distance(surfaceOffsets.begin(), it) - 1;
+}
+
+inline std::vector<uint32_t> BLASMergeBatch::surfaceToInstance() const
+{
+  std::vector<uint32_t> retval(numSurfaces());
+  for (size_t m = 0; m < instances.size(); m++) {
+    std::fill(retval.begin() + surfaceOffsets[m],
+        retval.begin() + surfaceOffsets[m + 1],
+        instances[m]);
+  }
+  return retval;
+}
+
+inline std::vector<BLASMergeBatch> planBLASMerges(
+    std::vector<BLASMergeCandidate> candidates,
+    const BLASMergeSettings &settings)
+{
+  candidates.erase(std::remove_if(candidates.begin(),
+                       candidates.end(),
+                       [&](const BLASMergeCandidate &c) {
+                         return c.numSurfaces == 0
+                             || c.numPrimitives > settings.primitiveThreshold;
+                       }),
+      candidates.end());
+
+  std::stable_sort(candidates.begin(),
+      candidates.end(),
+      [](const BLASMergeCandidate &a, const BLASMergeCandidate &b) {
+        return a.mergeClass < b.mergeClass;
+      });
+
+  std::vector<BLASMergeBatch> batches;
+
+  auto finishBatch = [&]() {
+    if (!batches.empty()
+        && batches.back().instances.size() < settings.minInstancesPerBLAS)
+      batches.pop_back();
+  };
+
+  for (const auto &c : candidates) {
+    const bool fits = !batches.empty()
+        && batches.back().mergeClass == c.mergeClass
+        && batches.back().numPrimitives + c.numPrimitives
+            <= settings.maxPrimitivesPerBLAS
+        && batches.back().numSurfaces() + c.numSurfaces
+            <= settings.maxSurfacesPerBLAS;
+
+    if (!fits) {
+      finishBatch();
+      batches.emplace_back();
+      batches.back().mergeClass = c.mergeClass;
+    }
+
+    auto &b = batches.back();
+    b.instances.push_back(c.instance);
+    b.surfaceOffsets.push_back(uint32_t(b.numSurfaces() + c.numSurfaces));
+    b.numPrimitives += c.numPrimitives;
+  }
+
+  finishBatch();
+
+  return batches;
+}
+
+} // namespace visrtx
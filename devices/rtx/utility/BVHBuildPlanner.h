@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace visrtx {
+
+// Memory needed to build one BVH, as reported by optixAccelComputeMemoryUsage()
+struct BVHBuildSizes
+{
+  size_t tempBytes{0};
+  size_t outputBytes{0};
+};
+
+// Placement of consecutive BVH builds in a single device allocation. Builds
+// issued back to back on one stream run in order, so they share one temp
+// region. Emitted properties are packed so they can be downloaded at once.
+struct BVHBuildBatch
+{
+  size_t begin{0}; // first build in the batch
+  size_t end{0}; // one past the last build in the batch
+  std::vector<size_t> outputOffsets; // one per build
+  size_t tempOffset{0};
+  size_t emitOffset{0}; // 'emitBytes' per build, contiguous
+  size_t arenaBytes{0};
+};
+
+size_t alignUp(size_t value, size_t alignment);
+
+// Splits builds into batches whose arena stays within 'maxArenaBytes'. A
+// build which doesn't fit the limit on its own gets a batch to itself.
+std::vector<BVHBuildBatch> planBVHBuildBatches(
+    const std::vector<BVHBuildSizes> &sizes,
+    size_t emitBytes,
+    size_t alignment,
+    size_t maxArenaBytes);
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline size_t alignUp(size_t value, size_t alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+inline std::vector<BVHBuildBatch> planBVHBuildBatches(
+    const std::vector<BVHBuildSizes> &sizes,
+    size_t emitBytes,
+    size_t alignment,
+    size_t maxArenaBytes)
+{
+  std::vector<BVHBuildBatch> batches;
+
+  size_t outputBytes = 0;
+  size_t tempBytes = 0;
+
+  auto layout = [&](size_t output, size_t temp, size_t numBuilds) {
+    const size_t tempOffset = alignUp(output, alignment);
+    const size_t emitOffset = alignUp(tempOffset + temp, alignment);
+    return alignUp(emitOffset + numBuilds * emitBytes, alignment);
+  };
+
+  auto finishBatch = [&]() {
+    auto &b = batches.back();
+    b.tempOffset = alignUp(outputBytes, alignment);
+    b.emitOffset = alignUp(b.tempOffset + tempBytes, alignment);
+    b.arenaBytes = layout(outputBytes, tempBytes, b.end - b.begin);
+  };
+
+  for (size_t i = 0; i < sizes.size(); i++) {
+    const auto &s = sizes[i];
+    const size_t output = alignUp(outputBytes, alignment) + s.outputBytes;
+    const size_t temp = std::max(tempBytes, s.tempBytes);
+
+    const bool fits = !batches.empty()
+        && layout(output, temp, i + 1 - batches.back().begin)
+            <= maxArenaBytes;
+
+    if (!fits) {
+      if (!batches.empty())
+        finishBatch();
+      batches.emplace_back();
+      batches.back().begin = i;
+      outputBytes = 0;
+      tempBytes = 0;
+    }
+
+    auto &b = batches.back();
+    b.outputOffsets.push_back(alignUp(outputBytes, alignment));
+    b.end = i + 1;
+    outputBytes = b.outputOffsets.back() + s.outputBytes;
+    tempBytes = std::max(tempBytes, s.tempBytes);
+  }
+
+  if (!batches.empty())
+    finishBatch();
+
+  return batches;
+}
+
+} // namespace visrtx
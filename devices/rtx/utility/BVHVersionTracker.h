@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <cstdint>
+
+namespace visrtx {
+
+// Version bookkeeping for acceleration structures which are built while
+// frames keep rendering with the previous ones. Every scene change bumps the
+// latest version, a build captures the latest version when it starts, and a
+// finished build only becomes current when it is swapped in between frames.
+struct BVHVersionTracker
+{
+  uint64_t markChanged();
+  uint64_t beginBuild();
+  void endBuild(uint64_t version);
+  void cancelBuild();
+  bool swap();
+
+  bool building() const;
+  bool ready() const;
+  bool stale() const;
+
+  uint64_t latestVersion() const;
+  uint64_t currentVersion() const;
+
+ private:
+  uint64_t m_latest{0};
+  uint64_t m_building{0};
+  uint64_t m_ready{0};
+  uint64_t m_current{0};
+  bool m_inFlight{false};
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline uint64_t BVHVersionTracker::markChanged()
+{
+  return ++m_latest;
+}
+
+inline uint64_t BVHVersionTracker::beginBuild()
+{
+  m_building = m_latest;
+  m_inFlight = true;
+  return m_building;
+}
+
+inline void BVHVersionTracker::endBuild(uint64_t version)
+{
+  m_inFlight = false;
+  if (version > m_current)
+    m_ready = std::max(m_ready, version);
+}
+
+inline void BVHVersionTracker::cancelBuild()
+{
+  m_inFlight = false;
+}
+
+inline bool BVHVersionTracker::swap()
+{
+  if (!ready())
+    return false;
+  m_current = m_ready;
+  m_ready = 0;
+  return true;
+}
+
+inline bool BVHVersionTracker::building() const
+{
+  return m_inFlight;
+}
+
+inline bool BVHVersionTracker::ready() const
+{
+  return m_ready > m_current;
+}
+
+inline bool BVHVersionTracker::stale() const
+{
+  return m_current < m_latest;
+}
+
+inline uint64_t BVHVersionTracker::latestVersion() const
+{
+  return m_latest;
+}
+
+inline uint64_t BVHVersionTracker::currentVersion() const
+{
+  return m_current;
+}
+
+} // namespace visrtx
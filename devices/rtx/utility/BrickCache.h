@@ -0,0 +1,415 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "gpu/streamedField.h"
+// std
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace visrtx {
+
+// Split of a volume into the bricks of all levels of a streamed field, with
+// the bricks of each level numbered x-fastest after those of finer levels.
+// Levels are added until the coarsest one fits in a single brick.
+struct BrickLayout
+{
+  BrickLayout() = default;
+  BrickLayout(uvec3 dims, uint32_t brickSize);
+
+  uvec3 dims() const;
+  uint32_t brickSize() const;
+  uint32_t numLevels() const;
+  uint32_t numBricks() const;
+
+  uvec3 levelDims(uint32_t level) const;
+  uvec3 levelBricks(uint32_t level) const;
+  uint32_t levelOffset(uint32_t level) const; // ID of its first brick
+
+  uint32_t brickID(uint32_t level, uvec3 brick) const;
+  uint32_t levelOf(uint32_t brick) const;
+  uvec3 brickCoords(uint32_t brick) const; // within its level
+  uint32_t parent(uint32_t brick) const; // BRICK_NOT_RESIDENT if coarsest
+
+  // Voxels held by a brick in the coordinates of its level, including the
+  // overlap with the next brick and clipped to the level
+  uvec3 brickOrigin(uint32_t brick) const;
+  uvec3 brickDims(uint32_t brick) const;
+
+ private:
+  uvec3 m_dims{0u};
+  uint32_t m_brickSize{1};
+  std::vector<uint32_t> m_levelOffsets{0};
+};
+
+// Number of cache slots along each axis of a brick atlas, close to a cube
+uvec3 brickAtlasSlots(uint32_t numSlots);
+
+// Keeps the bricks used by recent frames resident in a fixed number of cache
+// slots, evicting the least recently used ones. The coarsest level is always
+// resident, so sampling can fall back to it while finer bricks are loading.
+//
+// LOADER provides:
+//   void load(uint32_t brick, uint32_t slot); // overwrites 'slot'
+template <typename LOADER>
+struct BrickCache
+{
+  static constexpr uint32_t NONE = BRICK_NOT_RESIDENT;
+
+  BrickCache(LOADER &loader,
+      const BrickLayout &layout,
+      uint32_t numSlots,
+      uint32_t loadsPerFrame = 64);
+
+  // Note that the last frame sampled 'brick', keeping it and its coarser
+  // ancestors resident or requesting them to be loaded
+  void markUsed(uint32_t brick);
+
+  // Load requested bricks, coarser levels first and at most 'loadsPerFrame'
+  // of them (plus the coarsest level on the first call), then start a new
+  // frame. Returns the number of bricks loaded.
+  size_t update();
+
+  uint32_t slotOf(uint32_t brick) const; // NONE if not resident
+  const std::vector<uint32_t> &pageTable() const; // slot of each brick
+  const BrickLayout &layout() const;
+
+  uint32_t numSlots() const;
+  uint32_t numPinned() const;
+  uint32_t numResident() const;
+  size_t numRequested() const;
+
+  size_t loads() const;
+  size_t evictions() const;
+
+ private:
+  bool isPinned(uint32_t brick) const;
+  uint32_t victimSlot() const;
+  void load(uint32_t brick, uint32_t slot);
+
+  LOADER *m_loader{nullptr};
+  BrickLayout m_layout;
+  uint32_t m_loadsPerFrame{64};
+  std::vector<uint32_t> m_pageTable;
+  std::vector<uint32_t> m_slotBrick;
+  std::vector<uint64_t> m_slotLastUse;
+  std::vector<uint8_t> m_requested;
+  std::vector<uint32_t> m_requests;
+  uint64_t m_frame{1};
+  bool m_pinnedLoaded{false};
+  size_t m_loads{0};
+  size_t m_evictions{0};
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+// BrickLayout //
+
+inline BrickLayout::BrickLayout(uvec3 dims, uint32_t brickSize)
+    : m_dims(max(dims, uvec3(1u))), m_brickSize(std::max(brickSize, 1u))
+{
+  m_levelOffsets = {0};
+  for (uint32_t l = 0;; l++) {
+    const uint32_t n = visrtx::numBricks(levelBricks(l));
+    m_levelOffsets.push_back(m_levelOffsets.back() + n);
+    if (n == 1)
+      break;
+  }
+}
+
+inline uvec3 BrickLayout::dims() const
+{
+  return m_dims;
+}
+
+inline uint32_t BrickLayout::brickSize() const
+{
+  return m_brickSize;
+}
+
+inline uint32_t BrickLayout::numLevels() const
+{
+  return uint32_t(m_levelOffsets.size() - 1);
+}
+
+inline uint32_t BrickLayout::numBricks() const
+{
+  return m_levelOffsets.back();
+}
+
+inline uvec3 BrickLayout::levelDims(uint32_t level) const
+{
+  return brickLevelDims(m_dims, level);
+}
+
+inline uvec3 BrickLayout::levelBricks(uint32_t level) const
+{
+  return brickLevelBricks(levelDims(level), m_brickSize);
+}
+
+inline uint32_t BrickLayout::levelOffset(uint32_t level) const
+{
+  return m_levelOffsets[level];
+}
+
+inline uint32_t BrickLayout::brickID(uint32_t level, uvec3 brick) const
+{
+  const uvec3 n = levelBricks(level);
+  return levelOffset(level) + brick.x + n.x * (brick.y + n.y * brick.z);
+}
+
+inline uint32_t BrickLayout::levelOf(uint32_t brick) const
+{
+  auto it = std::upper_bound(
+      m_levelOffsets.begin() + 1, m_levelOffsets.end(), brick);
+  return uint32_t(it - m_levelOffsets.begin() - 1);
+}
+
+inline uvec3 BrickLayout::brickCoords(uint32_t brick) const
+{
+  const uint32_t level = levelOf(brick);
+  const uvec3 n = levelBricks(level);
+  const uint32_t i = brick - levelOffset(level);
+  return uvec3(i % n.x, i / n.x % n.y, i / (n.x * n.y));
+}
+
+inline uint32_t BrickLayout::parent(uint32_t brick) const
+{
+  const uint32_t level = levelOf(brick);
+  if (level + 1 >= numLevels())
+    return BRICK_NOT_RESIDENT;
+  const uvec3 b = min(brickCoords(brick) / 2u, levelBricks(level + 1) - 1u);
+  return brickID(level + 1, b);
+}
+
+inline uvec3 BrickLayout::brickOrigin(uint32_t brick) const
+{
+  return brickCoords(brick) * m_brickSize;
+}
+
+inline uvec3 BrickLayout::brickDims(uint32_t brick) const
+{
+  const uvec3 end = min(brickOrigin(brick) + m_brickSize + 1u,
+      levelDims(levelOf(brick)));
+  return end - brickOrigin(brick);
+}
+
+inline uvec3 brickAtlasSlots(uint32_t numSlots)
+{
+  numSlots = std::max(numSlots, 1u);
+  const auto x = uint32_t(std::ceil(std::cbrt(double(numSlots))));
+  const uint32_t yz = (numSlots + x - 1) / x;
+  const auto y = uint32_t(std::ceil(std::sqrt(double(yz))));
+  const uint32_t z = (yz + y - 1) / y;
+  return uvec3(x, y, z);
+}
+
+// BrickCache //
+
+template <typename LOADER>
+inline BrickCache<LOADER>::BrickCache(LOADER &loader,
+    const BrickLayout &layout,
+    uint32_t numSlots,
+    uint32_t loadsPerFrame)
+    : m_loader(&loader), m_layout(layout), m_loadsPerFrame(loadsPerFrame)
+{
+  // The coarsest level and at least one finer brick need a slot each
+  numSlots = std::max(numSlots, numPinned() + 1);
+  m_pageTable.assign(m_layout.numBricks(), NONE);
+  m_slotBrick.assign(numSlots, NONE);
+  m_slotLastUse.assign(numSlots, 0);
+  m_requested.assign(m_layout.numBricks(), 0);
+}
+
+template <typename LOADER>
+inline void BrickCache<LOADER>::markUsed(uint32_t brick)
+{
+  for (uint32_t b = brick; b != NONE && b < m_pageTable.size();
+       b = m_layout.parent(b)) {
+    const uint32_t slot = m_pageTable[b];
+    if (slot != NONE)
+      m_slotLastUse[slot] = m_frame;
+    else if (!m_requested[b]) {
+      m_requested[b] = 1;
+      m_requests.push_back(b);
+    }
+  }
+}
+
+template <typename LOADER>
+inline size_t BrickCache<LOADER>::update()
+{
+  size_t loaded = 0;
+
+  if (!m_pinnedLoaded) {
+    for (uint32_t b = m_layout.numBricks() - numPinned();
+         b < m_layout.numBricks();
+         b++) {
+      if (m_pageTable[b] == NONE) {
+        load(b, victimSlot());
+        loaded++;
+      }
+    }
+    m_pinnedLoaded = true;
+  }
+
+  // Coarse bricks improve the fallback for the most samples
+  std::sort(m_requests.begin(), m_requests.end(), [&](uint32_t a, uint32_t b) {
+    const uint32_t la = m_layout.levelOf(a);
+    const uint32_t lb = m_layout.levelOf(b);
+    return la != lb ? la > lb : a < b;
+  });
+
+  size_t budget = m_loadsPerFrame;
+  for (uint32_t b : m_requests) {
+    if (budget == 0)
+      break;
+    if (m_pageTable[b] != NONE)
+      continue;
+    const uint32_t slot = victimSlot();
+    if (slot == NONE)
+      break;
+    load(b, slot);
+    loaded++;
+    budget--;
+  }
+
+  // Bricks still needed are requested again by the next frame
+  for (uint32_t b : m_requests)
+    m_requested[b] = 0;
+  m_requests.clear();
+
+  m_frame++;
+
+  return loaded;
+}
+
+template <typename LOADER>
+inline uint32_t BrickCache<LOADER>::slotOf(uint32_t brick) const
+{
+  return brick < m_pageTable.size() ? m_pageTable[brick] : NONE;
+}
+
+template <typename LOADER>
+inline const std::vector<uint32_t> &BrickCache<LOADER>::pageTable() const
+{
+  return m_pageTable;
+}
+
+template <typename LOADER>
+inline const BrickLayout &BrickCache<LOADER>::layout() const
+{
+  return m_layout;
+}
+
+template <typename LOADER>
+inline uint32_t BrickCache<LOADER>::numSlots() const
+{
+  return uint32_t(m_slotBrick.size());
+}
+
+template <typename LOADER>
+inline uint32_t BrickCache<LOADER>::numPinned() const
+{
+  return numBricks(m_layout.levelBricks(m_layout.numLevels() - 1));
+}
+
+template <typename LOADER>
+inline uint32_t BrickCache<LOADER>::numResident() const
+{
+  return uint32_t(std::count_if(m_slotBrick.begin(),
+      m_slotBrick.end(),
+      [](uint32_t b) { return b != NONE; }));
+}
+
+template <typename LOADER>
+inline size_t BrickCache<LOADER>::numRequested() const
+{
+  return m_requests.size();
+}
+
+template <typename LOADER>
+inline size_t BrickCache<LOADER>::loads() const
+{
+  return m_loads;
+}
+
+template <typename LOADER>
+inline size_t BrickCache<LOADER>::evictions() const
+{
+  return m_evictions;
+}
+
+template <typename LOADER>
+inline bool BrickCache<LOADER>::isPinned(uint32_t brick) const
+{
+  return brick >= m_layout.numBricks() - numPinned();
+}
+
+template <typename LOADER>
+inline uint32_t BrickCache<LOADER>::victimSlot() const
+{
+  // Empty slots first, then the least recently used one which the last frame
+  // didn't sample
+  uint32_t victim = NONE;
+  for (uint32_t s = 0; s < m_slotBrick.size(); s++) {
+    const uint32_t held = m_slotBrick[s];
+    if (held == NONE)
+      return s;
+    if (isPinned(held) || m_slotLastUse[s] >= m_frame)
+      continue;
+    if (victim == NONE || m_slotLastUse[s] < m_slotLastUse[victim])
+      victim = s;
+  }
+  return victim;
+}
+
+template <typename LOADER>
+inline void BrickCache<LOADER>::load(uint32_t brick, uint32_t slot)
+{
+  const uint32_t evicted = m_slotBrick[slot];
+  if (evicted != NONE) {
+    m_pageTable[evicted] = NONE;
+    m_evictions++;
+  }
+
+  m_loader->load(brick, slot);
+
+  m_pageTable[brick] = slot;
+  m_slotBrick[slot] = brick;
+  m_slotLastUse[slot] = m_frame;
+  m_loads++;
+}
+
+} // namespace visrtx
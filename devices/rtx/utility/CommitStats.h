@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace visrtx {
+
+// Running total of bytes copied from host to device by DeviceBuffer and the
+// CUDA array upload helpers, which CommitStats samples around each flush
+std::atomic<size_t> &hostToDeviceBytes();
+void countUploadBytes(size_t bytes);
+
+// Accounting of the time spent committing objects during a commit flush.
+// Each commit is timed from objectCommitStarted() to objectCommitted(), so
+// bookkeeping between commits is only part of the flush total. Only the
+// slowest objects are described by name, keeping the cost flat.
+struct CommitStats
+{
+  using Clock = double (*)(); // current time in seconds
+
+  struct ObjectEntry
+  {
+    int type{0};
+    std::string subtype;
+    std::string name;
+    double seconds{0.0};
+  };
+
+  struct TypeEntry
+  {
+    size_t count{0};
+    double seconds{0.0};
+  };
+
+  static double steadyClock();
+
+  CommitStats(Clock clock = &steadyClock, size_t maxSlowest = 10);
+
+  void setMaxSlowest(size_t n);
+
+  void beginFlush();
+  void objectCommitStarted();
+  template <typename DESCRIBE_FCN>
+  void objectCommitted(int type, DESCRIBE_FCN &&describe);
+  void endFlush();
+
+  // Results of the last flush which committed or uploaded anything //
+
+  double flushSeconds() const;
+  size_t numObjects() const;
+  size_t uploadBytes() const;
+  const std::vector<ObjectEntry> &slowestObjects() const; // slowest first
+  const std::map<int, TypeEntry> &typeTotals() const;
+
+ private:
+  struct Results
+  {
+    double flushSeconds{0.0};
+    size_t numObjects{0};
+    size_t uploadBytes{0};
+    std::vector<ObjectEntry> slowest;
+    std::map<int, TypeEntry> types;
+  };
+
+  static bool slower(const ObjectEntry &a, const ObjectEntry &b);
+
+  Clock m_clock{nullptr};
+  size_t m_maxSlowest{10};
+  bool m_inFlush{false};
+  double m_flushStart{0.0};
+  double m_objectStart{-1.0}; // negative when no commit is being timed
+  size_t m_uploadStart{0};
+  Results m_current;
+  Results m_last;
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline std::atomic<size_t> &hostToDeviceBytes()
+{
+  static std::atomic<size_t> bytes{0};
+  return bytes;
+}
+
+inline void countUploadBytes(size_t bytes)
+{
+  hostToDeviceBytes() += bytes;
+}
+
+inline double CommitStats::steadyClock()
+{
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+inline CommitStats::CommitStats(Clock clock, size_t maxSlowest)
+    : m_clock(clock), m_maxSlowest(maxSlowest)
+{}
+
+inline void CommitStats::setMaxSlowest(size_t n)
+{
+  m_maxSlowest = n;
+}
+
+inline void CommitStats::beginFlush()
+{
+  m_current = Results();
+  m_inFlush = true;
+  m_flushStart = m_clock();
+  m_objectStart = -1.0;
+  m_uploadStart = hostToDeviceBytes();
+}
+
+inline void CommitStats::objectCommitStarted()
+{
+  // Objects committed from within another commit count towards the outer one
+  if (m_inFlush && m_objectStart < 0.0)
+    m_objectStart = m_clock();
+}
+
+template <typename DESCRIBE_FCN>
+inline void CommitStats::objectCommitted(int type, DESCRIBE_FCN &&describe)
+{
+  if (!m_inFlush)
+    return;
+
+  const double seconds = m_objectStart < 0.0 ? 0.0 : m_clock() - m_objectStart;
+  m_objectStart = -1.0;
+
+  m_current.numObjects++;
+  auto &t = m_current.types[type];
+  t.count++;
+  t.seconds += seconds;
+
+  // 'slowest' is a min-heap, so the fastest of the slowest objects is first
+  auto &slowest = m_current.slowest;
+  if (m_maxSlowest == 0)
+    return;
+  else if (slowest.size() == m_maxSlowest) {
+    if (seconds <= slowest.front().seconds)
+      return;
+    std::pop_heap(slowest.begin(), slowest.end(), slower);
+    slowest.pop_back();
+  }
+
+  ObjectEntry e;
+  e.type = type;
+  e.seconds = seconds;
+  describe(e);
+  slowest.push_back(std::move(e));
+  std::push_heap(slowest.begin(), slowest.end(), slower);
+}
+
+inline void CommitStats::endFlush()
+{
+  if (!m_inFlush)
+    return;
+
+  m_inFlush = false;
+  m_current.uploadBytes += hostToDeviceBytes() - m_uploadStart;
+
+  if (m_current.numObjects == 0 && m_current.uploadBytes == 0)
+    return;
+
+  m_current.flushSeconds = m_clock() - m_flushStart;
+  std::sort_heap(m_current.slowest.begin(), m_current.slowest.end(), slower);
+  std::swap(m_last, m_current);
+}
+
+inline double CommitStats::flushSeconds() const
+{
+  return m_last.flushSeconds;
+}
+
+inline size_t CommitStats::numObjects() const
+{
+  return m_last.numObjects;
+}
+
+inline size_t CommitStats::uploadBytes() const
+{
+  return m_last.uploadBytes;
+}
+
+inline const std::vector<CommitStats::ObjectEntry> &
+CommitStats::slowestObjects() const
+{
+  return m_last.slowest;
+}
+
+inline const std::map<int, CommitStats::TypeEntry> &CommitStats::typeTotals()
+    const
+{
+  return m_last.types;
+}
+
+inline bool CommitStats::slower(const ObjectEntry &a, const ObjectEntry &b)
+{
+  return a.seconds > b.seconds;
+}
+
+} // namespace visrtx
@@ -30,6 +30,7 @@
  */
 
 #include "CudaImageTexture.h"
+#include "gpu/background.h"
 
 namespace visrtx {
 
@@ -210,6 +211,7 @@ void makeCudaArrayUint8(
       size.x * nc * sizeof(uint8_t),
       size.y,
       cudaMemcpyHostToDevice);
+  countUploadBytes(size_t(size.x) * size.y * nc * sizeof(uint8_t));
 }
 
 void makeCudaArrayFloat(
@@ -291,6 +293,34 @@ void makeCudaArrayFloat(
       size.x * nc * sizeof(float),
       size.y,
       cudaMemcpyHostToDevice);
+  countUploadBytes(size_t(size.x) * size.y * nc * sizeof(float));
+}
+
+void makeCudaMipmappedArrayFloat(
+    cudaMipmappedArray_t &cuArray, const helium::Array &array, uvec2 size)
+{
+  auto nc = numANARIChannels(array.elementType());
+  if (nc == 3)
+    nc = 4;
+
+  if (!cuArray) {
+    auto desc = cudaCreateChannelDesc(nc >= 1 ? 32 : 0,
+        nc >= 2 ? 32 : 0,
+        nc >= 3 ? 32 : 0,
+        nc >= 3 ? 32 : 0,
+        cudaChannelFormatKindFloat);
+    cudaMallocMipmappedArray(&cuArray,
+        &desc,
+        make_cudaExtent(size.x, size.y, 0),
+        numMipLevels(size),
+        cudaArraySurfaceLoadStore);
+  }
+
+  // Only level 0 is staged on the host, the rest is filtered on the GPU
+  cudaArray_t level0 = {};
+  cudaGetMipmappedArrayLevel(&level0, cuArray, 0);
+  makeCudaArrayFloat(level0, array, size);
+  generateCudaMipmaps(cuArray, size);
 }
 
 cudaTextureObject_t makeCudaTextureObject(cudaArray_t cuArray,
@@ -320,4 +350,31 @@ cudaTextureObject_t makeCudaTextureObject(cudaArray_t cuArray,
   return retval;
 }
 
+cudaTextureObject_t makeCudaTextureObject(cudaMipmappedArray_t cuArray,
+    uvec2 size,
+    const std::string &wrap1,
+    const std::string &wrap2)
+{
+  cudaResourceDesc resDesc;
+  memset(&resDesc, 0, sizeof(resDesc));
+  resDesc.resType = cudaResourceTypeMipmappedArray;
+  resDesc.res.mipmap.mipmap = cuArray;
+
+  cudaTextureDesc texDesc;
+  memset(&texDesc, 0, sizeof(texDesc));
+  texDesc.addressMode[0] = stringToAddressMode(wrap1);
+  texDesc.addressMode[1] = stringToAddressMode(wrap2);
+  texDesc.filterMode = cudaFilterModeLinear;
+  texDesc.mipmapFilterMode = cudaFilterModeLinear;
+  texDesc.maxMipmapLevelClamp = float(numMipLevels(size) - 1);
+  texDesc.maxAnisotropy = 16;
+  texDesc.readMode = cudaReadModeElementType;
+  texDesc.normalizedCoords = 1;
+
+  cudaTextureObject_t retval = {};
+  cudaCreateTextureObject(&retval, &resDesc, &texDesc, nullptr);
+
+  return retval;
+}
+
 } // namespace visrtx
\ No newline at end of file
@@ -61,11 +61,21 @@ void makeCudaArrayUint8(
     cudaArray_t &cuArray, const helium::Array &array, uvec2 size);
 void makeCudaArrayFloat(
     cudaArray_t &cuArray, const helium::Array &array, uvec2 size);
+void makeCudaMipmappedArrayFloat(
+    cudaMipmappedArray_t &cuArray, const helium::Array &array, uvec2 size);
+
+// Fill levels 1 and up of a mip-mapped array from its level 0 on the GPU
+// (defined in CudaMipmaps.cu)
+void generateCudaMipmaps(cudaMipmappedArray_t cuArray, uvec2 size);
 
 cudaTextureObject_t makeCudaTextureObject(cudaArray_t cuArray,
     bool readModeNormalizedFloat,
     const std::string &filter,
     const std::string &wrap1 = "clampToEdge",
     const std::string &wrap2 = "clampToEdge");
+cudaTextureObject_t makeCudaTextureObject(cudaMipmappedArray_t cuArray,
+    uvec2 size,
+    const std::string &wrap1 = "clampToEdge",
+    const std::string &wrap2 = "clampToEdge");
 
 } // namespace visrtx
\ No newline at end of file
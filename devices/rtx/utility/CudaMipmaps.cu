@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "CudaImageTexture.h"
+#include "gpu/background.h"
+// std
+#include <vector>
+
+namespace visrtx {
+
+RT_FUNCTION vec4 toVec4(float v)
+{
+  return vec4(v, 0.f, 0.f, 0.f);
+}
+
+RT_FUNCTION vec4 toVec4(float2 v)
+{
+  return vec4(v.x, v.y, 0.f, 0.f);
+}
+
+RT_FUNCTION vec4 toVec4(float4 v)
+{
+  return vec4(v.x, v.y, v.z, v.w);
+}
+
+template <typename T>
+RT_FUNCTION T fromVec4(const vec4 &v)
+{
+  if constexpr (std::is_same_v<T, float>)
+    return v.x;
+  else if constexpr (std::is_same_v<T, float2>)
+    return make_float2(v.x, v.y);
+  else
+    return make_float4(v.x, v.y, v.z, v.w);
+}
+
+// Box filter of the 2x2 source texels under each destination texel, where
+// the last row or column of odd sized levels is reused at the border
+template <typename T>
+__global__ void downsampleGPU(cudaSurfaceObject_t src,
+    uvec2 srcSize,
+    cudaSurfaceObject_t dst,
+    uvec2 dstSize)
+{
+  const uint32_t x = blockIdx.x * blockDim.x + threadIdx.x;
+  const uint32_t y = blockIdx.y * blockDim.y + threadIdx.y;
+
+  if (x >= dstSize.x || y >= dstSize.y)
+    return;
+
+  vec4 sum(0.f);
+  for (uint32_t j = 0; j < 2; j++) {
+    for (uint32_t i = 0; i < 2; i++) {
+      const uint32_t sx = glm::min(2 * x + i, srcSize.x - 1);
+      const uint32_t sy = glm::min(2 * y + j, srcSize.y - 1);
+      sum += toVec4(surf2Dread<T>(src, sx * sizeof(T), sy));
+    }
+  }
+
+  surf2Dwrite(fromVec4<T>(0.25f * sum), dst, x * sizeof(T), y);
+}
+
+template <typename T>
+static void generateMipmaps(cudaMipmappedArray_t cuArray, uvec2 size)
+{
+  auto makeSurface = [&](uint32_t level) {
+    cudaArray_t levelArray = {};
+    cudaGetMipmappedArrayLevel(&levelArray, cuArray, level);
+
+    cudaResourceDesc resDesc;
+    memset(&resDesc, 0, sizeof(resDesc));
+    resDesc.resType = cudaResourceTypeArray;
+    resDesc.res.array.array = levelArray;
+
+    cudaSurfaceObject_t surface = {};
+    cudaCreateSurfaceObject(&surface, &resDesc);
+    return surface;
+  };
+
+  const uint32_t numLevels = numMipLevels(size);
+  std::vector<cudaSurfaceObject_t> surfaces(numLevels);
+  for (uint32_t level = 0; level < numLevels; level++)
+    surfaces[level] = makeSurface(level);
+
+  // Each level is filtered from the previous one, in order on one stream
+  for (uint32_t level = 1; level < numLevels; level++) {
+    const uvec2 srcSize = mipLevelSize(size, level - 1);
+    const uvec2 dstSize = mipLevelSize(size, level);
+
+    const dim3 blockSize(16, 16);
+    const dim3 numBlocks((uint32_t)iDivUp(dstSize.x, blockSize.x),
+        (uint32_t)iDivUp(dstSize.y, blockSize.y));
+    downsampleGPU<T><<<numBlocks, blockSize>>>(
+        surfaces[level - 1], srcSize, surfaces[level], dstSize);
+  }
+
+  cudaDeviceSynchronize();
+
+  for (auto s : surfaces)
+    cudaDestroySurfaceObject(s);
+}
+
+void generateCudaMipmaps(cudaMipmappedArray_t cuArray, uvec2 size)
+{
+  cudaChannelFormatDesc desc;
+  cudaExtent extent;
+  unsigned int flags = 0;
+  cudaArray_t level0 = {};
+  cudaGetMipmappedArrayLevel(&level0, cuArray, 0);
+  cudaArrayGetInfo(&desc, &extent, &flags, level0);
+
+  switch (countCudaChannels(desc)) {
+  case 1:
+    generateMipmaps<float>(cuArray, size);
+    break;
+  case 2:
+    generateMipmaps<float2>(cuArray, size);
+    break;
+  default:
+    generateMipmaps<float4>(cuArray, size);
+    break;
+  }
+}
+
+} // namespace visrtx
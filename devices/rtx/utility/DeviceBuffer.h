@@ -31,6 +31,7 @@
 
 #pragma once
 
+#include "utility/CommitStats.h"
 // cuda
 #include <cuda_runtime.h>
 // std
@@ -54,6 +55,20 @@ struct DeviceBuffer
   template <typename T>
   void download(T *dst, size_t numElements = 1, size_t byteOffsetStart = 0);
 
+  // Stream ordered copies which never allocate, so they can be issued from
+  // background threads: uploads must fit in the reserved bytes, and host memory
+  // must stay valid until 'stream' is synchronized
+  template <typename T>
+  void uploadAsync(const T *src,
+      size_t numElements,
+      cudaStream_t stream,
+      size_t byteOffsetStart = 0);
+  template <typename T>
+  void downloadAsync(T *dst,
+      size_t numElements,
+      cudaStream_t stream,
+      size_t byteOffsetStart = 0);
+
   void *ptr() const;
   size_t bytes() const;
 
@@ -97,6 +112,7 @@ inline void DeviceBuffer::upload(
       src,
       bytesof<T>(numElements),
       cudaMemcpyHostToDevice);
+  countUploadBytes(bytesof<T>(numElements));
 }
 
 template <typename T>
@@ -125,6 +141,49 @@ inline void DeviceBuffer::download(
       cudaMemcpyDeviceToHost);
 }
 
+template <typename T>
+inline void DeviceBuffer::uploadAsync(const T *src,
+    size_t numElements,
+    cudaStream_t stream,
+    size_t byteOffsetStart)
+{
+  static_assert(std::is_trivially_copyable<T>::value);
+
+  if (numElements == 0)
+    return;
+
+  const auto requestedBytes = bytesof<T>(numElements);
+  if ((requestedBytes + byteOffsetStart) > m_bytes)
+    throw std::runtime_error("uploading too much data to DeviceBuffer");
+  cudaMemcpyAsync((uint8_t *)m_ptr + byteOffsetStart,
+      src,
+      requestedBytes,
+      cudaMemcpyHostToDevice,
+      stream);
+  countUploadBytes(requestedBytes);
+}
+
+template <typename T>
+inline void DeviceBuffer::downloadAsync(
+    T *dst, size_t numElements, cudaStream_t stream, size_t byteOffsetStart)
+{
+  static_assert(std::is_trivially_copyable<T>::value);
+
+  if (numElements == 0)
+    return;
+
+  if (!ptr())
+    throw std::runtime_error("downloading from empty DeviceBuffer");
+  const auto requestedBytes = bytesof<T>(numElements);
+  if ((requestedBytes + byteOffsetStart) > m_bytes)
+    throw std::runtime_error("downloading too much data from DeviceBuffer");
+  cudaMemcpyAsync(dst,
+      (uint8_t *)m_ptr + byteOffsetStart,
+      requestedBytes,
+      cudaMemcpyDeviceToHost,
+      stream);
+}
+
 inline void *DeviceBuffer::ptr() const
 {
   return m_ptr;
@@ -56,6 +56,9 @@ struct HostDeviceArray
   void upload();
   void download();
 
+  // Copy the whole array into device memory reserved by resize() on 'stream'
+  void uploadAsync(cudaStream_t stream);
+
   Span<T> hostSpan() const;
   Span<T> deviceSpan() const;
 
@@ -143,6 +146,12 @@ inline void HostDeviceArray<T>::download()
   download(0, size());
 }
 
+template <typename T>
+inline void HostDeviceArray<T>::uploadAsync(cudaStream_t stream)
+{
+  m_deviceBuffer.uploadAsync(m_hostArray.data(), size(), stream);
+}
+
 template <typename T>
 inline Span<T> HostDeviceArray<T>::hostSpan() const
 {
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace visrtx {
+
+// Half-open range of element indices [begin, end)
+struct IndexRange
+{
+  size_t begin{0};
+  size_t end{0};
+};
+
+// Ranges of elements in 'current' which differ from 'previous', including any
+// elements past the end of 'previous'. Ranges separated by at most 'maxGap'
+// unchanged elements are merged so they can be copied together.
+template <typename T>
+std::vector<IndexRange> changedRanges(const T *previous,
+    size_t previousSize,
+    const T *current,
+    size_t currentSize,
+    size_t maxGap = 0);
+
+// Consecutive ranges of at most 'maxRangeSize' elements covering [0, size)
+std::vector<IndexRange> splitRange(size_t size, size_t maxRangeSize);
+
+// Sorted, non-overlapping ranges covering the same elements as 'ranges'.
+// Ranges separated by at most 'maxGap' elements are merged, empty ones dropped.
+std::vector<IndexRange> mergeRanges(
+    std::vector<IndexRange> ranges, size_t maxGap = 0);
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+template <typename T>
+inline std::vector<IndexRange> changedRanges(const T *previous,
+    size_t previousSize,
+    const T *current,
+    size_t currentSize,
+    size_t maxGap)
+{
+  std::vector<IndexRange> ranges;
+
+  auto addChanged = [&](size_t i) {
+    if (!ranges.empty() && i <= ranges.back().end + maxGap)
+      ranges.back().end = i + 1;
+    else
+      ranges.push_back({i, i + 1});
+  };
+
+  const size_t common = std::min(previousSize, currentSize);
+  for (size_t i = 0; i < common; i++) {
+    if (!(previous[i] == current[i]))
+      addChanged(i);
+  }
+
+  if (currentSize > common) {
+    addChanged(common);
+    ranges.back().end = currentSize;
+  }
+
+  return ranges;
+}
+
+inline std::vector<IndexRange> splitRange(size_t size, size_t maxRangeSize)
+{
+  std::vector<IndexRange> ranges;
+  const size_t step = std::max(maxRangeSize, size_t(1));
+  for (size_t begin = 0; begin < size; begin += step)
+    ranges.push_back({begin, std::min(begin + step, size)});
+  return ranges;
+}
+
+inline std::vector<IndexRange> mergeRanges(
+    std::vector<IndexRange> ranges, size_t maxGap)
+{
+  std::sort(ranges.begin(), ranges.end(), [](const auto &a, const auto &b) {
+    return a.begin < b.begin;
+  });
+
+  std::vector<IndexRange> merged;
+  for (auto &r : ranges) {
+    if (r.begin >= r.end)
+      continue;
+    else if (!merged.empty() && r.begin <= merged.back().end + maxGap)
+      merged.back().end = std::max(merged.back().end, r.end);
+    else
+      merged.push_back(r);
+  }
+
+  return merged;
+}
+
+} // namespace visrtx
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include "utility/Parallel.h"
+// std
+#include <cstdint>
+#include <vector>
+
+namespace visrtx {
+
+// OptiX instance records needed by one instance of a world: one surface record
+// per geometry kind in its group (triangles, curves, user) and one volume
+// record, each repeated for every transform
+struct InstanceRecordCounts
+{
+  uint32_t numTransforms{1};
+  uint32_t numSurfaceKinds{0};
+  bool hasVolumes{false};
+  bool merged{false}; // surfaces are placed by a shared merged BLAS instead
+};
+
+struct InstanceRecordTotals
+{
+  size_t numSurfaceRecords{0};
+  size_t numVolumeRecords{0};
+};
+
+// Fill 'surfaceOffsets' and 'volumeOffsets' with the index of the first record
+// of each of the 'numInstances' instances, plus the total at the end, so each
+// instance can write its records independently. 'countsOf(i)' returns the
+// InstanceRecordCounts of instance 'i' and is called concurrently.
+template <typename FCN>
+InstanceRecordTotals layoutInstanceRecords(size_t numInstances,
+    FCN &&countsOf,
+    std::vector<uint32_t> &surfaceOffsets,
+    std::vector<uint32_t> &volumeOffsets,
+    size_t minGrainSize = 4096);
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+template <typename FCN>
+inline InstanceRecordTotals layoutInstanceRecords(size_t numInstances,
+    FCN &&countsOf,
+    std::vector<uint32_t> &surfaceOffsets,
+    std::vector<uint32_t> &volumeOffsets,
+    size_t minGrainSize)
+{
+  surfaceOffsets.resize(numInstances + 1);
+  volumeOffsets.resize(numInstances + 1);
+  surfaceOffsets[numInstances] = 0;
+  volumeOffsets[numInstances] = 0;
+
+  parallelFor(
+      numInstances,
+      [&](size_t i) {
+        const InstanceRecordCounts c = countsOf(i);
+        surfaceOffsets[i] = c.merged ? 0 : c.numTransforms * c.numSurfaceKinds;
+        volumeOffsets[i] = c.numTransforms * uint32_t(c.hasVolumes);
+      },
+      minGrainSize);
+
+  InstanceRecordTotals totals;
+  totals.numSurfaceRecords = parallelExclusiveScan(
+      surfaceOffsets.data(), surfaceOffsets.size(), minGrainSize);
+  totals.numVolumeRecords = parallelExclusiveScan(
+      volumeOffsets.data(), volumeOffsets.size(), minGrainSize);
+  return totals;
+}
+
+} // namespace visrtx
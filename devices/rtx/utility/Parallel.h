@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace visrtx {
+
+// Number of contiguous chunks used to split 'n' items of work, keeping each
+// chunk at least 'minGrainSize' items so small inputs stay on one thread
+size_t numParallelChunks(size_t n, size_t minGrainSize);
+
+// Invoke f(i) for every i in [0, n), with disjoint contiguous index ranges
+// processed concurrently
+template <typename FCN>
+void parallelFor(size_t n, FCN &&f, size_t minGrainSize = 4096);
+
+// In-place exclusive prefix sum over [data, data + n), returning the total
+template <typename T>
+T parallelExclusiveScan(T *data, size_t n, size_t minGrainSize = 4096);
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+namespace detail {
+
+template <typename FCN>
+inline void parallelForChunks(size_t n, size_t numChunks, FCN &&f)
+{
+  if (numChunks <= 1) {
+    if (n > 0)
+      f(size_t(0), size_t(0), n);
+    return;
+  }
+
+  const size_t chunkSize = (n + numChunks - 1) / numChunks;
+  auto chunkRange = [&](size_t c) {
+    return std::make_pair(std::min(c * chunkSize, n),
+        std::min((c + 1) * chunkSize, n));
+  };
+
+  std::vector<std::future<void>> tasks;
+  tasks.reserve(numChunks - 1);
+  for (size_t c = 1; c < numChunks; c++) {
+    auto r = chunkRange(c);
+    tasks.push_back(std::async(
+        std::launch::async, [&f, c, r]() { f(c, r.first, r.second); }));
+  }
+
+  auto r = chunkRange(0);
+  f(size_t(0), r.first, r.second);
+
+  for (auto &t : tasks)
+    t.get();
+}
+
+} // namespace detail
+
+inline size_t numParallelChunks(size_t n, size_t minGrainSize)
+{
+  const size_t numThreads =
+      std::max(size_t(1), size_t(std::thread::hardware_concurrency()));
+  const size_t maxChunks =
+      std::max(size_t(1), n / std::max(minGrainSize, size_t(1)));
+  return std::min(numThreads, maxChunks);
+}
+
+template <typename FCN>
+inline void parallelFor(size_t n, FCN &&f, size_t minGrainSize)
+{
+  detail::parallelForChunks(n,
+      numParallelChunks(n, minGrainSize),
+      [&](size_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+          f(i);
+      });
+}
+
+template <typename T>
+inline T parallelExclusiveScan(T *data, size_t n, size_t minGrainSize)
+{
+  const size_t numChunks = numParallelChunks(n, minGrainSize);
+  std::vector<T> chunkSums(numChunks + 1, T(0));
+
+  // Sum each chunk, scan the chunk sums, then scan each chunk from its base
+  detail::parallelForChunks(
+      n, numChunks, [&](size_t c, size_t begin, size_t end) {
+        T sum(0);
+        for (size_t i = begin; i < end; i++)
+          sum += data[i];
+        chunkSums[c] = sum;
+      });
+
+  T total(0);
+  for (auto &s : chunkSums) {
+    const T v = s;
+    s = total;
+    total += v;
+  }
+
+  detail::parallelForChunks(
+      n, numChunks, [&](size_t c, size_t begin, size_t end) {
+        T sum = chunkSums[c];
+        for (size_t i = begin; i < end; i++) {
+          const T v = data[i];
+          data[i] = sum;
+          sum += v;
+        }
+      });
+
+  return total;
+}
+
+} // namespace visrtx
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace visrtx {
+
+// Keeps a window of the steps of a time series resident in a fixed number of
+// slots, so playback switches between steps without waiting for uploads.
+// Selecting a step uploads it right away only if it isn't resident (a miss),
+// then prefetches the steps which follow in the direction of playback.
+//
+// BACKEND provides:
+//   void upload(size_t step, size_t slot, bool prefetch); // overwrites 'slot'
+//   void wait(size_t slot); // orders use of 'slot' after its last upload
+template <typename BACKEND>
+struct TimestepPrefetcher
+{
+  static constexpr size_t NONE = ~size_t(0);
+
+  TimestepPrefetcher(BACKEND &backend,
+      size_t numSteps,
+      size_t numSlots = 2,
+      size_t lookahead = 1);
+
+  // Make 'step' current, returning the slot which holds it
+  size_t select(size_t step);
+
+  // Forget what all slots hold, as after the steps' data changed
+  void invalidate();
+
+  size_t slotOf(size_t step) const; // NONE if not resident
+  size_t currentStep() const; // NONE before the first select()
+  size_t numSteps() const;
+  size_t numSlots() const;
+  size_t lookahead() const;
+
+  size_t hits() const;
+  size_t misses() const;
+
+ private:
+  std::vector<size_t> prefetchTargets(size_t step) const;
+  size_t victimSlot(size_t step, const std::vector<size_t> &keep) const;
+
+  BACKEND *m_backend{nullptr};
+  size_t m_numSteps{0};
+  size_t m_lookahead{1};
+  std::vector<size_t> m_slotStep;
+  std::vector<uint64_t> m_slotLastUse;
+  uint64_t m_clock{0};
+  size_t m_current{NONE};
+  bool m_forward{true};
+  size_t m_hits{0};
+  size_t m_misses{0};
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+template <typename BACKEND>
+inline TimestepPrefetcher<BACKEND>::TimestepPrefetcher(
+    BACKEND &backend, size_t numSteps, size_t numSlots, size_t lookahead)
+    : m_backend(&backend),
+      m_numSteps(numSteps),
+      m_lookahead(std::min(lookahead, numSteps > 0 ? numSteps - 1 : 0))
+{
+  // The current step and all prefetched ones need a slot each
+  numSlots = std::max(numSlots, m_lookahead + 1);
+  m_slotStep.assign(numSlots, NONE);
+  m_slotLastUse.assign(numSlots, 0);
+}
+
+template <typename BACKEND>
+inline size_t TimestepPrefetcher<BACKEND>::select(size_t step)
+{
+  if (step >= m_numSteps)
+    return NONE;
+
+  m_clock++;
+
+  // Steps to within the lookahead of the last one set the direction of
+  // playback, while farther jumps keep it
+  if (m_current != NONE && step != m_current) {
+    const size_t ahead = (step + m_numSteps - m_current) % m_numSteps;
+    if (ahead <= m_lookahead)
+      m_forward = true;
+    else if (ahead >= m_numSteps - m_lookahead)
+      m_forward = false;
+  }
+
+  const auto targets = prefetchTargets(step);
+
+  size_t slot = slotOf(step);
+  if (slot == NONE) {
+    slot = victimSlot(step, targets);
+    if (slot == NONE)
+      slot = victimSlot(step, {});
+    m_slotStep[slot] = step;
+    m_backend->upload(step, slot, false);
+    m_misses++;
+  } else
+    m_hits++;
+
+  m_slotLastUse[slot] = m_clock;
+  m_backend->wait(slot);
+  m_current = step;
+
+  for (size_t t : targets) {
+    size_t s = slotOf(t);
+    if (s == NONE) {
+      s = victimSlot(step, targets);
+      if (s == NONE)
+        break;
+      m_slotStep[s] = t;
+      m_backend->upload(t, s, true);
+    }
+    m_slotLastUse[s] = m_clock;
+  }
+
+  return slot;
+}
+
+template <typename BACKEND>
+inline void TimestepPrefetcher<BACKEND>::invalidate()
+{
+  std::fill(m_slotStep.begin(), m_slotStep.end(), NONE);
+  std::fill(m_slotLastUse.begin(), m_slotLastUse.end(), 0);
+  m_current = NONE;
+}
+
+template <typename BACKEND>
+inline size_t TimestepPrefetcher<BACKEND>::slotOf(size_t step) const
+{
+  auto it = std::find(m_slotStep.begin(), m_slotStep.end(), step);
+  return it == m_slotStep.end() ? NONE : size_t(it - m_slotStep.begin());
+}
+
+template <typename BACKEND>
+inline size_t TimestepPrefetcher<BACKEND>::currentStep() const
+{
+  return m_current;
+}
+
+template <typename BACKEND>
+inline size_t TimestepPrefetcher<BACKEND>::numSteps() const
+{
+  return m_numSteps;
+}
+
+template <typename BACKEND>
+inline size_t TimestepPrefetcher<BACKEND>::numSlots() const
+{
+  return m_slotStep.size();
+}
+
+template <typename BACKEND>
+inline size_t TimestepPrefetcher<BACKEND>::lookahead() const
+{
+  return m_lookahead;
+}
+
+template <typename BACKEND>
+inline size_t TimestepPrefetcher<BACKEND>::hits() const
+{
+  return m_hits;
+}
+
+template <typename BACKEND>
+inline size_t TimestepPrefetcher<BACKEND>::misses() const
+{
+  return m_misses;
+}
+
+template <typename BACKEND>
+inline std::vector<size_t> TimestepPrefetcher<BACKEND>::prefetchTargets(
+    size_t step) const
+{
+  std::vector<size_t> targets;
+  for (size_t i = 1; i <= m_lookahead; i++) {
+    targets.push_back(m_forward ? (step + i) % m_numSteps
+                                : (step + m_numSteps - i) % m_numSteps);
+  }
+  return targets;
+}
+
+template <typename BACKEND>
+inline size_t TimestepPrefetcher<BACKEND>::victimSlot(
+    size_t step, const std::vector<size_t> &keep) const
+{
+  // Empty slots first, then the least recently used one
+  size_t victim = NONE;
+  for (size_t s = 0; s < m_slotStep.size(); s++) {
+    const size_t held = m_slotStep[s];
+    if (held == NONE)
+      return s;
+    if (held == step || std::find(keep.begin(), keep.end(), held) != keep.end())
+      continue;
+    if (victim == NONE || m_slotLastUse[s] < m_slotLastUse[victim])
+      victim = s;
+  }
+  return victim;
+}
+
+} // namespace visrtx
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "utility/IndexRange.h"
+// std
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace visrtx {
+
+// Tracks which instances of a world only had their transform changed since
+// the last TLAS build, so the TLAS can be refit instead of rebuilt. A full
+// rebuild is requested every 'maxUpdates' refits to restore BVH quality.
+struct TransformUpdateTracker
+{
+  TransformUpdateTracker(uint32_t maxUpdates = 32);
+
+  void reset(size_t numInstances);
+  void markDirty(size_t instanceIndex);
+  void markUpdated();
+
+  size_t numInstances() const;
+  size_t numDirty() const;
+  bool empty() const;
+  bool needsRebuild() const;
+
+  const std::vector<size_t> &dirtyInstances() const;
+  std::vector<IndexRange> dirtyRanges(size_t maxGap = 0) const;
+
+ private:
+  std::vector<uint8_t> m_isDirty;
+  std::vector<size_t> m_dirty;
+  uint32_t m_updatesSinceRebuild{0};
+  uint32_t m_maxUpdates{32};
+  bool m_outOfRange{false};
+};
+
+// State of an instance compared between commits to decide how its world's TLAS
+// has to be updated. Array contents can change without their handles changing,
+// so they are assumed to differ whenever an array is present.
+struct InstanceCommitState
+{
+  const void *group{nullptr};
+  size_t numTransforms{1};
+  const void *arrays[7]{}; // transform, id, attribute0-3 and color
+};
+
+enum class InstanceChange
+{
+  NONE,
+  TRANSFORM, // the TLAS only needs a refit of the instance's records
+  TLAS // the TLAS needs a rebuild
+};
+
+// 'valuesChanged' tells whether the single transform, id or visibility mask of
+// the instance changed
+InstanceChange classifyInstanceChange(const InstanceCommitState &last,
+    const InstanceCommitState &current,
+    bool valuesChanged);
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline TransformUpdateTracker::TransformUpdateTracker(uint32_t maxUpdates)
+    : m_maxUpdates(maxUpdates)
+{}
+
+inline void TransformUpdateTracker::reset(size_t numInstances)
+{
+  m_isDirty.assign(numInstances, 0);
+  m_dirty.clear();
+  m_updatesSinceRebuild = 0;
+  m_outOfRange = false;
+}
+
+inline void TransformUpdateTracker::markDirty(size_t i)
+{
+  if (i >= m_isDirty.size()) {
+    m_outOfRange = true;
+    return;
+  }
+
+  if (!m_isDirty[i]) {
+    m_isDirty[i] = 1;
+    m_dirty.push_back(i);
+  }
+}
+
+inline void TransformUpdateTracker::markUpdated()
+{
+  for (auto i : m_dirty)
+    m_isDirty[i] = 0;
+  m_dirty.clear();
+  m_updatesSinceRebuild++;
+}
+
+inline size_t TransformUpdateTracker::numInstances() const
+{
+  return m_isDirty.size();
+}
+
+inline size_t TransformUpdateTracker::numDirty() const
+{
+  return m_dirty.size();
+}
+
+inline bool TransformUpdateTracker::empty() const
+{
+  return m_dirty.empty();
+}
+
+inline bool TransformUpdateTracker::needsRebuild() const
+{
+  return m_outOfRange || m_updatesSinceRebuild >= m_maxUpdates;
+}
+
+inline const std::vector<size_t> &TransformUpdateTracker::dirtyInstances()
+    const
+{
+  return m_dirty;
+}
+
+inline std::vector<IndexRange> TransformUpdateTracker::dirtyRanges(
+    size_t maxGap) const
+{
+  std::vector<IndexRange> ranges;
+  if (m_dirty.empty())
+    return ranges;
+
+  auto sorted = m_dirty;
+  std::sort(sorted.begin(), sorted.end());
+
+  IndexRange current{sorted[0], sorted[0] + 1};
+  for (size_t i = 1; i < sorted.size(); i++) {
+    const auto idx = sorted[i];
+    if (idx <= current.end + maxGap)
+      current.end = idx + 1;
+    else {
+      ranges.push_back(current);
+      current = {idx, idx + 1};
+    }
+  }
+  ranges.push_back(current);
+
+  return ranges;
+}
+
+inline InstanceChange classifyInstanceChange(const InstanceCommitState &last,
+    const InstanceCommitState &current,
+    bool valuesChanged)
+{
+  if (!current.group || current.group != last.group
+      || current.numTransforms != last.numTransforms)
+    return InstanceChange::TLAS;
+
+  auto hasArrays = [](const InstanceCommitState &s) {
+    return std::any_of(std::begin(s.arrays),
+        std::end(s.arrays),
+        [](const void *a) { return a != nullptr; });
+  };
+
+  return valuesChanged || hasArrays(last) || hasArrays(current)
+      ? InstanceChange::TRANSFORM
+      : InstanceChange::NONE;
+}
+
+} // namespace visrtx
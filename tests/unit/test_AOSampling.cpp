@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "gpu/aoSampling.h"
+// std
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace visrtx;
+
+namespace {
+
+std::vector<vec2> makePoints(
+    AOSampling mode, uint32_t n, uint32_t frames, uint32_t pixel, uint32_t seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(0.f, 1.f);
+  std::vector<vec2> points;
+  for (uint32_t f = 0; f < frames; f++) {
+    for (uint32_t i = 0; i < n; i++) {
+      const vec2 u(dist(rng), dist(rng));
+      points.push_back(aoSample2D(mode, i, n, f, pixel, u));
+    }
+  }
+  return points;
+}
+
+// Fraction of directions blocked by a tilted occluder, as AO estimates it
+float occludedFraction(const std::vector<vec2> &points)
+{
+  const vec3 occluder = normalize(vec3(1.f, 0.5f, 0.2f));
+  float occluded = 0.f;
+  for (auto &p : points)
+    occluded += dot(cosineSampleHemisphere(p), occluder) > 0.4f ? 1.f : 0.f;
+  return occluded / points.size();
+}
+
+float rmsOcclusionError(AOSampling mode, uint32_t n, float reference)
+{
+  float sum = 0.f;
+  const uint32_t trials = 256;
+  for (uint32_t t = 0; t < trials; t++) {
+    const float e = occludedFraction(makePoints(mode, n, 1, t, t)) - reference;
+    sum += e * e;
+  }
+  return std::sqrt(sum / trials);
+}
+
+} // namespace
+
+SCENARIO("Stratified AO samples cover one stratum each", "[AOSampling]")
+{
+  GIVEN("Sample counts with and without square grids")
+  {
+    THEN("The grid has exactly as many strata as samples")
+    {
+      CHECK(aoStrataColumns(1) == 1);
+      CHECK(aoStrataColumns(7) == 1);
+      CHECK(aoStrataColumns(12) == 3);
+      CHECK(aoStrataColumns(16) == 4);
+      CHECK(aoStrataColumns(256) == 16);
+    }
+
+    THEN("Every stratum of a frame receives one sample")
+    {
+      for (uint32_t n : {4u, 12u, 16u}) {
+        const uint32_t columns = aoStrataColumns(n);
+        const uint32_t rows = n / columns;
+        std::set<std::pair<int, int>> cells;
+        for (auto &p : makePoints(AOSampling::STRATIFIED, n, 1, 0, n))
+          cells.emplace(int(p.x * columns), int(p.y * rows));
+        CHECK(cells.size() == n);
+      }
+    }
+  }
+}
+
+SCENARIO("Low-discrepancy AO samples form (0,m,2)-nets", "[AOSampling]")
+{
+  GIVEN("The first 256 points of a pixel, split into frames of 4 samples")
+  {
+    const auto points = makePoints(AOSampling::LOW_DISCREPANCY, 4, 64, 17, 0);
+
+    THEN("Every elementary interval of area 1/256 holds exactly one point")
+    {
+      bool isNet = true;
+      for (int a = 0; a <= 8; a++) {
+        const int nx = 1 << a;
+        const int ny = 256 / nx;
+        std::set<std::pair<int, int>> cells;
+        for (auto &p : points)
+          cells.emplace(int(p.x * nx), int(p.y * ny));
+        isNet = isNet && cells.size() == 256;
+      }
+      CHECK(isNet);
+    }
+
+    THEN("Each frame alone is stratified too")
+    {
+      std::set<std::pair<int, int>> cells;
+      for (int i = 0; i < 4; i++)
+        cells.emplace(int(points[i].x * 2), int(points[i].y * 2));
+      CHECK(cells.size() == 4);
+    }
+
+    THEN("Different pixels get differently scrambled points")
+    {
+      const auto other = makePoints(AOSampling::LOW_DISCREPANCY, 4, 1, 18, 0);
+      CHECK(other[0] != points[0]);
+    }
+  }
+}
+
+SCENARIO("AO directions are cosine distributed", "[AOSampling]")
+{
+  GIVEN("Directions from each sampling mode")
+  {
+    THEN("All directions are unit length and above the surface")
+    {
+      for (auto mode : {AOSampling::RANDOM,
+               AOSampling::STRATIFIED,
+               AOSampling::LOW_DISCREPANCY}) {
+        bool valid = true;
+        for (auto &p : makePoints(mode, 16, 16, 3, 3)) {
+          const vec3 d = cosineSampleHemisphere(p);
+          valid = valid && d.z >= 0.f && std::abs(length(d) - 1.f) < 1e-5f;
+        }
+        CHECK(valid);
+      }
+    }
+
+    THEN("The mean direction matches a cosine distribution")
+    {
+      vec3 mean(0.f);
+      const auto points = makePoints(AOSampling::LOW_DISCREPANCY, 64, 64, 5, 0);
+      for (auto &p : points)
+        mean += cosineSampleHemisphere(p);
+      mean /= float(points.size());
+      CHECK(mean.x == Approx(0.f).margin(1e-3f));
+      CHECK(mean.y == Approx(0.f).margin(1e-3f));
+      CHECK(mean.z == Approx(2.f / 3.f).epsilon(1e-3f));
+    }
+
+    THEN("Azimuths are evenly spread")
+    {
+      int bins[8] = {};
+      for (auto &p : makePoints(AOSampling::LOW_DISCREPANCY, 64, 64, 9, 0)) {
+        const vec3 d = cosineSampleHemisphere(p);
+        const float phi = std::atan2(d.y, d.x) + float(M_PI);
+        bins[std::min(int(phi / float(2 * M_PI) * 8), 7)]++;
+      }
+      for (int b : bins)
+        CHECK(b == Approx(512).margin(16));
+    }
+  }
+}
+
+SCENARIO("Stratified and low-discrepancy AO converges faster", "[AOSampling]")
+{
+  GIVEN("Estimates of a partial occlusion from 64 directions per pixel")
+  {
+    const float reference = occludedFraction(
+        makePoints(AOSampling::LOW_DISCREPANCY, 1 << 16, 1, 0, 0));
+
+    const float random = rmsOcclusionError(AOSampling::RANDOM, 64, reference);
+    const float stratified =
+        rmsOcclusionError(AOSampling::STRATIFIED, 64, reference);
+    const float lowDiscrepancy =
+        rmsOcclusionError(AOSampling::LOW_DISCREPANCY, 64, reference);
+
+    THEN("Both have less than half the error of random directions")
+    {
+      CHECK(stratified < 0.5f * random);
+      CHECK(lowDiscrepancy < 0.5f * random);
+    }
+  }
+}
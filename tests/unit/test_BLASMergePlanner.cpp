@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "utility/BLASMergePlanner.h"
+
+using namespace visrtx;
+
+SCENARIO("planBLASMerges batches small groups into shared BLASs", "[World]")
+{
+  BLASMergeSettings settings;
+  settings.primitiveThreshold = 100;
+  settings.maxPrimitivesPerBLAS = 250;
+  settings.maxSurfacesPerBLAS = 8;
+
+  GIVEN("Small candidates of the same class")
+  {
+    std::vector<BLASMergeCandidate> candidates = {
+        {0, 0, 10, 1}, {1, 0, 20, 2}, {2, 0, 30, 3}};
+    auto batches = planBLASMerges(candidates, settings);
+
+    THEN("They are merged into one batch in instance order")
+    {
+      REQUIRE(batches.size() == 1);
+      auto &b = batches[0];
+      REQUIRE(b.instances == std::vector<uint32_t>{0, 1, 2});
+      REQUIRE(b.surfaceOffsets == std::vector<uint32_t>{0, 1, 3, 6});
+      REQUIRE(b.numSurfaces() == 6);
+      REQUIRE(b.numPrimitives == 60);
+    }
+
+    THEN("Merged geometry indices map back to the owning instance")
+    {
+      auto &b = batches[0];
+      REQUIRE(b.memberOf(0) == 0);
+      REQUIRE(b.memberOf(1) == 1);
+      REQUIRE(b.memberOf(2) == 1);
+      REQUIRE(b.memberOf(5) == 2);
+      REQUIRE(b.surfaceToInstance()
+          == std::vector<uint32_t>{0, 1, 1, 2, 2, 2});
+    }
+  }
+
+  GIVEN("Candidates of different classes and sizes")
+  {
+    std::vector<BLASMergeCandidate> candidates = {{0, 1, 10, 1},
+        {1, 0, 10, 1},
+        {2, 1, 500, 1},
+        {3, 1, 10, 1},
+        {4, 0, 10, 1},
+        {5, 2, 10, 1}};
+    auto batches = planBLASMerges(candidates, settings);
+
+    THEN("Only same-class candidates below the threshold are merged")
+    {
+      REQUIRE(batches.size() == 2);
+      REQUIRE(batches[0].mergeClass == 0);
+      REQUIRE(batches[0].instances == std::vector<uint32_t>{1, 4});
+      REQUIRE(batches[1].mergeClass == 1);
+      REQUIRE(batches[1].instances == std::vector<uint32_t>{0, 3});
+    }
+  }
+
+  GIVEN("More candidates than fit into one BLAS")
+  {
+    std::vector<BLASMergeCandidate> candidates;
+    for (uint32_t i = 0; i < 7; i++)
+      candidates.push_back({i, 0, 100, 1});
+    auto batches = planBLASMerges(candidates, settings);
+
+    THEN("Batches are split by primitive count and lone leftovers dropped")
+    {
+      REQUIRE(batches.size() == 3);
+      REQUIRE(batches[0].instances == std::vector<uint32_t>{0, 1});
+      REQUIRE(batches[1].instances == std::vector<uint32_t>{2, 3});
+      REQUIRE(batches[2].instances == std::vector<uint32_t>{4, 5});
+    }
+
+    THEN("Batches are also split by surface count")
+    {
+      settings.maxPrimitivesPerBLAS = 10000;
+      for (auto &c : candidates)
+        c.numSurfaces = 3;
+      batches = planBLASMerges(candidates, settings);
+      REQUIRE(batches.size() == 3);
+      for (auto &b : batches)
+        REQUIRE(b.numSurfaces() <= settings.maxSurfacesPerBLAS);
+    }
+  }
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "gpu/bsdf.h"
+// std
+#include <random>
+
+using namespace visrtx;
+
+namespace {
+
+MaterialValues makeMaterial(
+    vec3 baseColor, float metallic, float roughness, float specular = 1.f)
+{
+  MaterialValues m;
+  m.baseColor = baseColor;
+  m.opacity = 1.f;
+  m.metallic = metallic;
+  m.roughness = roughness;
+  m.specular = specular;
+  m.ior = 1.5f;
+  m.normal = vec3(0.f, 0.f, 1.f);
+  return m;
+}
+
+vec3 directionAt(float cosTheta, float phi = 0.f)
+{
+  const float sinTheta = std::sqrt(1.f - cosTheta * cosTheta);
+  return vec3(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta);
+}
+
+// Directional albedo: the mean path weight of bsdfSample() for 'wo'
+vec3 albedo(const MaterialValues &m, const vec3 &wo, int numSamples = 200000)
+{
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> dist(0.f, 1.f);
+  vec3 sum(0.f);
+  for (int i = 0; i < numSamples; i++) {
+    const vec3 u(dist(rng), dist(rng), dist(rng));
+    vec3 wi;
+    float pdf;
+    sum += bsdfSample(m, wo, u, wi, pdf);
+  }
+  return sum / float(numSamples);
+}
+
+} // namespace
+
+SCENARIO("BSDF samples pass the white furnace test", "[BSDF]")
+{
+  const vec3 wo = directionAt(0.7f);
+
+  GIVEN("A white Lambertian material")
+  {
+    const auto m = makeMaterial(vec3(1.f), 0.f, 1.f, 0.f);
+
+    THEN("All energy is reflected")
+    {
+      CHECK(albedo(m, wo).x == Approx(1.f).epsilon(1e-3f));
+    }
+  }
+
+  GIVEN("A white, smooth metal")
+  {
+    const auto m = makeMaterial(vec3(1.f), 1.f, 0.2f);
+
+    THEN("Nearly all energy is reflected")
+    {
+      CHECK(albedo(m, wo).x == Approx(1.f).epsilon(0.02f));
+    }
+  }
+
+  GIVEN("White metals and dielectrics of any roughness")
+  {
+    THEN("No energy is created")
+    {
+      for (float roughness : {0.f, 0.3f, 0.6f, 1.f}) {
+        for (float metallic : {0.f, 0.5f, 1.f}) {
+          const auto a = albedo(makeMaterial(vec3(1.f), metallic, roughness),
+              wo,
+              50000);
+          CHECK(a.x <= 1.01f);
+          CHECK(a.x > 0.3f); // single scattering loses energy when rough
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("BSDF evaluation is reciprocal", "[BSDF]")
+{
+  GIVEN("A rough, partially metallic material")
+  {
+    const auto m = makeMaterial(vec3(0.8f, 0.5f, 0.2f), 0.3f, 0.4f);
+
+    THEN("f(wo, wi) == f(wi, wo)")
+    {
+      const vec3 a = directionAt(0.9f, 0.3f);
+      const vec3 b = directionAt(0.4f, 2.1f);
+      const vec3 fab = bsdfEval(m, a, b) / b.z;
+      const vec3 fba = bsdfEval(m, b, a) / a.z;
+      CHECK(fab.x == Approx(fba.x));
+      CHECK(fab.y == Approx(fba.y));
+      CHECK(fab.z == Approx(fba.z));
+    }
+
+    THEN("Directions below the surface are never reflected")
+    {
+      const vec3 above = directionAt(0.5f);
+      const vec3 below(above.x, above.y, -above.z);
+      CHECK(bsdfEval(m, above, below) == vec3(0.f));
+      CHECK(bsdfPdf(m, below, above) == 0.f);
+    }
+  }
+}
+
+SCENARIO("BSDF sampling matches its pdf", "[BSDF]")
+{
+  GIVEN("A glossy dielectric")
+  {
+    const auto m = makeMaterial(vec3(0.5f), 0.f, 0.3f);
+    const vec3 wo = directionAt(0.6f, 1.f);
+
+    THEN("Sample weights equal eval / pdf")
+    {
+      vec3 wi;
+      float pdf;
+      const vec3 w = bsdfSample(m, wo, vec3(0.3f, 0.7f, 0.01f), wi, pdf);
+      REQUIRE(pdf > 0.f);
+      CHECK(pdf == Approx(bsdfPdf(m, wo, wi)));
+      CHECK(w.x == Approx(bsdfEval(m, wo, wi).x / pdf));
+    }
+
+    THEN("The pdf integrates to at most one over the hemisphere")
+    {
+      std::mt19937 rng(42);
+      std::uniform_real_distribution<float> dist(0.f, 1.f);
+      const int numSamples = 400000;
+      double sum = 0.0;
+      for (int i = 0; i < numSamples; i++) {
+        // uniform hemisphere sampling, pdf 1 / (2 pi)
+        const vec3 wi = directionAt(dist(rng), 2.f * BSDF_PI * dist(rng));
+        sum += bsdfPdf(m, wo, wi) * 2.0 * BSDF_PI;
+      }
+      const double integral = sum / numSamples;
+      CHECK(integral <= 1.01);
+      CHECK(integral > 0.9);
+    }
+  }
+
+  GIVEN("A smooth metal")
+  {
+    const auto m = makeMaterial(vec3(1.f), 1.f, 0.f);
+    const vec3 wo = directionAt(0.8f, 0.5f);
+
+    THEN("Samples concentrate around the mirror direction")
+    {
+      vec3 wi;
+      float pdf;
+      bsdfSample(m, wo, vec3(0.5f, 0.25f, 0.f), wi, pdf);
+      const vec3 mirror(-wo.x, -wo.y, wo.z);
+      CHECK(dot(wi, mirror) > 0.99f);
+    }
+  }
+}
+
+SCENARIO("Shading frames are orthonormal", "[BSDF]")
+{
+  for (const vec3 n : {vec3(0.f, 0.f, 1.f),
+           vec3(0.f, 0.f, -1.f),
+           normalize(vec3(1.f, -2.f, 0.5f))}) {
+    const auto f = makeShadingFrame(n);
+    CHECK(dot(f.t, f.b) == Approx(0.f).margin(1e-6f));
+    CHECK(dot(f.t, f.n) == Approx(0.f).margin(1e-6f));
+    CHECK(length(f.t) == Approx(1.f));
+    const vec3 v = normalize(vec3(0.3f, 0.4f, 0.5f));
+    const vec3 r = f.toWorld(f.toLocal(v));
+    CHECK(r.x == Approx(v.x));
+    CHECK(r.y == Approx(v.y));
+    CHECK(r.z == Approx(v.z));
+  }
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "utility/BVHBuildPlanner.h"
+
+using namespace visrtx;
+
+SCENARIO("planBVHBuildBatches lays out BVH builds in shared arenas", "[Group]")
+{
+  constexpr size_t alignment = 128;
+  constexpr size_t emitBytes = 32;
+
+  GIVEN("No builds")
+  {
+    auto batches = planBVHBuildBatches({}, emitBytes, alignment, 1 << 20);
+
+    THEN("No batches are created")
+    {
+      REQUIRE(batches.empty());
+    }
+  }
+
+  GIVEN("A few builds which fit into one arena")
+  {
+    std::vector<BVHBuildSizes> sizes = {{1000, 300}, {4000, 100}, {500, 129}};
+    auto batches = planBVHBuildBatches(sizes, emitBytes, alignment, 1 << 20);
+
+    THEN("Outputs are aligned and packed in order")
+    {
+      REQUIRE(batches.size() == 1);
+      auto &b = batches[0];
+      REQUIRE(b.begin == 0);
+      REQUIRE(b.end == 3);
+      REQUIRE(b.outputOffsets == std::vector<size_t>{0, 384, 512});
+    }
+
+    THEN("The temp region is shared and sized for the largest build")
+    {
+      auto &b = batches[0];
+      REQUIRE(b.tempOffset == 768);
+      REQUIRE(b.emitOffset == 4864);
+      REQUIRE(b.arenaBytes == 4992);
+    }
+
+    THEN("No regions overlap")
+    {
+      auto &b = batches[0];
+      for (size_t i = 0; i < sizes.size(); i++) {
+        REQUIRE(b.outputOffsets[i] % alignment == 0);
+        REQUIRE(b.outputOffsets[i] + sizes[i].outputBytes <= b.tempOffset);
+      }
+      REQUIRE(b.tempOffset + 4000 <= b.emitOffset);
+      REQUIRE(b.emitOffset + 3 * emitBytes <= b.arenaBytes);
+    }
+  }
+
+  GIVEN("Builds which exceed the arena limit together")
+  {
+    std::vector<BVHBuildSizes> sizes = {
+        {256, 512}, {256, 512}, {256, 4096}, {256, 512}};
+    auto batches = planBVHBuildBatches(sizes, emitBytes, alignment, 2048);
+
+    THEN("They are split into batches within the limit")
+    {
+      REQUIRE(batches.size() == 3);
+      REQUIRE(batches[0].begin == 0);
+      REQUIRE(batches[0].end == 2);
+      REQUIRE(batches[0].arenaBytes <= 2048);
+      REQUIRE(batches[2].begin == 3);
+      REQUIRE(batches[2].end == 4);
+      REQUIRE(batches[2].outputOffsets == std::vector<size_t>{0});
+    }
+
+    THEN("An oversized build gets a batch of its own")
+    {
+      REQUIRE(batches[1].begin == 2);
+      REQUIRE(batches[1].end == 3);
+      REQUIRE(batches[1].arenaBytes > 2048);
+    }
+  }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "utility/BVHVersionTracker.h"
+
+using visrtx::BVHVersionTracker;
+
+SCENARIO("BVHVersionTracker orders background BVH builds", "[World]")
+{
+  BVHVersionTracker versions;
+
+  GIVEN("A scene change built in the background")
+  {
+    versions.markChanged();
+    const auto v = versions.beginBuild();
+
+    THEN("Frames are stale until the build is swapped in")
+    {
+      REQUIRE(versions.building());
+      REQUIRE(versions.stale());
+      REQUIRE(!versions.swap());
+
+      versions.endBuild(v);
+      REQUIRE(!versions.building());
+      REQUIRE(versions.ready());
+      REQUIRE(versions.stale());
+
+      REQUIRE(versions.swap());
+      REQUIRE(!versions.stale());
+      REQUIRE(versions.currentVersion() == v);
+      REQUIRE(!versions.swap());
+    }
+
+    THEN("Changes during the build keep frames stale after the swap")
+    {
+      versions.markChanged();
+      versions.endBuild(v);
+      REQUIRE(versions.swap());
+      REQUIRE(versions.stale());
+
+      const auto next = versions.beginBuild();
+      REQUIRE(next == versions.latestVersion());
+      versions.endBuild(next);
+      REQUIRE(versions.swap());
+      REQUIRE(!versions.stale());
+    }
+
+    THEN("A canceled build is never swapped in")
+    {
+      versions.cancelBuild();
+      REQUIRE(!versions.building());
+      REQUIRE(!versions.ready());
+      REQUIRE(!versions.swap());
+      REQUIRE(versions.stale());
+    }
+  }
+
+  GIVEN("A build finishing after a newer one was already swapped in")
+  {
+    versions.markChanged();
+    const auto older = versions.beginBuild();
+    versions.markChanged();
+    const auto newer = versions.beginBuild();
+    versions.endBuild(newer);
+    REQUIRE(versions.swap());
+    versions.endBuild(older);
+
+    THEN("The older build is ignored")
+    {
+      REQUIRE(!versions.ready());
+      REQUIRE(!versions.swap());
+      REQUIRE(versions.currentVersion() == newer);
+    }
+  }
+}
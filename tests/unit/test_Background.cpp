@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "gpu/background.h"
+#include "gpu/cameraCreateRay.h"
+// std
+#include <cmath>
+
+using namespace visrtx;
+
+SCENARIO("Environment backgrounds are looked up by direction", "[Background]")
+{
+  GIVEN("The default environment orientation")
+  {
+    const vec3 forward(0.f, 0.f, -1.f);
+    const vec3 right(1.f, 0.f, 0.f);
+    const vec3 up(0.f, 1.f, 0.f);
+
+    THEN("The image center looks along -z with +y up")
+    {
+      const vec2 center = equirectangularCoords(forward);
+      CHECK(center.x == Approx(0.5f));
+      CHECK(center.y == Approx(0.5f));
+      CHECK(equirectangularCoords(up).y == Approx(1.f));
+      CHECK(equirectangularCoords(-up).y == Approx(0.f));
+      CHECK(equirectangularCoords(right).x == Approx(0.75f));
+    }
+
+    THEN("Coordinates invert equirectangularDirection()")
+    {
+      bool inverts = true;
+      for (float x = 0.05f; x < 1.f; x += 0.1f) {
+        for (float y = 0.05f; y < 1.f; y += 0.1f) {
+          const vec2 uv = equirectangularCoords(
+              equirectangularDirection(vec2(x, y), forward, right, up));
+          inverts = inverts && std::abs(uv.x - x) < 1e-4f
+              && std::abs(uv.y - y) < 1e-4f;
+        }
+      }
+      CHECK(inverts);
+    }
+
+    THEN("Directions need not be normalized")
+    {
+      const vec2 a = equirectangularCoords(vec3(1.f, 2.f, -3.f));
+      const vec2 b = equirectangularCoords(5.f * vec3(1.f, 2.f, -3.f));
+      CHECK(a.x == Approx(b.x));
+      CHECK(a.y == Approx(b.y));
+    }
+  }
+
+  GIVEN("Two coordinates on either side of the seam behind the viewer")
+  {
+    const vec2 a(0.99f, 0.5f);
+    const vec2 b(0.01f, 0.6f);
+
+    THEN("Their difference wraps around instead of spanning the image")
+    {
+      const vec2 d = wrappedCoordsDifference(b, a);
+      CHECK(d.x == Approx(0.02f));
+      CHECK(d.y == Approx(0.1f));
+      CHECK(wrappedCoordsDifference(a, b).x == Approx(-0.02f));
+    }
+  }
+}
+
+SCENARIO("Background images get a full mip chain", "[Background]")
+{
+  GIVEN("Images of different sizes")
+  {
+    THEN("The chain ends at a single texel")
+    {
+      CHECK(numMipLevels(uvec2(1, 1)) == 1);
+      CHECK(numMipLevels(uvec2(2, 2)) == 2);
+      CHECK(numMipLevels(uvec2(256, 128)) == 9);
+      CHECK(numMipLevels(uvec2(300, 1)) == 9);
+    }
+
+    THEN("Levels halve each dimension down to one texel")
+    {
+      const uvec2 size(300, 5);
+      CHECK(mipLevelSize(size, 0) == uvec2(300, 5));
+      CHECK(mipLevelSize(size, 1) == uvec2(150, 2));
+      CHECK(mipLevelSize(size, 3) == uvec2(37, 1));
+      CHECK(mipLevelSize(size, 8) == uvec2(1, 1));
+    }
+  }
+}
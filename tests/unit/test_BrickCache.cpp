@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "catch.hpp"
+// visrtx
+#include "utility/BrickCache.h"
+
+using namespace visrtx;
+
+namespace {
+
+// Records loads instead of issuing them, tracking what each slot holds
+struct MockBrickLoader
+{
+  struct Load
+  {
+    uint32_t brick;
+    uint32_t slot;
+  };
+
+  std::vector<Load> loads;
+  std::vector<uint32_t> slotContents = std::vector<uint32_t>(16, ~0u);
+
+  void load(uint32_t brick, uint32_t slot)
+  {
+    loads.push_back({brick, slot});
+    slotContents[slot] = brick;
+  }
+};
+
+// 64^3 voxels in 16^3 bricks: 64 bricks at level 0, 8 at level 1 and a single
+// one at level 2
+const BrickLayout cubeLayout(uvec3(64u), 16);
+constexpr uint32_t COARSEST = 72;
+
+StreamedRegularData makeFieldData(
+    const BrickLayout &layout, const std::vector<uint32_t> &pageTable)
+{
+  StreamedRegularData sf;
+  sf.pageTable = pageTable.data();
+  sf.usedBricks = nullptr;
+  sf.dims = layout.dims();
+  sf.atlasSlots = uvec3(2, 2, 1);
+  sf.brickSize = layout.brickSize();
+  sf.numLevels = layout.numLevels();
+  sf.origin = vec3(0.f);
+  sf.spacing = vec3(1.f);
+  sf.invSpacing = vec3(1.f);
+  return sf;
+}
+
+} // namespace
+
+SCENARIO("Volumes are split into bricks over decimated levels", "[BrickCache]")
+{
+  GIVEN("A 100x50x20 volume in bricks of 16 cells")
+  {
+    const BrickLayout layout(uvec3(100, 50, 20), 16);
+
+    THEN("Levels are added until one brick covers the volume")
+    {
+      REQUIRE(layout.numLevels() == 4);
+      CHECK(layout.levelDims(1) == uvec3(50, 25, 10));
+      CHECK(layout.levelBricks(0) == uvec3(7, 4, 2));
+      CHECK(layout.levelBricks(1) == uvec3(4, 2, 1));
+      CHECK(layout.levelBricks(2) == uvec3(2, 1, 1));
+      CHECK(layout.levelBricks(3) == uvec3(1));
+      CHECK(layout.levelOffset(1) == 56);
+      CHECK(layout.numBricks() == 67);
+    }
+
+    THEN("Brick IDs map back to their level and coordinates")
+    {
+      const uint32_t id = layout.brickID(1, uvec3(3, 1, 0));
+      CHECK(id == 63);
+      CHECK(layout.levelOf(id) == 1);
+      CHECK(layout.brickCoords(id) == uvec3(3, 1, 0));
+      CHECK(layout.levelOf(55) == 0);
+      CHECK(layout.levelOf(66) == 3);
+    }
+
+    THEN("Parents are the bricks at the next coarser level")
+    {
+      CHECK(layout.parent(layout.brickID(0, uvec3(6, 3, 1))) == 63);
+      CHECK(layout.parent(63) == layout.brickID(2, uvec3(1, 0, 0)));
+      CHECK(layout.parent(66) == BRICK_NOT_RESIDENT);
+    }
+
+    THEN("Bricks overlap their neighbors by a voxel, clipped to the level")
+    {
+      const uint32_t first = layout.brickID(0, uvec3(0));
+      CHECK(layout.brickOrigin(first) == uvec3(0));
+      CHECK(layout.brickDims(first) == uvec3(17));
+
+      const uint32_t last = layout.brickID(0, uvec3(6, 3, 1));
+      CHECK(layout.brickOrigin(last) == uvec3(96, 48, 16));
+      CHECK(layout.brickDims(last) == uvec3(4, 2, 4));
+    }
+  }
+
+  GIVEN("A volume smaller than a brick")
+  {
+    const BrickLayout layout(uvec3(8), 16);
+
+    THEN("It has a single level of one brick")
+    {
+      CHECK(layout.numLevels() == 1);
+      CHECK(layout.numBricks() == 1);
+      CHECK(layout.brickDims(0) == uvec3(8));
+    }
+  }
+
+  GIVEN("Brick atlases for varying numbers of slots")
+  {
+    THEN("They are close to a cube and hold all slots")
+    {
+      CHECK(brickAtlasSlots(1) == uvec3(1));
+      CHECK(brickAtlasSlots(8) == uvec3(2));
+      CHECK(brickAtlasSlots(9) == uvec3(3, 2, 2));
+      for (uint32_t n = 1; n < 200; n++) {
+        const uvec3 s = brickAtlasSlots(n);
+        CHECK(s.x * s.y * s.z >= n);
+        CHECK(s.x * s.y * s.z < n + s.x * s.y);
+      }
+    }
+  }
+}
+
+SCENARIO("Bricks used by frames are loaded into the cache", "[BrickCache]")
+{
+  GIVEN("A cache of four slots")
+  {
+    MockBrickLoader loader;
+    BrickCache<MockBrickLoader> cache(loader, cubeLayout, 4);
+
+    THEN("The first update loads the coarsest level")
+    {
+      CHECK(cache.numPinned() == 1);
+      CHECK(cache.update() == 1);
+      REQUIRE(loader.loads.size() == 1);
+      CHECK(loader.loads[0].brick == COARSEST);
+      CHECK(cache.slotOf(COARSEST) == 0);
+    }
+
+    THEN("Missing ancestors are loaded before the bricks used")
+    {
+      cache.update();
+      cache.markUsed(42);
+      CHECK(cache.numRequested() == 2);
+      CHECK(cache.update() == 2);
+      REQUIRE(loader.loads.size() == 3);
+      CHECK(loader.loads[1].brick == cubeLayout.parent(42));
+      CHECK(loader.loads[2].brick == 42);
+      CHECK(cache.numRequested() == 0);
+      CHECK(cache.numResident() == 3);
+      CHECK(cache.pageTable()[42] == 2);
+    }
+
+    THEN("Resident bricks aren't loaded again")
+    {
+      cache.update();
+      cache.markUsed(42);
+      cache.update();
+      cache.markUsed(42);
+      CHECK(cache.numRequested() == 0);
+      CHECK(cache.update() == 0);
+      CHECK(cache.loads() == 3);
+    }
+
+    THEN("The least recently used brick is evicted")
+    {
+      cache.update();
+      cache.markUsed(0);
+      cache.update(); // bricks 0 and its parent 64
+      cache.markUsed(42);
+      cache.update(); // parent 71 into the free slot, then 42
+      CHECK(cache.evictions() == 1);
+      CHECK(cache.slotOf(64) == BrickCache<MockBrickLoader>::NONE);
+      CHECK(cache.slotOf(42) == 1);
+      CHECK(cache.slotOf(0) == 2);
+      CHECK(loader.slotContents[1] == 42);
+    }
+
+    THEN("Bricks used by the last frame and the coarsest level are kept")
+    {
+      cache.update();
+      cache.markUsed(0);
+      cache.update();
+      cache.markUsed(42);
+      cache.update();
+
+      // 0's parent is missing, but all slots were used by this frame
+      cache.markUsed(0);
+      cache.markUsed(42);
+      CHECK(cache.update() == 0);
+      CHECK(cache.slotOf(COARSEST) == 0);
+      CHECK(cache.slotOf(0) != BrickCache<MockBrickLoader>::NONE);
+      CHECK(cache.slotOf(42) != BrickCache<MockBrickLoader>::NONE);
+    }
+  }
+
+  GIVEN("A cache loading at most one brick per frame")
+  {
+    MockBrickLoader loader;
+    BrickCache<MockBrickLoader> cache(loader, cubeLayout, 8, 1);
+
+    THEN("Loads are spread over frames, coarse levels first")
+    {
+      cache.markUsed(42);
+      CHECK(cache.update() == 2); // the coarsest level is loaded regardless
+      CHECK(cache.slotOf(cubeLayout.parent(42)) == 1);
+      CHECK(cache.slotOf(42) == BrickCache<MockBrickLoader>::NONE);
+
+      cache.markUsed(42);
+      CHECK(cache.update() == 1);
+      CHECK(cache.slotOf(42) == 2);
+    }
+  }
+
+  GIVEN("A cache with too few slots")
+  {
+    MockBrickLoader loader;
+    BrickCache<MockBrickLoader> cache(loader, cubeLayout, 0);
+
+    THEN("It holds the coarsest level and one finer brick")
+    {
+      CHECK(cache.numSlots() == 2);
+    }
+  }
+}
+
+SCENARIO("Sampling falls back to coarser levels", "[BrickCache]")
+{
+  GIVEN("A cache with only the coarsest level resident")
+  {
+    MockBrickLoader loader;
+    BrickCache<MockBrickLoader> cache(loader, cubeLayout, 4);
+    cache.update();
+
+    const auto sf = makeFieldData(cubeLayout, cache.pageTable());
+    const vec3 p(40.f);
+
+    THEN("Samples come from the coarsest level")
+    {
+      const auto s = streamedFieldLookup(sf, p);
+      CHECK(s.resident);
+      CHECK(s.brick == 42);
+      CHECK(s.level == 2);
+      CHECK(s.atlasCoords == vec3(10.5f));
+    }
+
+    THEN("Loading the finest brick makes samples use it")
+    {
+      cache.markUsed(42);
+      cache.update();
+
+      const auto s = streamedFieldLookup(sf, p);
+      CHECK(s.resident);
+      CHECK(s.level == 0);
+      CHECK(s.atlasCoords == vec3(8.5f, 25.5f, 8.5f));
+    }
+
+    THEN("Locations outside of the volume are clamped to it")
+    {
+      const auto s = streamedFieldLookup(sf, vec3(-5.f, 100.f, 63.f));
+      CHECK(s.brick == cubeLayout.brickID(0, uvec3(0, 3, 3)));
+      CHECK(s.atlasCoords == vec3(0.5f, 15.5f, 15.5f));
+    }
+  }
+}
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "gpu/cameraCreateRay.h"
+// std
+#include <algorithm>
+#include <random>
+
+using namespace visrtx;
+
+namespace {
+
+CameraGPUData makeCamera(CameraType type)
+{
+  CameraGPUData c;
+  c.type = type;
+  c.region = vec4(0.f, 0.f, 1.f, 1.f);
+  c.pos = vec3(0.f);
+  c.dir = vec3(0.f, 0.f, -1.f);
+  c.up = vec3(0.f, 1.f, 0.f);
+  c.stereoMode = StereoMode::NONE;
+  c.interpupillaryDistance = 0.f;
+  return c;
+}
+
+CameraGPUData makePerspective()
+{
+  auto c = makeCamera(CameraType::PERSPECTIVE);
+  auto &p = c.perspective;
+  p.dir_du = normalize(cross(c.dir, c.up)) * 2.f;
+  p.dir_dv = normalize(cross(p.dir_du, c.dir)) * 2.f;
+  p.dir_00 = c.dir - 0.5f * p.dir_du - 0.5f * p.dir_dv;
+  p.apertureRadius = 0.f;
+  p.focusDistance = 1.f;
+  return c;
+}
+
+CameraGPUData makeOmnidirectional()
+{
+  auto c = makeCamera(CameraType::OMNIDIRECTIONAL);
+  auto &o = c.omnidirectional;
+  o.right = normalize(cross(c.dir, c.up));
+  o.up = cross(o.right, c.dir);
+  return c;
+}
+
+void checkVec(const vec3 &a, const vec3 &b)
+{
+  CHECK(a.x == Approx(b.x).margin(1e-5f));
+  CHECK(a.y == Approx(b.y).margin(1e-5f));
+  CHECK(a.z == Approx(b.z).margin(1e-5f));
+}
+
+} // namespace
+
+SCENARIO("Stereo modes split the frame between both eyes", "[CameraRays]")
+{
+  GIVEN("A screen position in the left half and the top half")
+  {
+    THEN("Side by side frames put the left eye on the left")
+    {
+      vec2 s(0.25f, 0.3f);
+      CHECK(stereoEye(StereoMode::SIDE_BY_SIDE, s) == -1.f);
+      CHECK(s.x == Approx(0.5f));
+      CHECK(s.y == Approx(0.3f));
+
+      vec2 r(0.75f, 0.3f);
+      CHECK(stereoEye(StereoMode::SIDE_BY_SIDE, r) == 1.f);
+      CHECK(r.x == Approx(0.5f));
+    }
+
+    THEN("Top bottom frames put the left eye on top")
+    {
+      vec2 s(0.4f, 0.75f);
+      CHECK(stereoEye(StereoMode::TOP_BOTTOM, s) == -1.f);
+      CHECK(s.x == Approx(0.4f));
+      CHECK(s.y == Approx(0.5f));
+
+      vec2 b(0.4f, 0.25f);
+      CHECK(stereoEye(StereoMode::TOP_BOTTOM, b) == 1.f);
+      CHECK(b.y == Approx(0.5f));
+    }
+
+    THEN("Single eye and mono modes keep the position")
+    {
+      vec2 s(0.25f, 0.75f);
+      CHECK(stereoEye(StereoMode::LEFT, s) == -1.f);
+      CHECK(stereoEye(StereoMode::RIGHT, s) == 1.f);
+      CHECK(stereoEye(StereoMode::NONE, s) == 0.f);
+      CHECK(s == vec2(0.25f, 0.75f));
+    }
+  }
+}
+
+SCENARIO("Stereo perspective cameras offset each eye", "[CameraRays]")
+{
+  GIVEN("A side by side perspective camera")
+  {
+    auto c = makePerspective();
+    c.stereoMode = StereoMode::SIDE_BY_SIDE;
+    c.interpupillaryDistance = 0.06f;
+
+    THEN("The center of each half looks straight ahead from its eye")
+    {
+      const auto left = cameraCreateRay(&c, vec2(0.25f, 0.5f));
+      checkVec(left.org, vec3(-0.03f, 0.f, 0.f));
+      checkVec(left.dir, c.dir);
+
+      const auto right = cameraCreateRay(&c, vec2(0.75f, 0.5f));
+      checkVec(right.org, vec3(0.03f, 0.f, 0.f));
+      checkVec(right.dir, c.dir);
+    }
+  }
+
+  GIVEN("A side by side perspective camera showing the left half of the view")
+  {
+    auto c = makePerspective();
+    c.stereoMode = StereoMode::SIDE_BY_SIDE;
+    c.interpupillaryDistance = 0.06f;
+    c.region = vec4(0.f, 0.f, 0.5f, 1.f);
+
+    THEN("Both eyes show the same region")
+    {
+      const auto left = cameraCreateRay(&c, vec2(0.25f, 0.5f));
+      const auto right = cameraCreateRay(&c, vec2(0.75f, 0.5f));
+      checkVec(left.org, vec3(-0.03f, 0.f, 0.f));
+      checkVec(right.org, vec3(0.03f, 0.f, 0.f));
+
+      // the center of each half looks at the center of the left half
+      auto full = makePerspective();
+      const auto center = cameraCreateRay(&full, vec2(0.25f, 0.5f));
+      checkVec(left.dir, center.dir);
+      checkVec(right.dir, center.dir);
+    }
+
+    THEN("Each half starts at the left edge of the region")
+    {
+      auto full = makePerspective();
+      const auto edge = cameraCreateRay(&full, vec2(0.f, 0.5f));
+      checkVec(cameraCreateRay(&c, vec2(0.f, 0.5f)).dir, edge.dir);
+      checkVec(cameraCreateRay(&c, vec2(0.5f, 0.5f)).dir, edge.dir);
+    }
+  }
+
+  GIVEN("A mono perspective camera")
+  {
+    const auto c = makePerspective();
+
+    THEN("Rays start at the camera position")
+    {
+      const auto ray = cameraCreateRay(&c, vec2(0.5f));
+      checkVec(ray.org, c.pos);
+      checkVec(ray.dir, c.dir);
+    }
+  }
+}
+
+SCENARIO("Omnidirectional cameras map the frame to the sphere", "[CameraRays]")
+{
+  GIVEN("An equirectangular camera looking down -z")
+  {
+    auto c = makeOmnidirectional();
+
+    THEN("The frame center looks along the camera direction")
+    {
+      checkVec(cameraCreateRay(&c, vec2(0.5f)).dir, c.dir);
+    }
+
+    THEN("Quarter turns look right, backwards and left")
+    {
+      checkVec(cameraCreateRay(&c, vec2(0.75f, 0.5f)).dir, vec3(1, 0, 0));
+      checkVec(cameraCreateRay(&c, vec2(1.f, 0.5f)).dir, vec3(0, 0, 1));
+      checkVec(cameraCreateRay(&c, vec2(0.25f, 0.5f)).dir, vec3(-1, 0, 0));
+    }
+
+    THEN("The top and bottom rows look up and down")
+    {
+      checkVec(cameraCreateRay(&c, vec2(0.3f, 1.f)).dir, vec3(0, 1, 0));
+      checkVec(cameraCreateRay(&c, vec2(0.3f, 0.f)).dir, vec3(0, -1, 0));
+    }
+
+    THEN("Stereo eyes are offset sideways for every viewing direction")
+    {
+      c.stereoMode = StereoMode::TOP_BOTTOM;
+      c.interpupillaryDistance = 0.06f;
+
+      // looking right (+x) from the left eye, which sits towards -z
+      const auto ray = cameraCreateRay(&c, vec2(0.75f, 0.75f));
+      checkVec(ray.dir, vec3(1, 0, 0));
+      checkVec(ray.org, vec3(0.f, 0.f, -0.03f));
+      CHECK(dot(ray.org, ray.dir) == Approx(0.f).margin(1e-6f));
+    }
+  }
+}
+
+SCENARIO("Lens samples are spread uniformly over the aperture", "[CameraRays]")
+{
+  GIVEN("Many uniform random lens samples")
+  {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+
+    const int numSamples = 100000;
+    int quadrants[4] = {0, 0, 0, 0};
+    int innerHalf = 0;
+    float maxRadius = 0.f;
+    vec2 mean(0.f);
+
+    for (int i = 0; i < numSamples; i++) {
+      const vec2 p = sampleUnitDisk(vec2(dist(rng), dist(rng)));
+      const float r = length(p);
+      maxRadius = std::max(maxRadius, r);
+      innerHalf += r < std::sqrt(0.5f);
+      quadrants[(p.x >= 0.f) + 2 * (p.y >= 0.f)]++;
+      mean += p;
+    }
+    mean /= float(numSamples);
+
+    THEN("All samples lie on the unit disk")
+    {
+      CHECK(maxRadius <= 1.f + 1e-6f);
+    }
+
+    THEN("Equal areas receive equal numbers of samples")
+    {
+      // the disk of radius sqrt(1/2) covers half of the area
+      CHECK(innerHalf / float(numSamples) == Approx(0.5f).margin(0.01f));
+      for (int q : quadrants)
+        CHECK(q / float(numSamples) == Approx(0.25f).margin(0.01f));
+    }
+
+    THEN("The samples are centered")
+    {
+      CHECK(mean.x == Approx(0.f).margin(0.01f));
+      CHECK(mean.y == Approx(0.f).margin(0.01f));
+    }
+  }
+
+  GIVEN("The corners and center of the sample square")
+  {
+    THEN("They map to the disk's boundary and center")
+    {
+      CHECK(sampleUnitDisk(vec2(0.5f)) == vec2(0.f));
+      CHECK(length(sampleUnitDisk(vec2(1.f, 1.f))) == Approx(1.f));
+      CHECK(length(sampleUnitDisk(vec2(0.f, 0.5f))) == Approx(1.f));
+    }
+  }
+}
+
+SCENARIO("Thin lens rays meet on the focal plane", "[CameraRays]")
+{
+  GIVEN("A perspective camera focused at distance 5")
+  {
+    auto c = makePerspective();
+    c.perspective.apertureRadius = 0.5f;
+    c.perspective.focusDistance = 5.f;
+
+    THEN("Rays through one pixel converge where the pinhole ray does")
+    {
+      const vec2 screen(0.7f, 0.4f);
+      auto pinhole = c;
+      pinhole.perspective.apertureRadius = 0.f;
+      const auto ref = cameraCreateRay(&pinhole, screen);
+      const vec3 focus = ref.org + ref.dir * (5.f / dot(ref.dir, c.dir));
+
+      for (const vec2 lens : {vec2(0.f), vec2(1.f, 0.3f), vec2(0.2f, 0.9f)}) {
+        const auto ray = cameraCreateRay(&c, screen, lens);
+        const float t = dot(focus - ray.org, c.dir) / dot(ray.dir, c.dir);
+        checkVec(ray.org + t * ray.dir, focus);
+        CHECK(length(ray.org - c.pos) <= 0.5f + 1e-5f);
+        CHECK(dot(ray.org - c.pos, c.dir) == Approx(0.f).margin(1e-6f));
+      }
+    }
+
+    THEN("The lens center gives the pinhole ray")
+    {
+      const auto ray = cameraCreateRay(&c, vec2(0.5f), vec2(0.5f));
+      checkVec(ray.org, c.pos);
+      checkVec(ray.dir, c.dir);
+    }
+  }
+}
+
+SCENARIO("World positions project back to the screen", "[CameraRays]")
+{
+  GIVEN("Perspective and orthographic cameras with a frame region")
+  {
+    auto p = makePerspective();
+    p.pos = vec3(1.f, 2.f, 3.f);
+    p.region = vec4(0.25f, 0.f, 0.75f, 1.f);
+
+    auto o = makeCamera(CameraType::ORTHOGRAPHIC);
+    o.orthographic.pos_du = vec3(4.f, 0.f, 0.f);
+    o.orthographic.pos_dv = vec3(0.f, 3.f, 0.f);
+    o.orthographic.pos_00 = vec3(-2.f, -1.5f, 0.f);
+
+    THEN("Projection inverts cameraCreateRay()")
+    {
+      for (const auto *c : {&p, &o}) {
+        const vec2 screen(0.3f, 0.8f);
+        const auto ray = cameraCreateRay(c, screen);
+        vec2 projected(0.f);
+        REQUIRE(cameraProjectPoint(c, ray.org + 5.f * ray.dir, projected));
+        CHECK(projected.x == Approx(screen.x));
+        CHECK(projected.y == Approx(screen.y));
+      }
+    }
+
+    THEN("Projection inverts cameraCreateRay() of a single eye")
+    {
+      p.stereoMode = StereoMode::RIGHT;
+      p.interpupillaryDistance = 0.06f;
+      const vec2 screen(0.3f, 0.8f);
+      const auto ray = cameraCreateRay(&p, screen);
+      vec2 projected(0.f);
+      REQUIRE(cameraProjectPoint(&p, ray.org + 5.f * ray.dir, projected));
+      CHECK(projected.x == Approx(screen.x));
+      CHECK(projected.y == Approx(screen.y));
+
+      p.stereoMode = StereoMode::SIDE_BY_SIDE;
+      CHECK(!cameraProjectPoint(&p, ray.org + 5.f * ray.dir, projected));
+    }
+
+    THEN("Points behind a perspective camera can't be projected")
+    {
+      vec2 projected(0.f);
+      CHECK(!cameraProjectPoint(&p, p.pos - p.dir, projected));
+    }
+
+    THEN("Screen bounds of boxes are clamped to the frame")
+    {
+      const auto centered = cameraScreenBounds(
+          &o, box3(vec3(-1.f, -0.75f, -5.f), vec3(1.f, 0.75f, -4.f)));
+      CHECK(centered.lower.x == Approx(0.25f));
+      CHECK(centered.lower.y == Approx(0.25f));
+      CHECK(centered.upper.x == Approx(0.75f));
+      CHECK(centered.upper.y == Approx(0.75f));
+
+      const auto large =
+          cameraScreenBounds(&o, box3(vec3(-10.f), vec3(1.f, 10.f, 10.f)));
+      CHECK(large.lower == vec2(0.f));
+      CHECK(large.upper.x == Approx(0.75f));
+      CHECK(large.upper.y == 1.f);
+    }
+
+    THEN("Boxes around the camera cover the whole frame")
+    {
+      const auto b = cameraScreenBounds(&p, box3(p.pos - 1.f, p.pos + 1.f));
+      CHECK(b.lower == vec2(0.f));
+      CHECK(b.upper == vec2(1.f));
+    }
+  }
+}
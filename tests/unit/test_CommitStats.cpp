@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "utility/CommitStats.h"
+
+using visrtx::CommitStats;
+
+static double s_fakeTime = 0.0;
+
+static double fakeClock()
+{
+  return s_fakeTime;
+}
+
+static void commitObject(
+    CommitStats &stats, int type, const char *name, double seconds)
+{
+  stats.objectCommitStarted();
+  s_fakeTime += seconds;
+  stats.objectCommitted(type, [&](CommitStats::ObjectEntry &e) {
+    e.subtype = "test";
+    e.name = name;
+  });
+}
+
+SCENARIO("CommitStats accounts for the cost of commit flushes", "[Device]")
+{
+  s_fakeTime = 100.0;
+  CommitStats stats(&fakeClock, 2);
+
+  GIVEN("A flush committing several objects")
+  {
+    stats.beginFlush();
+    commitObject(stats, 1, "a", 0.5);
+    commitObject(stats, 2, "b", 2.0);
+    commitObject(stats, 1, "c", 0.25);
+    commitObject(stats, 2, "d", 1.0);
+    visrtx::countUploadBytes(1024);
+    s_fakeTime += 0.25;
+    stats.endFlush();
+
+    THEN("The flush totals are recorded")
+    {
+      REQUIRE(stats.numObjects() == 4);
+      REQUIRE(stats.uploadBytes() == 1024);
+      REQUIRE(stats.flushSeconds() == Approx(4.0));
+    }
+
+    THEN("Only the slowest objects are kept, slowest first")
+    {
+      auto &slowest = stats.slowestObjects();
+      REQUIRE(slowest.size() == 2);
+      REQUIRE(slowest[0].name == "b");
+      REQUIRE(slowest[0].seconds == Approx(2.0));
+      REQUIRE(slowest[0].subtype == "test");
+      REQUIRE(slowest[1].name == "d");
+      REQUIRE(slowest[1].type == 2);
+    }
+
+    THEN("Time is accumulated per object type")
+    {
+      auto &types = stats.typeTotals();
+      REQUIRE(types.size() == 2);
+      REQUIRE(types.at(1).count == 2);
+      REQUIRE(types.at(1).seconds == Approx(0.75));
+      REQUIRE(types.at(2).count == 2);
+      REQUIRE(types.at(2).seconds == Approx(3.0));
+    }
+
+    THEN("An empty flush keeps the previous results")
+    {
+      stats.beginFlush();
+      stats.endFlush();
+      REQUIRE(stats.numObjects() == 4);
+    }
+
+    THEN("Objects committed outside of a flush are ignored")
+    {
+      commitObject(stats, 3, "e", 10.0);
+      REQUIRE(stats.typeTotals().count(3) == 0);
+    }
+  }
+
+  GIVEN("A flush with time spent between commits")
+  {
+    stats.beginFlush();
+    s_fakeTime += 1.0;
+    commitObject(stats, 1, "a", 0.5);
+    s_fakeTime += 3.0;
+    commitObject(stats, 1, "b", 0.5);
+    stats.endFlush();
+
+    THEN("Only the commits themselves are attributed to objects")
+    {
+      REQUIRE(stats.typeTotals().at(1).seconds == Approx(1.0));
+      REQUIRE(stats.slowestObjects()[0].seconds == Approx(0.5));
+      REQUIRE(stats.flushSeconds() == Approx(5.0));
+      REQUIRE(stats.uploadBytes() == 0);
+    }
+  }
+
+  GIVEN("Describing objects is disabled")
+  {
+    stats.setMaxSlowest(0);
+    stats.beginFlush();
+    commitObject(stats, 1, "a", 1.0);
+    stats.endFlush();
+
+    THEN("Totals are still recorded")
+    {
+      REQUIRE(stats.numObjects() == 1);
+      REQUIRE(stats.slowestObjects().empty());
+    }
+  }
+}
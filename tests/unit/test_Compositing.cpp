@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "gpu/compositing.h"
+#include "reference/ReferenceRenderer.h"
+
+using namespace visrtx;
+
+namespace {
+
+ReferenceMesh makeQuad(float z, float x0, float x1, uint32_t id)
+{
+  ReferenceMesh mesh;
+  mesh.vertices = {
+      vec3(x0, -.5f, z), vec3(x1, -.5f, z), vec3(x1, .5f, z), vec3(x0, .5f, z)};
+  mesh.indices = {uvec3(0, 1, 2), uvec3(0, 2, 3)};
+  mesh.material = referenceMaterial(vec3(0.25f * (id + 1)));
+  mesh.id = id;
+  return mesh;
+}
+
+// Render one rank's part of the scene into 'channel.colorDepth' pixels
+std::vector<uvec2> renderPartition(const std::vector<ReferenceMesh> &meshes,
+    const CameraGPUData &camera,
+    const uvec2 &size)
+{
+  ReferenceScene scene;
+  for (auto &m : meshes)
+    scene.addMesh(m);
+  scene.commit();
+
+  ReferenceRendererSettings settings;
+  settings.background = vec4(0.f);
+  settings.aoSamples = 0;
+
+  ReferenceFrame frame(size);
+  frame.render(scene, camera, settings);
+
+  std::vector<uvec2> pixels;
+  for (uint32_t y = 0; y < size.y; y++) {
+    for (uint32_t x = 0; x < size.x; x++) {
+      const uvec2 p(x, y);
+      pixels.push_back(packColorDepth(frame.color(p), frame.depth(p)));
+    }
+  }
+  return pixels;
+}
+
+CameraGPUData makeOrthographic()
+{
+  CameraGPUData c;
+  c.type = CameraType::ORTHOGRAPHIC;
+  c.region = vec4(0.f, 0.f, 1.f, 1.f);
+  c.pos = vec3(0.f);
+  c.dir = vec3(0.f, 0.f, -1.f);
+  c.up = vec3(0.f, 1.f, 0.f);
+  c.orthographic.pos_du = vec3(4.f, 0.f, 0.f);
+  c.orthographic.pos_dv = vec3(0.f, 4.f, 0.f);
+  c.orthographic.pos_00 = vec3(-2.f, -2.f, 0.f);
+  return c;
+}
+
+} // namespace
+
+SCENARIO("Partial frame pixels pack color and depth", "[Compositing]")
+{
+  GIVEN("A packed pixel")
+  {
+    const vec4 color(0.2f, 0.4f, 0.6f, 0.8f);
+    const uvec2 p = packColorDepth(color, 12.5f);
+
+    THEN("Color survives to 8 bits and depth exactly")
+    {
+      const vec4 c = unpackColor(p);
+      CHECK(c.x == Approx(0.2f).margin(1.f / 255));
+      CHECK(c.w == Approx(0.8f).margin(1.f / 255));
+      CHECK(unpackRayDistance(p) == 12.5f);
+      CHECK(!pixelIsEmpty(p));
+      CHECK(pixelIsEmpty(packColorDepth(vec4(0.f), 1e30f)));
+    }
+  }
+
+  GIVEN("A translucent pixel in front of an opaque one")
+  {
+    const uvec2 front = packColorDepth(vec4(0.5f, 0.f, 0.f, 0.5f), 1.f);
+    const uvec2 back = packColorDepth(vec4(0.f, 1.f, 0.f, 1.f), 2.f);
+    const uvec2 empty = packColorDepth(vec4(0.f), 0.5f);
+
+    THEN("The closer pixel is blended over the farther one in any order")
+    {
+      for (const auto &c : {compositeColorDepth(front, back),
+               compositeColorDepth(back, front)}) {
+        const vec4 color = unpackColor(c);
+        CHECK(color.x == Approx(0.5f).margin(1.f / 255));
+        CHECK(color.y == Approx(0.5f).margin(1.f / 255));
+        CHECK(color.w == Approx(1.f));
+        CHECK(unpackRayDistance(c) == 1.f);
+      }
+    }
+
+    THEN("Empty pixels are ignored, whatever their depth")
+    {
+      CHECK(compositeColorDepth(empty, back) == back);
+      CHECK(compositeColorDepth(front, empty) == front);
+    }
+  }
+}
+
+SCENARIO("Sort-last compositing of partitioned scenes", "[Compositing]")
+{
+  GIVEN("A scene split between two ranks along x, with overlap in depth")
+  {
+    const uvec2 size(40, 24);
+    const uint32_t tileSize = 8;
+    const auto camera = makeOrthographic();
+
+    const auto near = makeQuad(-1.f, -1.f, 0.2f, 0);
+    const auto far = makeQuad(-3.f, -0.2f, 1.f, 1);
+
+    const auto rank0 = renderPartition({near}, camera, size);
+    const auto rank1 = renderPartition({far}, camera, size);
+    const auto full = renderPartition({near, far}, camera, size);
+
+    THEN("Compositing both ranks reproduces the whole scene")
+    {
+      bool same = true;
+      for (size_t i = 0; i < full.size(); i++)
+        same = same && compositeColorDepth(rank0[i], rank1[i]) == full[i];
+      CHECK(same);
+    }
+
+    THEN("Tiles without content of a rank are marked empty")
+    {
+      const uvec2 numTiles = compositingNumTiles(size, tileSize);
+      CHECK(numTiles == uvec2(5, 3));
+      // Pixels are 0.1 wide and 1/6 high, so tiles are 0.8 by 1.33
+      CHECK(tileIsEmpty(rank0.data(), size, uvec2(0, 1), tileSize));
+      CHECK(!tileIsEmpty(rank0.data(), size, uvec2(1, 1), tileSize));
+      CHECK(tileIsEmpty(rank0.data(), size, uvec2(1, 0), tileSize));
+      CHECK(tileIsEmpty(rank0.data(), size, uvec2(3, 1), tileSize));
+      CHECK(tileIsEmpty(rank1.data(), size, uvec2(1, 1), tileSize));
+      CHECK(!tileIsEmpty(rank1.data(), size, uvec2(3, 1), tileSize));
+      CHECK(tileIsEmpty(rank1.data(), size, uvec2(3, 2), tileSize));
+    }
+
+    THEN("Screen bounds of each rank's data contain its pixels")
+    {
+      const auto b0 = cameraScreenBounds(
+          &camera, box3(vec3(-1.f, -.5f, -1.f), vec3(0.2f, .5f, -1.f)));
+      CHECK(b0.lower.x == Approx(0.25f));
+      CHECK(b0.upper.x == Approx(0.55f));
+      CHECK(b0.lower.y == Approx(0.375f));
+      CHECK(b0.upper.y == Approx(0.625f));
+    }
+  }
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "reference/HostBVH.h"
+// std
+#include <random>
+
+using namespace visrtx;
+
+namespace {
+
+struct Sphere
+{
+  vec3 center;
+  float radius;
+};
+
+bool intersectSphere(const Sphere &s, Ray &ray)
+{
+  const vec3 oc = ray.org - s.center;
+  const float b = dot(oc, ray.dir);
+  const float c = dot(oc, oc) - s.radius * s.radius;
+  const float disc = b * b - c;
+  if (disc < 0.f)
+    return false;
+  const float t = -b - std::sqrt(disc);
+  if (t <= ray.t.lower || t >= ray.t.upper)
+    return false;
+  ray.t.upper = t;
+  return true;
+}
+
+std::vector<Sphere> makeSpheres(size_t n, std::mt19937 &rng)
+{
+  std::uniform_real_distribution<float> pos(-10.f, 10.f);
+  std::uniform_real_distribution<float> radius(0.05f, 0.5f);
+  std::vector<Sphere> spheres(n);
+  for (auto &s : spheres)
+    s = {vec3(pos(rng), pos(rng), pos(rng)), radius(rng)};
+  return spheres;
+}
+
+std::vector<box3> sphereBounds(const std::vector<Sphere> &spheres)
+{
+  std::vector<box3> bounds;
+  for (auto &s : spheres)
+    bounds.emplace_back(s.center - s.radius, s.center + s.radius);
+  return bounds;
+}
+
+Ray randomRay(std::mt19937 &rng)
+{
+  std::uniform_real_distribution<float> pos(-12.f, 12.f);
+  std::normal_distribution<float> dir;
+  Ray ray;
+  ray.org = vec3(pos(rng), pos(rng), pos(rng));
+  ray.dir = normalize(vec3(dir(rng), dir(rng), dir(rng)));
+  return ray;
+}
+
+} // namespace
+
+SCENARIO("HostBVH partitions all primitives", "[HostBVH]")
+{
+  GIVEN("A BVH over random spheres")
+  {
+    std::mt19937 rng(7);
+    const auto spheres = makeSpheres(1000, rng);
+    const auto primBounds = sphereBounds(spheres);
+
+    HostBVH bvh;
+    bvh.build(primBounds, 4);
+
+    THEN("Every primitive is in exactly one leaf, inside its bounds")
+    {
+      std::vector<int> seen(spheres.size(), 0);
+      bool inside = true;
+      size_t maxLeaf = 0;
+      for (auto &n : bvh.nodes()) {
+        maxLeaf = std::max<size_t>(maxLeaf, n.count);
+        for (uint32_t i = n.first; n.count && i < n.first + n.count; i++) {
+          const uint32_t p = bvh.primIndices()[i];
+          seen[p]++;
+          inside = inside
+              && glm::all(glm::greaterThanEqual(primBounds[p].lower,
+                  n.bounds.lower))
+              && glm::all(glm::lessThanEqual(primBounds[p].upper,
+                  n.bounds.upper));
+        }
+      }
+      CHECK(std::all_of(seen.begin(), seen.end(), [](int s) {
+        return s == 1;
+      }));
+      CHECK(inside);
+      CHECK(maxLeaf <= 4);
+    }
+
+    THEN("The root bounds all primitives")
+    {
+      box3 expected;
+      for (auto &b : primBounds)
+        expected.extend(b);
+      CHECK(bvh.bounds().lower == expected.lower);
+      CHECK(bvh.bounds().upper == expected.upper);
+    }
+  }
+
+  GIVEN("No primitives")
+  {
+    HostBVH bvh;
+    bvh.build({});
+
+    THEN("Traversal finds nothing")
+    {
+      Ray ray;
+      ray.org = vec3(0.f);
+      ray.dir = vec3(0.f, 0.f, 1.f);
+      CHECK(!bvh.traverse(ray, [](uint32_t, Ray &) { return true; }));
+    }
+  }
+
+  GIVEN("Many primitives with the same centroid")
+  {
+    std::vector<box3> primBounds(100, box3(vec3(-1.f), vec3(1.f)));
+    HostBVH bvh;
+    bvh.build(primBounds, 4);
+
+    THEN("Building still terminates with every primitive in a leaf")
+    {
+      size_t numPrims = 0;
+      for (auto &n : bvh.nodes())
+        numPrims += n.count;
+      CHECK(numPrims == primBounds.size());
+    }
+  }
+}
+
+SCENARIO("HostBVH traversal matches brute force", "[HostBVH]")
+{
+  GIVEN("A BVH over random spheres and random rays")
+  {
+    std::mt19937 rng(11);
+    const auto spheres = makeSpheres(2000, rng);
+
+    HostBVH bvh;
+    bvh.build(sphereBounds(spheres));
+
+    const auto intersect = [&](uint32_t i, Ray &r) {
+      return intersectSphere(spheres[i], r);
+    };
+
+    THEN("Closest and any hits agree with testing every sphere")
+    {
+      int closestMatches = 0;
+      int anyMatches = 0;
+      int numHits = 0;
+      const int numRays = 2000;
+      for (int i = 0; i < numRays; i++) {
+        const Ray ray = randomRay(rng);
+
+        Ray reference = ray;
+        bool refHit = false;
+        for (auto &s : spheres)
+          refHit = intersectSphere(s, reference) || refHit;
+        numHits += refHit;
+
+        Ray closest = ray;
+        const bool hit = bvh.traverse(closest, intersect);
+        closestMatches +=
+            hit == refHit && closest.t.upper == reference.t.upper;
+
+        Ray any = ray;
+        anyMatches += bvh.traverse(any, intersect, true) == refHit;
+      }
+      CHECK(numHits > numRays / 10);
+      CHECK(closestMatches == numRays);
+      CHECK(anyMatches == numRays);
+    }
+  }
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "utility/IndexRange.h"
+// std
+#include <vector>
+
+using visrtx::changedRanges;
+using visrtx::mergeRanges;
+using visrtx::splitRange;
+
+SCENARIO("changedRanges finds the elements which need to be uploaded",
+    "[ObjectArray]")
+{
+  const std::vector<int> previous = {0, 1, 2, 3, 4, 5, 6, 7};
+
+  GIVEN("An identical array")
+  {
+    auto current = previous;
+    auto r = changedRanges(
+        previous.data(), previous.size(), current.data(), current.size());
+
+    THEN("Nothing changed")
+    {
+      REQUIRE(r.empty());
+    }
+  }
+
+  GIVEN("An array with one element appended")
+  {
+    auto current = previous;
+    current.push_back(8);
+    auto r = changedRanges(
+        previous.data(), previous.size(), current.data(), current.size());
+
+    THEN("Only the new tail is changed")
+    {
+      REQUIRE(r.size() == 1);
+      REQUIRE(r[0].begin == 8);
+      REQUIRE(r[0].end == 9);
+    }
+  }
+
+  GIVEN("An array with scattered modifications")
+  {
+    auto current = previous;
+    current[1] = -1;
+    current[2] = -1;
+    current[6] = -1;
+
+    THEN("Each run of changes becomes its own range")
+    {
+      auto r = changedRanges(
+          previous.data(), previous.size(), current.data(), current.size());
+      REQUIRE(r.size() == 2);
+      REQUIRE(r[0].begin == 1);
+      REQUIRE(r[0].end == 3);
+      REQUIRE(r[1].begin == 6);
+      REQUIRE(r[1].end == 7);
+    }
+
+    THEN("Nearby runs are merged when a gap is allowed")
+    {
+      auto r = changedRanges(previous.data(),
+          previous.size(),
+          current.data(),
+          current.size(),
+          3);
+      REQUIRE(r.size() == 1);
+      REQUIRE(r[0].begin == 1);
+      REQUIRE(r[0].end == 7);
+    }
+  }
+
+  GIVEN("A shrunk array with a modification and a previously empty array")
+  {
+    std::vector<int> current = {0, 1, -1};
+
+    THEN("Only elements inside the new size are reported")
+    {
+      auto r = changedRanges(
+          previous.data(), previous.size(), current.data(), current.size());
+      REQUIRE(r.size() == 1);
+      REQUIRE(r[0].begin == 2);
+      REQUIRE(r[0].end == 3);
+    }
+
+    THEN("Everything is changed when there was no previous array")
+    {
+      auto r = changedRanges<int>(nullptr, 0, current.data(), current.size());
+      REQUIRE(r.size() == 1);
+      REQUIRE(r[0].begin == 0);
+      REQUIRE(r[0].end == 3);
+    }
+  }
+}
+
+SCENARIO("splitRange covers a range in batches of a maximum size",
+    "[RayQuery]")
+{
+  THEN("Sizes which are not a multiple of the batch size end in a short batch")
+  {
+    auto r = splitRange(10, 4);
+    REQUIRE(r.size() == 3);
+    REQUIRE(r[0].begin == 0);
+    REQUIRE(r[0].end == 4);
+    REQUIRE(r[1].begin == 4);
+    REQUIRE(r[1].end == 8);
+    REQUIRE(r[2].begin == 8);
+    REQUIRE(r[2].end == 10);
+  }
+
+  THEN("Small ranges are a single batch")
+  {
+    auto r = splitRange(3, 4);
+    REQUIRE(r.size() == 1);
+    REQUIRE(r[0].begin == 0);
+    REQUIRE(r[0].end == 3);
+  }
+
+  THEN("Empty ranges have no batches")
+  {
+    REQUIRE(splitRange(0, 4).empty());
+  }
+}
+
+SCENARIO("mergeRanges combines dirty ranges recorded in any order",
+    "[ObjectArray]")
+{
+  THEN("Overlapping and touching ranges become one")
+  {
+    auto r = mergeRanges({{4, 6}, {0, 2}, {5, 8}, {2, 3}});
+    REQUIRE(r.size() == 2);
+    REQUIRE(r[0].begin == 0);
+    REQUIRE(r[0].end == 3);
+    REQUIRE(r[1].begin == 4);
+    REQUIRE(r[1].end == 8);
+  }
+
+  THEN("Nearby ranges are merged when a gap is allowed")
+  {
+    auto r = mergeRanges({{10, 12}, {0, 2}}, 8);
+    REQUIRE(r.size() == 1);
+    REQUIRE(r[0].begin == 0);
+    REQUIRE(r[0].end == 12);
+  }
+
+  THEN("Empty ranges are dropped")
+  {
+    REQUIRE(mergeRanges({{3, 3}, {5, 4}}).empty());
+  }
+}
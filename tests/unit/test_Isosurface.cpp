@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "gpu/isosurface.h"
+
+using namespace visrtx;
+
+SCENARIO("Macrocells are skipped when they can't contain an isovalue",
+    "[Isosurface]")
+{
+  GIVEN("Three isovalues")
+  {
+    const float isovalues[] = {0.25f, 0.5f, 0.9f};
+
+    THEN("Only isovalues within a cell's value range are enabled")
+    {
+      CHECK(isovalueMask(box1(0.f, 0.3f), isovalues, 3) == 0x1u);
+      CHECK(isovalueMask(box1(0.4f, 1.f), isovalues, 3) == 0x6u);
+      CHECK(isovalueMask(box1(0.f, 1.f), isovalues, 3) == 0x7u);
+      CHECK(isovalueMask(box1(0.6f, 0.8f), isovalues, 3) == 0u);
+    }
+
+    THEN("Range bounds are inclusive")
+    {
+      CHECK(isovalueMask(box1(0.5f, 0.5f), isovalues, 3) == 0x2u);
+    }
+
+    THEN("Cells without any values are always skipped")
+    {
+      CHECK(isovalueMask(box1(1e30f, -1e30f), isovalues, 3) == 0u);
+    }
+  }
+}
+
+SCENARIO("Macrocell bounds follow the grid layout", "[Isosurface]")
+{
+  GIVEN("A 4x2x2 grid over a box")
+  {
+    const ivec3 dims(4, 2, 2);
+    const box3 world(vec3(0.f), vec3(8.f, 4.f, 2.f));
+
+    THEN("Cells are laid out x-fastest")
+    {
+      const auto c0 = macrocellBounds(dims, world, 0);
+      CHECK(c0.lower == vec3(0.f));
+      CHECK(c0.upper == vec3(2.f, 2.f, 1.f));
+
+      const auto c5 = macrocellBounds(dims, world, 5);
+      CHECK(c5.lower == vec3(2.f, 2.f, 0.f));
+
+      const auto c15 = macrocellBounds(dims, world, 15);
+      CHECK(c15.upper == vec3(8.f, 4.f, 2.f));
+    }
+  }
+}
+
+SCENARIO("Rays are clipped to macrocells", "[Isosurface]")
+{
+  const box3 cell(vec3(1.f), vec3(2.f));
+
+  GIVEN("A ray through the cell")
+  {
+    const auto t = clipRayToBox(
+        vec3(0.f, 1.5f, 1.5f), vec3(1.f, 0.f, 0.f), cell, box1(0.f, 10.f));
+
+    THEN("The interval covers the cell")
+    {
+      CHECK(t.lower == Approx(1.f));
+      CHECK(t.upper == Approx(2.f));
+    }
+  }
+
+  GIVEN("A ray ending inside the cell")
+  {
+    const auto t = clipRayToBox(
+        vec3(0.f, 1.5f, 1.5f), vec3(1.f, 0.f, 0.f), cell, box1(0.f, 1.5f));
+
+    THEN("The interval stops at the end of the ray")
+    {
+      CHECK(t.upper == Approx(1.5f));
+    }
+  }
+
+  GIVEN("A ray missing the cell")
+  {
+    const auto t = clipRayToBox(
+        vec3(0.f, 3.f, 1.5f), vec3(1.f, 0.f, 0.f), cell, box1(0.f, 10.f));
+
+    THEN("The interval is empty")
+    {
+      CHECK(t.lower > t.upper);
+    }
+  }
+}
+
+SCENARIO("Isosurface crossings are found by marching and refinement",
+    "[Isosurface]")
+{
+  // A field increasing along the ray: s(t) = t^2 / 10
+  auto sample = [](float t) { return t * t / 10.f; };
+  const float isovalues[] = {0.4f, 2.5f, 100.f};
+
+  GIVEN("A ray segment crossing two isovalues")
+  {
+    float tHit = -1.f;
+    uint32_t isoID = ~0u;
+    const bool hit = findIsoCrossing(
+        sample, isovalues, 0x7u, box1(0.f, 10.f), 0.5f, tHit, isoID);
+
+    THEN("The nearest crossing is found accurately")
+    {
+      REQUIRE(hit);
+      CHECK(isoID == 0);
+      CHECK(tHit == Approx(2.f).margin(1e-3f));
+    }
+  }
+
+  GIVEN("The nearest isovalue disabled by the mask")
+  {
+    float tHit = -1.f;
+    uint32_t isoID = ~0u;
+    const bool hit = findIsoCrossing(
+        sample, isovalues, 0x6u, box1(0.f, 10.f), 0.5f, tHit, isoID);
+
+    THEN("The next enabled isovalue is found")
+    {
+      REQUIRE(hit);
+      CHECK(isoID == 1);
+      CHECK(tHit == Approx(5.f).margin(1e-3f));
+    }
+  }
+
+  GIVEN("Two isovalues crossed within the same step")
+  {
+    const float close[] = {2.5f, 2.4f};
+    float tHit = -1.f;
+    uint32_t isoID = ~0u;
+    const bool hit = findIsoCrossing(
+        sample, close, 0x3u, box1(0.f, 10.f), 2.f, tHit, isoID);
+
+    THEN("The nearer crossing wins")
+    {
+      REQUIRE(hit);
+      CHECK(isoID == 1);
+      CHECK(tHit == Approx(std::sqrt(24.f)).margin(1e-2f));
+    }
+  }
+
+  GIVEN("A segment without a crossing")
+  {
+    float tHit = -1.f;
+    uint32_t isoID = ~0u;
+    const bool hit = findIsoCrossing(
+        sample, isovalues, 0x7u, box1(6.f, 9.f), 0.5f, tHit, isoID);
+
+    THEN("Nothing is found")
+    {
+      CHECK(!hit);
+    }
+  }
+
+  GIVEN("An empty mask or interval")
+  {
+    float tHit = -1.f;
+    uint32_t isoID = ~0u;
+
+    THEN("Nothing is found")
+    {
+      CHECK(!findIsoCrossing(
+          sample, isovalues, 0u, box1(0.f, 10.f), 0.5f, tHit, isoID));
+      CHECK(!findIsoCrossing(
+          sample, isovalues, 0x7u, box1(5.f, 1.f), 0.5f, tHit, isoID));
+    }
+  }
+}
+
+SCENARIO("Isosurface normals come from the field gradient", "[Isosurface]")
+{
+  auto sample = [](const vec3 &p) { return 2.f * p.x - p.y + 0.5f * p.z; };
+  const auto g = centralDifferenceGradient(sample, vec3(1.f, 2.f, 3.f), 0.1f);
+  CHECK(g.x == Approx(2.f));
+  CHECK(g.y == Approx(-1.f));
+  CHECK(g.z == Approx(0.5f));
+}
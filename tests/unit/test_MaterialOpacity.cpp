@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "scene/surface/material/MaterialOpacity.h"
+
+using namespace visrtx;
+
+static MaterialGPUData makeMaterial(AlphaMode mode, float opacity, float alpha)
+{
+  MaterialGPUData md{};
+  md.baseColor = MaterialParameter<vec4>(vec4(1.f, 1.f, 1.f, alpha));
+  md.opacity = MaterialParameter<float>(opacity);
+  md.cutoff = 0.5f;
+  md.mode = mode;
+  return md;
+}
+
+SCENARIO("Materials are classified by whether any-hit can discard hits",
+    "[Material]")
+{
+  GIVEN("An opaque mode material with full opacity")
+  {
+    auto md = makeMaterial(AlphaMode::OPAQUE, 1.f, 0.f);
+
+    THEN("It is fully opaque regardless of the base color alpha")
+    {
+      REQUIRE(isFullyOpaque(md));
+    }
+  }
+
+  GIVEN("An opaque mode material with a partial opacity value")
+  {
+    auto md = makeMaterial(AlphaMode::OPAQUE, 0.5f, 1.f);
+
+    THEN("It is not fully opaque, matching the 'dpt' any-hit test")
+    {
+      REQUIRE(!isFullyOpaque(md));
+    }
+  }
+
+  GIVEN("A material whose opacity comes from a sampler or attribute")
+  {
+    auto md = makeMaterial(AlphaMode::OPAQUE, 1.f, 1.f);
+
+    md.opacity.type = MaterialParameterType::SAMPLER;
+    md.opacity.sampler = 0;
+    THEN("A sampled opacity is not fully opaque")
+    {
+      REQUIRE(!isFullyOpaque(md));
+    }
+
+    md.opacity.type = MaterialParameterType::ATTRIB_0;
+    THEN("An attribute opacity is not fully opaque")
+    {
+      REQUIRE(!isFullyOpaque(md));
+    }
+  }
+
+  GIVEN("Blended materials")
+  {
+    THEN("They are fully opaque only if opacity times alpha is near one")
+    {
+      REQUIRE(isFullyOpaque(makeMaterial(AlphaMode::BLEND, 1.f, 1.f)));
+      REQUIRE(!isFullyOpaque(makeMaterial(AlphaMode::BLEND, 1.f, 0.9f)));
+    }
+
+    THEN("A sampled base color is not fully opaque")
+    {
+      auto md = makeMaterial(AlphaMode::BLEND, 1.f, 1.f);
+      md.baseColor.type = MaterialParameterType::SAMPLER;
+      md.baseColor.sampler = 0;
+      REQUIRE(!isFullyOpaque(md));
+    }
+  }
+
+  GIVEN("Masked materials")
+  {
+    THEN("They are fully opaque if opacity times alpha passes the cutoff")
+    {
+      REQUIRE(isFullyOpaque(makeMaterial(AlphaMode::MASK, 1.f, 0.6f)));
+      REQUIRE(!isFullyOpaque(makeMaterial(AlphaMode::MASK, 1.f, 0.4f)));
+    }
+  }
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "utility/InstanceRecordLayout.h"
+#include "utility/Parallel.h"
+// std
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<visrtx::InstanceRecordCounts> makeInstances(size_t n)
+{
+  std::mt19937 rng(n);
+  std::bernoulli_distribution coin(0.5);
+  std::vector<visrtx::InstanceRecordCounts> instances(n);
+  for (auto &i : instances) {
+    i.numTransforms = rng() % 4;
+    i.numSurfaceKinds = rng() % 4;
+    i.hasVolumes = coin(rng);
+    i.merged = i.numTransforms == 1 && coin(rng);
+  }
+  return instances;
+}
+
+} // namespace
+
+SCENARIO("parallelExclusiveScan matches a serial prefix sum", "[World]")
+{
+  for (size_t n : {0, 1, 7, 1000, 100000}) {
+    std::vector<uint32_t> values(n);
+    std::mt19937 rng(42);
+    for (auto &v : values)
+      v = rng() % 4;
+
+    std::vector<uint32_t> expected(n);
+    uint32_t expectedTotal = 0;
+    for (size_t i = 0; i < n; i++) {
+      expected[i] = expectedTotal;
+      expectedTotal += values[i];
+    }
+
+    GIVEN("An input of size " + std::to_string(n))
+    {
+      auto result = values;
+      const auto total =
+          visrtx::parallelExclusiveScan(result.data(), result.size(), 16);
+
+      THEN("The offsets and total match the serial scan")
+      {
+        REQUIRE(total == expectedTotal);
+        REQUIRE(result == expected);
+      }
+    }
+  }
+}
+
+SCENARIO("parallelFor visits every index exactly once", "[World]")
+{
+  GIVEN("More work than a single chunk")
+  {
+    const size_t n = 50000;
+    std::vector<std::atomic<int>> visits(n);
+    for (auto &v : visits)
+      v = 0;
+
+    visrtx::parallelFor(n, [&](size_t i) { visits[i]++; }, 64);
+
+    THEN("No index is skipped or repeated")
+    {
+      bool allOnce = true;
+      for (auto &v : visits)
+        allOnce = allOnce && v == 1;
+      REQUIRE(allOnce);
+    }
+  }
+}
+
+SCENARIO("layoutInstanceRecords matches a serial record layout", "[World]")
+{
+  const auto instances = makeInstances(20000);
+  const size_t n = instances.size();
+
+  // Serial reference, recording which instance owns each record
+  std::vector<size_t> serialSurface, serialVolume;
+  for (size_t i = 0; i < n; i++) {
+    auto &inst = instances[i];
+    for (uint32_t t = 0; t < inst.numTransforms; t++) {
+      for (uint32_t k = 0; !inst.merged && k < inst.numSurfaceKinds; k++)
+        serialSurface.push_back(i);
+      if (inst.hasVolumes)
+        serialVolume.push_back(i);
+    }
+  }
+
+  GIVEN("Offsets computed from per-instance record counts")
+  {
+    std::vector<uint32_t> surfaceOffsets, volumeOffsets;
+    const auto totals = visrtx::layoutInstanceRecords(
+        n,
+        [&](size_t i) { return instances[i]; },
+        surfaceOffsets,
+        volumeOffsets,
+        128);
+
+    std::vector<size_t> surface(totals.numSurfaceRecords),
+        volume(totals.numVolumeRecords);
+    visrtx::parallelFor(
+        n,
+        [&](size_t i) {
+          const uint32_t numSurfaces =
+              surfaceOffsets[i + 1] - surfaceOffsets[i];
+          const uint32_t numVolumes = volumeOffsets[i + 1] - volumeOffsets[i];
+          for (uint32_t r = 0; r < numSurfaces; r++)
+            surface[surfaceOffsets[i] + r] = i;
+          for (uint32_t r = 0; r < numVolumes; r++)
+            volume[volumeOffsets[i] + r] = i;
+        },
+        128);
+
+    THEN("Totals, final offsets and record owners match the serial walk")
+    {
+      REQUIRE(totals.numSurfaceRecords == serialSurface.size());
+      REQUIRE(totals.numVolumeRecords == serialVolume.size());
+      REQUIRE(surfaceOffsets.size() == n + 1);
+      REQUIRE(surfaceOffsets[n] == totals.numSurfaceRecords);
+      REQUIRE(volumeOffsets[n] == totals.numVolumeRecords);
+      REQUIRE(surface == serialSurface);
+      REQUIRE(volume == serialVolume);
+    }
+  }
+
+  GIVEN("Offsets left over from a larger world")
+  {
+    std::vector<uint32_t> surfaceOffsets(n * 2, 7), volumeOffsets(n * 2, 7);
+    const auto totals = visrtx::layoutInstanceRecords(
+        3,
+        [&](size_t i) { return instances[i]; },
+        surfaceOffsets,
+        volumeOffsets);
+
+    THEN("They are resized to the new instances")
+    {
+      REQUIRE(surfaceOffsets.size() == 4);
+      REQUIRE(volumeOffsets.size() == 4);
+      REQUIRE(surfaceOffsets[0] == 0);
+      REQUIRE(surfaceOffsets[3] == totals.numSurfaceRecords);
+      REQUIRE(volumeOffsets[3] == totals.numVolumeRecords);
+    }
+  }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "gpu/pick.h"
+
+using namespace visrtx;
+
+SCENARIO("Pick results report the closest hit along the ray", "[Pick]")
+{
+  GIVEN("A ray along +z and a volume with ID 7")
+  {
+    Ray ray;
+    ray.org = vec3(1.f, 2.f, 0.f);
+    ray.dir = vec3(0.f, 0.f, 1.f);
+    ray.t = box1(0.f, 1e30f);
+
+    VolumeGPUData volume;
+    volume.id = 7;
+
+    SurfaceHit surfaceHit{};
+    surfaceHit.t = 4.f;
+    surfaceHit.primID = 1;
+    surfaceHit.objID = 2;
+    surfaceHit.instID = 3;
+
+    VolumeHit volumeHit{};
+    volumeHit.localRay.t = box1(2.f, 6.f);
+    volumeHit.instID = 5;
+    volumeHit.volumeData = &volume;
+
+    THEN("A miss reports invalid IDs")
+    {
+      const auto r = resolvePick(ray, surfaceHit, volumeHit);
+      CHECK(!r.hit);
+      CHECK(r.primID == ~0u);
+      CHECK(r.objID == ~0u);
+      CHECK(r.instID == ~0u);
+    }
+
+    THEN("A surface hit reports its IDs and position")
+    {
+      surfaceHit.foundHit = true;
+      const auto r = resolvePick(ray, surfaceHit, volumeHit);
+      CHECK(r.hit);
+      CHECK(r.distance == 4.f);
+      CHECK(r.position == vec3(1.f, 2.f, 4.f));
+      CHECK(r.primID == 1);
+      CHECK(r.objID == 2);
+      CHECK(r.instID == 3);
+    }
+
+    THEN("A volume in front of a surface is picked at its entry point")
+    {
+      surfaceHit.foundHit = true;
+      volumeHit.foundHit = true;
+      const auto r = resolvePick(ray, surfaceHit, volumeHit);
+      CHECK(r.hit);
+      CHECK(r.distance == 2.f);
+      CHECK(r.position == vec3(1.f, 2.f, 2.f));
+      CHECK(r.primID == 0);
+      CHECK(r.objID == 7);
+      CHECK(r.instID == 5);
+    }
+
+    THEN("A surface in front of a volume is picked")
+    {
+      surfaceHit.foundHit = true;
+      surfaceHit.t = 1.f;
+      volumeHit.foundHit = true;
+      const auto r = resolvePick(ray, surfaceHit, volumeHit);
+      CHECK(r.distance == 1.f);
+      CHECK(r.objID == 2);
+    }
+  }
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "gpu/rayQuery.h"
+// std
+#include <limits>
+
+using namespace visrtx;
+
+static RayQueryRay makeRay(vec3 org, vec3 dir, float tmin, float tmax)
+{
+  RayQueryRay r;
+  r.org = org;
+  r.dir = dir;
+  r.tmin = tmin;
+  r.tmax = tmax;
+  return r;
+}
+
+SCENARIO("Query rays are validated before tracing", "[RayQuery]")
+{
+  const float inf = std::numeric_limits<float>::infinity();
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+
+  THEN("Finite rays with an ordered interval are valid")
+  {
+    CHECK(isValidQueryRay(makeRay(vec3(0.f), vec3(0, 0, 1), 0.f, 10.f)));
+    CHECK(isValidQueryRay(makeRay(vec3(1.f), vec3(1, 0, 0), 2.f, 2.f)));
+  }
+
+  THEN("An infinite tmax is valid")
+  {
+    CHECK(isValidQueryRay(makeRay(vec3(0.f), vec3(0, 0, 1), 0.f, inf)));
+  }
+
+  THEN("Degenerate directions and non-finite vectors are invalid")
+  {
+    CHECK(!isValidQueryRay(makeRay(vec3(0.f), vec3(0.f), 0.f, 1.f)));
+    CHECK(!isValidQueryRay(makeRay(vec3(nan), vec3(0, 0, 1), 0.f, 1.f)));
+    CHECK(!isValidQueryRay(makeRay(vec3(0.f), vec3(inf, 0, 0), 0.f, 1.f)));
+  }
+
+  THEN("Negative, reversed or NaN intervals are invalid")
+  {
+    CHECK(!isValidQueryRay(makeRay(vec3(0.f), vec3(0, 0, 1), -1.f, 1.f)));
+    CHECK(!isValidQueryRay(makeRay(vec3(0.f), vec3(0, 0, 1), 2.f, 1.f)));
+    CHECK(!isValidQueryRay(makeRay(vec3(0.f), vec3(0, 0, 1), nan, 1.f)));
+    CHECK(!isValidQueryRay(makeRay(vec3(0.f), vec3(0, 0, 1), 0.f, nan)));
+  }
+}
+
+SCENARIO("Query hits are packed from surface hits", "[RayQuery]")
+{
+  THEN("Misses report tmax and invalid IDs")
+  {
+    const auto h = rayQueryMiss(makeRay(vec3(0.f), vec3(0, 0, 1), 0.f, 5.f));
+    CHECK(!h.hit);
+    CHECK(h.t == 5.f);
+    CHECK(h.Ng == vec3(0.f));
+    CHECK(h.primID == ~0u);
+    CHECK(h.objID == ~0u);
+    CHECK(h.instID == ~0u);
+  }
+
+  THEN("Hits report distance, normal and IDs")
+  {
+    SurfaceHit hit{};
+    hit.foundHit = true;
+    hit.t = 3.f;
+    hit.Ng = vec3(0, 1, 0);
+    hit.primID = 4;
+    hit.objID = 5;
+    hit.instID = 6;
+
+    const auto h = rayQueryHit(hit);
+    CHECK(h.hit);
+    CHECK(h.t == 3.f);
+    CHECK(h.Ng == vec3(0, 1, 0));
+    CHECK(h.primID == 4);
+    CHECK(h.objID == 5);
+    CHECK(h.instID == 6);
+  }
+}
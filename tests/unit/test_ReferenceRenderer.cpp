@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "reference/ReferenceRenderer.h"
+
+using namespace visrtx;
+
+namespace {
+
+ReferenceMesh makeQuad(
+    const vec3 &o, const vec3 &u, const vec3 &v, uint32_t id, vec3 color)
+{
+  ReferenceMesh mesh;
+  mesh.vertices = {o, o + u, o + u + v, o + v};
+  mesh.indices = {uvec3(0, 1, 2), uvec3(0, 2, 3)};
+  mesh.material = referenceMaterial(color);
+  mesh.id = id;
+  return mesh;
+}
+
+// 90 degree perspective camera at 'pos', looking straight down
+CameraGPUData makeTopDownCamera(const vec3 &pos)
+{
+  CameraGPUData c;
+  c.type = CameraType::PERSPECTIVE;
+  c.region = vec4(0.f, 0.f, 1.f, 1.f);
+  c.pos = pos;
+  c.dir = vec3(0.f, -1.f, 0.f);
+  c.up = vec3(0.f, 0.f, -1.f);
+  auto &p = c.perspective;
+  p.dir_du = normalize(cross(c.dir, c.up)) * 2.f;
+  p.dir_dv = normalize(cross(p.dir_du, c.dir)) * 2.f;
+  p.dir_00 = c.dir - 0.5f * p.dir_du - 0.5f * p.dir_dv;
+  p.apertureRadius = 0.f;
+  p.focusDistance = 1.f;
+  return c;
+}
+
+vec4 meanColor(const ReferenceFrame &frame)
+{
+  vec4 sum(0.f);
+  for (uint32_t y = 0; y < frame.size().y; y++) {
+    for (uint32_t x = 0; x < frame.size().x; x++)
+      sum += frame.color(uvec2(x, y));
+  }
+  return sum / float(frame.size().x * frame.size().y);
+}
+
+} // namespace
+
+SCENARIO("The reference renderer traces triangle meshes", "[Reference]")
+{
+  GIVEN("A large ground plane seen from above")
+  {
+    ReferenceScene scene;
+    scene.addMesh(makeQuad(vec3(-100.f, 0.f, -100.f),
+        vec3(0.f, 0.f, 200.f),
+        vec3(200.f, 0.f, 0.f),
+        3,
+        vec3(0.5f)));
+    scene.commit();
+
+    const auto camera = makeTopDownCamera(vec3(0.f, 2.f, 0.f));
+
+    ReferenceRendererSettings settings;
+    settings.aoSamples = 4;
+    settings.ambientRadiance = 2.f;
+
+    ReferenceFrame frame(uvec2(37, 29), 8);
+    frame.render(scene, camera, settings);
+
+    THEN("Nothing occludes the plane in 'ao' mode")
+    {
+      const vec4 c = meanColor(frame);
+      CHECK(c.x == Approx(1.f));
+      CHECK(c.w == Approx(1.f));
+    }
+
+    THEN("Depth and IDs of the plane are written")
+    {
+      const uvec2 center = frame.size() / 2u;
+      CHECK(frame.depth(center) == Approx(2.f).epsilon(0.01f));
+      CHECK(frame.objID(center) == 3);
+      CHECK(frame.primID(center) < 2);
+    }
+
+    THEN("Rendering is deterministic for any number of threads")
+    {
+      settings.type = ReferenceRendererType::DPT;
+      ReferenceFrame a(frame.size(), 4);
+      ReferenceFrame b(frame.size(), 64);
+      for (int i = 0; i < 3; i++) {
+        a.render(scene, camera, settings);
+        b.render(scene, camera, settings);
+      }
+      bool same = a.numSamples() == 3 && b.numSamples() == 3;
+      for (uint32_t y = 0; y < frame.size().y; y++) {
+        for (uint32_t x = 0; x < frame.size().x; x++)
+          same = same && a.color(uvec2(x, y)) == b.color(uvec2(x, y));
+      }
+      CHECK(same);
+    }
+
+    THEN("Diffuse paths converge to the albedo times the sky in 'dpt' mode")
+    {
+      settings.type = ReferenceRendererType::DPT;
+      frame.resetAccumulation();
+      for (int i = 0; i < 16; i++)
+        frame.render(scene, camera, settings);
+      CHECK(meanColor(frame).x == Approx(1.f).epsilon(0.05f));
+    }
+  }
+
+  GIVEN("An emissive plane in the dark")
+  {
+    auto mesh = makeQuad(vec3(-100.f, 0.f, -100.f),
+        vec3(0.f, 0.f, 200.f),
+        vec3(200.f, 0.f, 0.f),
+        0,
+        vec3(0.5f));
+    mesh.material.emissive = vec3(2.f, 1.f, 0.f);
+    ReferenceScene scene;
+    scene.addMesh(mesh);
+    scene.commit();
+
+    ReferenceRendererSettings settings;
+    settings.type = ReferenceRendererType::DPT;
+    settings.ambientRadiance = 0.f;
+
+    ReferenceFrame frame(uvec2(8));
+    frame.render(scene, makeTopDownCamera(vec3(0.f, 1.f, 0.f)), settings);
+
+    THEN("Its material parameters reach the path tracer")
+    {
+      const vec4 c = meanColor(frame);
+      CHECK(c.x == Approx(2.f));
+      CHECK(c.y == Approx(1.f));
+      CHECK(c.z == Approx(0.f));
+    }
+  }
+
+  GIVEN("A camera looking past all geometry")
+  {
+    ReferenceScene scene;
+    scene.addMesh(makeQuad(
+        vec3(0.f), vec3(1.f, 0.f, 0.f), vec3(0.f, 0.f, 1.f), 0, vec3(1.f)));
+    scene.commit();
+
+    ReferenceRendererSettings settings;
+    settings.background = vec4(0.1f, 0.2f, 0.3f, 1.f);
+
+    ReferenceFrame frame(uvec2(8));
+    frame.render(scene, makeTopDownCamera(vec3(0.f, -1.f, 0.f)), settings);
+
+    THEN("Every pixel shows the background")
+    {
+      const vec4 c = meanColor(frame);
+      CHECK(c.x == Approx(0.1f));
+      CHECK(c.y == Approx(0.2f));
+      CHECK(c.z == Approx(0.3f));
+      CHECK(frame.objID(uvec2(4)) == ~0u);
+    }
+  }
+}
+
+SCENARIO("Reference AO matches analytic occlusion", "[Reference]")
+{
+  GIVEN("A floor point next to an infinite wall")
+  {
+    ReferenceScene scene;
+    scene.addMesh(makeQuad(vec3(0.f, -1e4f, -1e4f),
+        vec3(0.f, 2e4f, 0.f),
+        vec3(0.f, 0.f, 2e4f),
+        0,
+        vec3(1.f)));
+    scene.commit();
+
+    SurfaceHit hit;
+    hit.foundHit = true;
+    hit.t = 1.f;
+    hit.hitpoint = vec3(1e-3f, 0.f, 0.f);
+    hit.Ng = hit.Ns = vec3(0.f, 1.f, 0.f);
+    hit.epsilon = 1e-5f;
+
+    THEN("The wall blocks half of the cosine weighted hemisphere")
+    {
+      ReferenceRandom rng(0, 0);
+      const float ao = estimateAO(
+          hit,
+          1e20f,
+          4096,
+          AOSampling::LOW_DISCREPANCY,
+          0,
+          0,
+          [&](const Ray &r) { return scene.occluded(r); },
+          rng);
+      CHECK(ao == Approx(0.5f).margin(0.02f));
+    }
+
+    THEN("Occlusion beyond the AO distance is ignored")
+    {
+      hit.hitpoint = vec3(10.f, 0.f, 0.f);
+      ReferenceRandom rng(0, 0);
+      const float ao = estimateAO(
+          hit,
+          1.f,
+          256,
+          AOSampling::STRATIFIED,
+          0,
+          0,
+          [&](const Ray &r) { return scene.occluded(r); },
+          rng);
+      CHECK(ao == 1.f);
+    }
+  }
+}
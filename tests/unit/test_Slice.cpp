@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "gpu/slice.h"
+
+using namespace visrtx;
+
+SCENARIO("Rays hit slice planes within the ray interval", "[Slice]")
+{
+  GIVEN("The plane z == 2")
+  {
+    const vec4 plane = normalizeSlicePlane(vec4(0.f, 0.f, 3.f, 6.f));
+    const box1 rayT(0.f, 10.f);
+
+    THEN("Plane equations are normalized")
+    {
+      CHECK(plane == vec4(0.f, 0.f, 1.f, 2.f));
+    }
+
+    THEN("A ray towards the plane hits it at the right distance")
+    {
+      float t = 0.f;
+      CHECK(intersectSlicePlane(vec3(1.f, 1.f, 0.f),
+          vec3(0.f, 0.f, 2.f),
+          plane,
+          rayT,
+          t));
+      CHECK(t == Approx(1.f));
+    }
+
+    THEN("Rays parallel to the plane or past the interval miss it")
+    {
+      float t = 0.f;
+      CHECK(!intersectSlicePlane(
+          vec3(0.f), vec3(1.f, 0.f, 0.f), plane, rayT, t));
+      CHECK(!intersectSlicePlane(
+          vec3(0.f, 0.f, 4.f), vec3(0.f, 0.f, 1.f), plane, rayT, t));
+      CHECK(!intersectSlicePlane(
+          vec3(0.f), vec3(0.f, 0.f, 1.f), plane, box1(0.f, 1.f), t));
+    }
+
+    THEN("Normals face the incoming ray")
+    {
+      CHECK(slicePlaneNormal(plane, vec3(0.f, 0.f, 1.f)) == vec3(0, 0, -1));
+      CHECK(slicePlaneNormal(plane, vec3(0.f, 0.f, -1.f)) == vec3(0, 0, 1));
+    }
+  }
+}
+
+SCENARIO("Slice primitives are bounded by the volume", "[Slice]")
+{
+  GIVEN("A volume over [0, 4]^3")
+  {
+    const box3 bounds(vec3(0.f), vec3(4.f));
+
+    THEN("Axis aligned planes span a flat box")
+    {
+      const auto b = slicePlaneBounds(vec4(0.f, 1.f, 0.f, 1.f), bounds);
+      CHECK(b.lower == vec3(0.f, 1.f, 0.f));
+      CHECK(b.upper == vec3(4.f, 1.f, 4.f));
+    }
+
+    THEN("Planes on a face of the volume still get bounds")
+    {
+      const auto b = slicePlaneBounds(vec4(1.f, 0.f, 0.f, 0.f), bounds);
+      CHECK(b.lower == vec3(0.f));
+      CHECK(b.upper == vec3(0.f, 4.f, 4.f));
+    }
+
+    THEN("Oblique planes are bounded by their cut through the box")
+    {
+      const vec4 plane = normalizeSlicePlane(vec4(1.f, 1.f, 0.f, 2.f));
+      const auto b = slicePlaneBounds(plane, bounds);
+      CHECK(b.lower.x == Approx(0.f).margin(1e-5f));
+      CHECK(b.upper.x == Approx(2.f));
+      CHECK(b.upper.y == Approx(2.f));
+      CHECK(b.lower.z == Approx(0.f));
+      CHECK(b.upper.z == Approx(4.f));
+    }
+
+    THEN("Planes missing the volume get empty bounds")
+    {
+      CHECK(empty(slicePlaneBounds(vec4(0.f, 0.f, 1.f, 5.f), bounds)));
+    }
+  }
+}
+
+SCENARIO("Field texture coordinates put voxels at texel centers", "[Slice]")
+{
+  GIVEN("A 4x4x2 grid with unit spacing")
+  {
+    const vec3 origin(1.f);
+    const vec3 spacing(1.f);
+    const vec3 invSpacing = 1.f / (spacing * vec3(4.f, 4.f, 2.f));
+
+    THEN("The first and last voxels map to the first and last texels")
+    {
+      const auto first =
+          structuredRegularTexCoords(origin, origin, spacing, invSpacing);
+      CHECK(first == vec3(0.125f, 0.125f, 0.25f));
+      const auto last = structuredRegularTexCoords(
+          origin + vec3(3.f, 3.f, 1.f), origin, spacing, invSpacing);
+      CHECK(last == vec3(0.875f, 0.875f, 0.75f));
+    }
+
+    THEN("Points on a slice can be tested against the volume bounds")
+    {
+      const box3 bounds(origin, origin + vec3(3.f, 3.f, 1.f));
+      CHECK(contains(vec3(2.f, 2.f, 1.5f), bounds));
+      CHECK(!contains(vec3(2.f, 2.f, 2.5f), bounds));
+    }
+  }
+}
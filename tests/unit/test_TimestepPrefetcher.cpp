@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "utility/TimestepPrefetcher.h"
+
+using namespace visrtx;
+
+namespace {
+
+// Records uploads instead of issuing them, tracking what each slot holds
+struct MockUploadBackend
+{
+  struct Upload
+  {
+    size_t step;
+    size_t slot;
+    bool prefetch;
+  };
+
+  std::vector<Upload> uploads;
+  std::vector<size_t> slotContents = std::vector<size_t>(8, ~size_t(0));
+  std::vector<bool> pending = std::vector<bool>(8, false);
+  size_t stalls{0}; // waits on prefetches which hadn't finished yet
+
+  void upload(size_t step, size_t slot, bool prefetch)
+  {
+    uploads.push_back({step, slot, prefetch});
+    slotContents[slot] = step;
+    pending[slot] = prefetch;
+  }
+
+  void wait(size_t slot)
+  {
+    stalls += pending[slot];
+    pending[slot] = false;
+  }
+
+  void finishPrefetches()
+  {
+    std::fill(pending.begin(), pending.end(), false);
+  }
+
+  size_t numMisses() const
+  {
+    return std::count_if(uploads.begin(), uploads.end(), [](const Upload &u) {
+      return !u.prefetch;
+    });
+  }
+};
+
+} // namespace
+
+SCENARIO("Timesteps are prefetched ahead of playback", "[TimestepPrefetcher]")
+{
+  GIVEN("Ten steps with two slots")
+  {
+    MockUploadBackend backend;
+    TimestepPrefetcher<MockUploadBackend> prefetcher(backend, 10);
+
+    THEN("The first step is a miss which also prefetches the next one")
+    {
+      const size_t slot = prefetcher.select(0);
+      REQUIRE(backend.uploads.size() == 2);
+      CHECK(!backend.uploads[0].prefetch);
+      CHECK(backend.uploads[0].step == 0);
+      CHECK(backend.uploads[1].prefetch);
+      CHECK(backend.uploads[1].step == 1);
+      CHECK(backend.slotContents[slot] == 0);
+      CHECK(prefetcher.misses() == 1);
+    }
+
+    THEN("Forward playback only misses the first step")
+    {
+      for (size_t i = 0; i < 25; i++) {
+        const size_t step = i % 10;
+        const size_t slot = prefetcher.select(step);
+        CHECK(backend.slotContents[slot] == step);
+        backend.finishPrefetches(); // the frame takes longer than an upload
+      }
+      CHECK(prefetcher.misses() == 1);
+      CHECK(prefetcher.hits() == 24);
+      CHECK(backend.numMisses() == 1);
+      CHECK(backend.stalls == 0);
+    }
+
+    THEN("Switching steps faster than uploads stalls without missing")
+    {
+      prefetcher.select(0);
+      prefetcher.select(1);
+      CHECK(backend.stalls == 1);
+      CHECK(prefetcher.misses() == 1);
+    }
+
+    THEN("Backward playback prefetches the previous steps")
+    {
+      prefetcher.select(5);
+      prefetcher.select(4);
+      CHECK(backend.uploads.back().step == 3);
+      prefetcher.select(3);
+      prefetcher.select(2);
+      CHECK(prefetcher.misses() == 2); // 5, then 4 before playback reversed
+      CHECK(backend.uploads.back().step == 1);
+    }
+
+    THEN("Backward playback wraps around the first step")
+    {
+      prefetcher.select(1);
+      prefetcher.select(0);
+      CHECK(backend.uploads.back().step == 9);
+      prefetcher.select(9);
+      CHECK(prefetcher.hits() == 1);
+    }
+
+    THEN("Jumping elsewhere misses once and prefetches from there")
+    {
+      prefetcher.select(0);
+      prefetcher.select(7);
+      CHECK(prefetcher.misses() == 2);
+      CHECK(backend.uploads.back().step == 8);
+      const size_t slot = prefetcher.slotOf(8);
+      CHECK(prefetcher.select(8) == slot);
+      CHECK(prefetcher.hits() == 1);
+    }
+
+    THEN("Steps out of range are ignored")
+    {
+      CHECK(prefetcher.select(10) == prefetcher.NONE);
+      CHECK(backend.uploads.empty());
+    }
+
+    THEN("Invalidating forgets all slots")
+    {
+      prefetcher.select(0);
+      prefetcher.invalidate();
+      CHECK(prefetcher.slotOf(0) == prefetcher.NONE);
+      prefetcher.select(1);
+      CHECK(prefetcher.misses() == 2);
+    }
+  }
+
+  GIVEN("A longer lookahead")
+  {
+    MockUploadBackend backend;
+    TimestepPrefetcher<MockUploadBackend> prefetcher(backend, 6, 2, 3);
+
+    THEN("Slots grow to hold the current and all prefetched steps")
+    {
+      CHECK(prefetcher.numSlots() == 4);
+      prefetcher.select(4);
+      CHECK(prefetcher.slotOf(4) != prefetcher.NONE);
+      CHECK(prefetcher.slotOf(5) != prefetcher.NONE);
+      CHECK(prefetcher.slotOf(0) != prefetcher.NONE);
+      CHECK(prefetcher.slotOf(1) != prefetcher.NONE);
+    }
+
+    THEN("The current step is never evicted by prefetches")
+    {
+      for (size_t step : {0, 3, 1, 5, 2}) {
+        const size_t slot = prefetcher.select(step);
+        CHECK(backend.slotContents[slot] == step);
+      }
+    }
+  }
+
+  GIVEN("A single step")
+  {
+    MockUploadBackend backend;
+    TimestepPrefetcher<MockUploadBackend> prefetcher(backend, 1, 2, 1);
+
+    THEN("Nothing is prefetched and later selections hit")
+    {
+      prefetcher.select(0);
+      prefetcher.select(0);
+      CHECK(backend.uploads.size() == 1);
+      CHECK(prefetcher.hits() == 1);
+    }
+  }
+}
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "utility/TransformUpdateTracker.h"
+
+using namespace visrtx;
+
+SCENARIO("TransformUpdateTracker collects dirty instances", "[World]")
+{
+  TransformUpdateTracker tracker(4);
+  tracker.reset(100);
+
+  GIVEN("A freshly reset tracker")
+  {
+    THEN("Nothing is dirty and no rebuild is needed")
+    {
+      REQUIRE(tracker.empty());
+      REQUIRE(tracker.numInstances() == 100);
+      REQUIRE(!tracker.needsRebuild());
+      REQUIRE(tracker.dirtyRanges().empty());
+    }
+  }
+
+  GIVEN("Instances marked more than once")
+  {
+    tracker.markDirty(7);
+    tracker.markDirty(3);
+    tracker.markDirty(7);
+
+    THEN("Each instance is only recorded once")
+    {
+      REQUIRE(tracker.numDirty() == 2);
+    }
+
+    THEN("Marking them updated clears the dirty set")
+    {
+      tracker.markUpdated();
+      REQUIRE(tracker.empty());
+      tracker.markDirty(7);
+      REQUIRE(tracker.numDirty() == 1);
+    }
+  }
+
+  GIVEN("An instance index outside of the tracked range")
+  {
+    tracker.markDirty(100);
+
+    THEN("A full rebuild is requested")
+    {
+      REQUIRE(tracker.empty());
+      REQUIRE(tracker.needsRebuild());
+    }
+  }
+}
+
+SCENARIO("TransformUpdateTracker coalesces dirty ranges", "[World]")
+{
+  TransformUpdateTracker tracker;
+  tracker.reset(64);
+
+  for (size_t i : {10, 2, 3, 4, 12, 40})
+    tracker.markDirty(i);
+
+  GIVEN("No allowed gap")
+  {
+    auto ranges = tracker.dirtyRanges();
+
+    THEN("Only adjacent instances are merged")
+    {
+      REQUIRE(ranges.size() == 4);
+      REQUIRE(ranges[0].begin == 2);
+      REQUIRE(ranges[0].end == 5);
+      REQUIRE(ranges[1].begin == 10);
+      REQUIRE(ranges[1].end == 11);
+      REQUIRE(ranges[2].begin == 12);
+      REQUIRE(ranges[2].end == 13);
+      REQUIRE(ranges[3].begin == 40);
+      REQUIRE(ranges[3].end == 41);
+    }
+  }
+
+  GIVEN("A gap of a few instances")
+  {
+    auto ranges = tracker.dirtyRanges(8);
+
+    THEN("Nearby ranges are merged and every dirty index is covered")
+    {
+      REQUIRE(ranges.size() == 2);
+      REQUIRE(ranges[0].begin == 2);
+      REQUIRE(ranges[0].end == 13);
+      REQUIRE(ranges[1].begin == 40);
+      REQUIRE(ranges[1].end == 41);
+    }
+  }
+}
+
+SCENARIO("TransformUpdateTracker forces periodic rebuilds", "[World]")
+{
+  TransformUpdateTracker tracker(3);
+  tracker.reset(10);
+
+  for (int i = 0; i < 3; i++) {
+    REQUIRE(!tracker.needsRebuild());
+    tracker.markDirty(i);
+    tracker.markUpdated();
+  }
+
+  REQUIRE(tracker.needsRebuild());
+
+  tracker.reset(10);
+  REQUIRE(!tracker.needsRebuild());
+}
+
+SCENARIO("classifyInstanceChange decides how instance commits update the TLAS",
+    "[World]")
+{
+  int group = 0, otherGroup = 0, xfms = 0, colors = 0, otherColors = 0;
+
+  InstanceCommitState last;
+  last.group = &group;
+
+  GIVEN("An instance without arrays")
+  {
+    auto current = last;
+
+    THEN("Recommitting the same values changes nothing")
+    {
+      REQUIRE(classifyInstanceChange(last, current, false)
+          == InstanceChange::NONE);
+    }
+
+    THEN("New values only need a refit")
+    {
+      REQUIRE(classifyInstanceChange(last, current, true)
+          == InstanceChange::TRANSFORM);
+    }
+
+    THEN("A different or missing group needs a rebuild")
+    {
+      current.group = &otherGroup;
+      REQUIRE(classifyInstanceChange(last, current, false)
+          == InstanceChange::TLAS);
+      current.group = nullptr;
+      REQUIRE(classifyInstanceChange(last, current, false)
+          == InstanceChange::TLAS);
+    }
+  }
+
+  GIVEN("Attribute arrays on an instance")
+  {
+    auto current = last;
+    current.arrays[6] = &colors;
+
+    THEN("Adding one needs a refit")
+    {
+      REQUIRE(classifyInstanceChange(last, current, false)
+          == InstanceChange::TRANSFORM);
+    }
+
+    THEN("Replacing or removing one needs a refit")
+    {
+      last.arrays[6] = &otherColors;
+      REQUIRE(classifyInstanceChange(last, current, false)
+          == InstanceChange::TRANSFORM);
+      REQUIRE(classifyInstanceChange(current, last, false)
+          == InstanceChange::TRANSFORM);
+      current.arrays[6] = nullptr;
+      REQUIRE(classifyInstanceChange(last, current, false)
+          == InstanceChange::TRANSFORM);
+    }
+
+    THEN("Recommitting the same one needs a refit, as its contents may differ")
+    {
+      last.arrays[6] = &colors;
+      REQUIRE(classifyInstanceChange(last, current, false)
+          == InstanceChange::TRANSFORM);
+    }
+  }
+
+  GIVEN("A transform array changing size")
+  {
+    last.arrays[0] = &xfms;
+    last.numTransforms = 4;
+    auto current = last;
+    current.numTransforms = 5;
+
+    THEN("The number of instance records changes, so the TLAS is rebuilt")
+    {
+      REQUIRE(classifyInstanceChange(last, current, false)
+          == InstanceChange::TLAS);
+    }
+  }
+}
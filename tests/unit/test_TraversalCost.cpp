@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2019-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "catch.hpp"
+// visrtx
+#include "gpu/traversalCost.h"
+
+using namespace visrtx;
+
+SCENARIO("Traversal cost counters accumulate work per pixel", "[TraversalCost]")
+{
+  GIVEN("A set of counters")
+  {
+    TraversalCost cost;
+
+    WHEN("Work is counted")
+    {
+      countAnyHit(&cost);
+      countAnyHit(&cost);
+      countIntersection(&cost);
+      countVolumeSample(&cost);
+      countVolumeSample(&cost);
+      countVolumeSample(&cost);
+      countClocks(&cost, 100, 350);
+      countClocks(&cost, 1000, 1050);
+
+      THEN("Each metric reports its own count")
+      {
+        CHECK(costValue(cost, TraversalCostMetric::ANY_HITS) == 2.f);
+        CHECK(costValue(cost, TraversalCostMetric::INTERSECTIONS) == 1.f);
+        CHECK(costValue(cost, TraversalCostMetric::VOLUME_SAMPLES) == 3.f);
+        CHECK(costValue(cost, TraversalCostMetric::CLOCKS) == 300.f);
+      }
+    }
+
+    WHEN("The clock goes backwards")
+    {
+      countClocks(&cost, 500, 400);
+
+      THEN("No time is counted")
+      {
+        CHECK(cost.clocks == 0);
+      }
+    }
+  }
+
+  GIVEN("No counters")
+  {
+    THEN("Counting is a no-op")
+    {
+      countAnyHit(nullptr);
+      countIntersection(nullptr);
+      countVolumeSample(nullptr);
+      countClocks(nullptr, 0, 10);
+      SUCCEED();
+    }
+  }
+}
+
+SCENARIO("The largest cost of a frame is tracked", "[TraversalCost]")
+{
+  GIVEN("An empty maximum")
+  {
+    uint32_t costMax = 0;
+
+    WHEN("Costs are recorded")
+    {
+      recordCostMax(&costMax, 3.5f);
+      recordCostMax(&costMax, 120.f);
+      recordCostMax(&costMax, 7.f);
+      recordCostMax(&costMax, 0.f);
+
+      THEN("The largest one is kept")
+      {
+        CHECK(costMaxValue(costMax) == 120.f);
+      }
+    }
+
+    WHEN("Only zero or NaN costs are recorded")
+    {
+      recordCostMax(&costMax, 0.f);
+      recordCostMax(&costMax, std::numeric_limits<float>::quiet_NaN());
+
+      THEN("The maximum stays zero")
+      {
+        CHECK(costMaxValue(costMax) == 0.f);
+      }
+    }
+  }
+}
+
+SCENARIO("Costs map to a heat color ramp", "[TraversalCost]")
+{
+  GIVEN("A scale of 10")
+  {
+    const float scale = 10.f;
+
+    THEN("Zero cost is black")
+    {
+      CHECK(heatColor(0.f, scale) == vec3(0.f));
+    }
+
+    THEN("The midpoint is between cyan and green")
+    {
+      CHECK(heatColor(5.f, scale) == vec3(0.f, 1.f, 0.5f));
+    }
+
+    THEN("The scale and anything above it is red")
+    {
+      CHECK(heatColor(10.f, scale) == vec3(1.f, 0.f, 0.f));
+      CHECK(heatColor(1e6f, scale) == vec3(1.f, 0.f, 0.f));
+    }
+
+    THEN("Colors get warmer as cost goes up")
+    {
+      CHECK(heatColor(2.f, scale) == vec3(0.f, 0.f, 1.f));
+      CHECK(heatColor(6.f, scale) == vec3(0.f, 1.f, 0.f));
+      CHECK(heatColor(8.f, scale) == vec3(1.f, 1.f, 0.f));
+    }
+  }
+
+  GIVEN("No scale yet")
+  {
+    THEN("Any cost saturates")
+    {
+      CHECK(heatColor(0.f, 0.f) == vec3(0.f));
+      CHECK(heatColor(1.f, 0.f) == vec3(1.f, 0.f, 0.f));
+    }
+  }
+}